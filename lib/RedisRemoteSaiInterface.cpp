@@ -39,6 +39,8 @@ RedisRemoteSaiInterface::RedisRemoteSaiInterface(
 
     m_initialized = false;
 
+    m_notificationLatencyTime = std::chrono::steady_clock::now();
+
     initialize(0, nullptr);
 }
 
@@ -1685,6 +1687,8 @@ void RedisRemoteSaiInterface::handleNotification(
 
     m_recorder->recordNotification(name, serializedNotification, values);
 
+    recordNotificationLatency(name, values);
+
     auto notification = NotificationFactory::deserialize(name, serializedNotification);
 
     if (notification)
@@ -1697,6 +1701,50 @@ void RedisRemoteSaiInterface::handleNotification(
     }
 }
 
+void RedisRemoteSaiInterface::recordNotificationLatency(
+        _In_ const std::string &name,
+        _In_ const std::vector<swss::FieldValueTuple> &values)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& fv: values)
+    {
+        if (fvField(fv) != REDIS_NOTIFICATION_FIELD_TIMESTAMP)
+        {
+            continue;
+        }
+
+        uint64_t timestamp = strtoull(fvValue(fv).c_str(), nullptr, 10);
+
+        uint64_t now = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+
+        uint64_t latency = (now > timestamp) ? (now - timestamp) / 1000 : 0;
+
+        SWSS_LOG_DEBUG("notification %s latency %" PRIu64 " us", name.c_str(), latency);
+
+        m_notificationLatency[name].record(latency);
+        break;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (m_notificationLatency.empty() ||
+            now - m_notificationLatencyTime < std::chrono::seconds(NOTIFICATION_LATENCY_LOG_INTERVAL))
+    {
+        return;
+    }
+
+    m_notificationLatencyTime = now;
+
+    for (auto& kvp: m_notificationLatency)
+    {
+        SWSS_LOG_NOTICE("notification %s end to end latency us: %s",
+                kvp.first.c_str(),
+                kvp.second.toString().c_str());
+    }
+}
+
 sai_object_type_t RedisRemoteSaiInterface::objectTypeQuery(
         _In_ sai_object_id_t objectId)
 {
@@ -11,6 +11,7 @@
 #include "ContextConfig.h"
 
 #include "meta/Notification.h"
+#include "meta/LatencyHistogram.h"
 
 #include "swss/producertable.h"
 #include "swss/consumertable.h"
@@ -20,6 +21,12 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <chrono>
+
+/**
+ * @brief Interval of notification latency log (in seconds).
+ */
+#define NOTIFICATION_LATENCY_LOG_INTERVAL (60)
 
 namespace sairedis
 {
@@ -338,6 +345,14 @@ namespace sairedis
                     _In_ const std::string &serializedNotification,
                     _In_ const std::vector<swss::FieldValueTuple> &values);
 
+            /**
+             * @brief Record delay from syncd vendor callback to notification
+             * arrival, if notification was traced by syncd.
+             */
+            void recordNotificationLatency(
+                    _In_ const std::string &name,
+                    _In_ const std::vector<swss::FieldValueTuple> &values);
+
             sai_status_t setRedisExtensionAttribute(
                     _In_ sai_object_type_t objectType,
                     _In_ sai_object_id_t objectId,
@@ -391,5 +406,13 @@ namespace sairedis
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
             std::map<sai_object_id_t, swss::TableDump> m_tableDump;
+
+            /**
+             * @brief End to end notification latencies (in microseconds) by
+             * notification name, accessed only by notification thread.
+             */
+            std::map<std::string, sairediscommon::LatencyHistogram> m_notificationLatency;
+
+            std::chrono::steady_clock::time_point m_notificationLatencyTime;
     };
 }
@@ -80,6 +80,14 @@
      REDIS_TABLE_NOTIFICATIONS : \
      (dbName) + "_" + REDIS_TABLE_NOTIFICATIONS)
 
+/**
+ * @brief Notification field with time when notification was received from
+ * vendor callback by syncd (nanoseconds since epoch).
+ *
+ * Field is present only when syncd traces notifications.
+ */
+#define REDIS_NOTIFICATION_FIELD_TIMESTAMP "timestamp"
+
 /**
  * @brief Table which will be used to send API response from syncd.
  */
@@ -0,0 +1,136 @@
+#include "LatencyHistogram.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace sairediscommon;
+
+LatencyHistogram::LatencyHistogram()
+{
+    SWSS_LOG_ENTER();
+
+    reset();
+}
+
+void LatencyHistogram::record(
+        _In_ uint64_t latency)
+{
+    SWSS_LOG_ENTER();
+
+    m_buckets[getBucket(latency)]++;
+
+    m_count++;
+
+    m_total += latency;
+
+    m_max = std::max(m_max, latency);
+}
+
+void LatencyHistogram::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_buckets.fill(0);
+
+    m_count = 0;
+    m_total = 0;
+    m_max = 0;
+}
+
+uint64_t LatencyHistogram::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+uint64_t LatencyHistogram::getTotal() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_total;
+}
+
+uint64_t LatencyHistogram::getMax() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_max;
+}
+
+uint64_t LatencyHistogram::getAverage() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count ? m_total / m_count : 0;
+}
+
+uint64_t LatencyHistogram::getPercentile(
+        _In_ double percentile) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)((double)m_count * percentile / 100.0);
+
+    rank = std::max(rank, (uint64_t)1);
+
+    uint64_t seen = 0;
+
+    for (size_t bucket = 0; bucket < BUCKET_COUNT - 1; bucket++)
+    {
+        seen += m_buckets[bucket];
+
+        if (seen >= rank)
+        {
+            return std::min((uint64_t)1 << bucket, m_max);
+        }
+    }
+
+    return m_max;
+}
+
+const std::array<uint64_t, LatencyHistogram::BUCKET_COUNT>& LatencyHistogram::getBuckets() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_buckets;
+}
+
+std::string LatencyHistogram::toString() const
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    ss << "count " << m_count
+        << " avg " << getAverage()
+        << " p50 " << getPercentile(50)
+        << " p99 " << getPercentile(99)
+        << " max " << m_max;
+
+    return ss.str();
+}
+
+size_t LatencyHistogram::getBucket(
+        _In_ uint64_t latency)
+{
+    SWSS_LOG_ENTER();
+
+    size_t bucket = 0;
+
+    while (latency && bucket < BUCKET_COUNT - 1)
+    {
+        latency >>= 1;
+
+        bucket++;
+    }
+
+    return bucket;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <array>
+#include <string>
+
+#include <stdint.h>
+
+namespace sairediscommon
+{
+    /**
+     * @brief Histogram of latencies in microseconds.
+     *
+     * Buckets are powers of two: bucket 0 counts latencies below 1 us,
+     * bucket N counts latencies in range [2^(N-1), 2^N) us and last bucket
+     * counts all remaining latencies. Percentiles are approximated by upper
+     * bound of bucket.
+     *
+     * Histogram is not thread safe.
+     */
+    class LatencyHistogram
+    {
+        public:
+
+            static constexpr size_t BUCKET_COUNT = 24;
+
+        public:
+
+            LatencyHistogram();
+
+            ~LatencyHistogram() = default; // non virtual
+
+        public:
+
+            void record(
+                    _In_ uint64_t latency);
+
+            void reset();
+
+            uint64_t getCount() const;
+
+            uint64_t getTotal() const;
+
+            uint64_t getMax() const;
+
+            uint64_t getAverage() const;
+
+            /**
+             * @brief Get latency percentile.
+             *
+             * @param percentile Percentile in range (0, 100].
+             *
+             * @return Upper bound of bucket containing percentile, but no more
+             * than max recorded latency, zero when histogram is empty.
+             */
+            uint64_t getPercentile(
+                    _In_ double percentile) const;
+
+            const std::array<uint64_t, BUCKET_COUNT>& getBuckets() const;
+
+            /**
+             * @brief Get summary of histogram, like "count 10 avg 3 p50 4
+             * p99 8 max 7".
+             */
+            std::string toString() const;
+
+        public:
+
+            static size_t getBucket(
+                    _In_ uint64_t latency);
+
+        private:
+
+            std::array<uint64_t, BUCKET_COUNT> m_buckets;
+
+            uint64_t m_count;
+
+            uint64_t m_total;
+
+            uint64_t m_max;
+    };
+}
@@ -1102,7 +1102,36 @@ sai_status_t Meta::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_key);
+    PARAMETER_CHECK_IF_NOT_NULL(counters);
+
+    if (mode != SAI_STATS_MODE_BULK_READ && mode != SAI_STATS_MODE_BULK_READ_AND_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode value %d is not valid for bulk get stats", mode);
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        auto status = meta_validate_stats(object_type, object_key[idx].key.object_id, number_of_counters, counter_ids, &counters[idx * number_of_counters], mode);
+
+        CHECK_STATUS_SUCCESS(status);
+    }
+
+    auto status = m_implementation->bulkGetStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, counters);
+
+    // no post validation required
+
+    return status;
 }
 
 sai_status_t Meta::bulkClearStats(
@@ -1117,7 +1146,37 @@ sai_status_t Meta::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_key);
+
+    if (mode != SAI_STATS_MODE_BULK_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode value %d is not valid for bulk clear stats", mode);
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    uint64_t counters;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        auto status = meta_validate_stats(object_type, object_key[idx].key.object_id, number_of_counters, counter_ids, &counters, mode);
+
+        CHECK_STATUS_SUCCESS(status);
+    }
+
+    auto status = m_implementation->bulkClearStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    // no post validation required
+
+    return status;
 }
 
 // for bulk operations actually we could make copy of current db and actually
@@ -1,4 +1,5 @@
 #include "Notification.h"
+#include "sairediscommon.h"
 
 #include "swss/logger.h"
 
@@ -8,7 +9,18 @@ Notification::Notification(
         _In_ sai_switch_notification_type_t switchNotificationType,
         _In_ const std::string& serializedNotification):
     m_switchNotificationType(switchNotificationType),
-    m_serializedNotification(serializedNotification)
+    m_serializedNotification(serializedNotification),
+    m_traceTimestamps()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+Notification::Notification(
+        _In_ sai_switch_notification_type_t switchNotificationType):
+    m_switchNotificationType(switchNotificationType),
+    m_traceTimestamps()
 {
     SWSS_LOG_ENTER();
 
@@ -26,5 +38,73 @@ const std::string& Notification::getSerializedNotification() const
 {
     SWSS_LOG_ENTER();
 
+    if (m_serializedNotification.empty())
+    {
+        m_serializedNotification = serialize();
+    }
+
     return m_serializedNotification;
 }
+
+void Notification::setTraceTimestamp(
+        _In_ TraceStage stage,
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    m_traceTimestamps.at(stage) = timestamp;
+}
+
+uint64_t Notification::getTraceTimestamp(
+        _In_ TraceStage stage) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_traceTimestamps.at(stage);
+}
+
+bool Notification::isTraced() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_traceTimestamps[TRACE_STAGE_CALLBACK] != 0;
+}
+
+void Notification::resetSerializedNotification()
+{
+    SWSS_LOG_ENTER();
+
+    m_serializedNotification.clear();
+}
+
+const char* Notification::getName() const
+{
+    SWSS_LOG_ENTER();
+
+    switch (m_switchNotificationType)
+    {
+        case SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT:
+            return SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT:
+            return SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE:
+            return SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK:
+            return SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST:
+            return SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE:
+            return SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE:
+            return SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE;
+
+        default:
+            SWSS_LOG_THROW("unknown notification type: %d, FIXME", m_switchNotificationType);
+    }
+}
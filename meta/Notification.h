@@ -8,11 +8,39 @@ extern "C" {
 
 #include <string>
 #include <memory>
+#include <array>
 
 namespace sairedis
 {
     class Notification
     {
+        public:
+
+            /**
+             * @brief Stages of notification processing in syncd, traced
+             * when notification tracing is enabled.
+             */
+            typedef enum _TraceStage
+            {
+                /**
+                 * @brief Notification was received from vendor callback.
+                 */
+                TRACE_STAGE_CALLBACK,
+
+                TRACE_STAGE_ENQUEUE,
+
+                TRACE_STAGE_DEQUEUE,
+
+                /**
+                 * @brief Processing of notification started, under syncd
+                 * lock.
+                 */
+                TRACE_STAGE_PROCESS,
+
+                TRACE_STAGE_COUNT,
+
+            } TraceStage;
+
         public:
 
             Notification(
@@ -21,6 +49,17 @@ namespace sairedis
 
             virtual ~Notification() = default;
 
+        protected:
+
+            /**
+             * @brief Notification created from native notification data.
+             *
+             * Data is serialized only when serialized notification is
+             * requested.
+             */
+            Notification(
+                    _In_ sai_switch_notification_type_t switchNotificationType);
+
         public:
 
             /**
@@ -74,6 +113,14 @@ namespace sairedis
             virtual void executeCallback(
                     _In_ const sai_switch_notifications_t& switchNotifications) const = 0;
 
+            /**
+             * @brief Serialize current notification data.
+             *
+             * Data could be modified after notification was created (for
+             * example RID to VID translation), result reflects those changes.
+             */
+            virtual std::string serialize() const = 0;
+
         public:
 
             /**
@@ -84,14 +131,50 @@ namespace sairedis
             /**
              * @brief Get serialized notification.
              *
-             * Contains all notification data without notification name.
+             * Contains all notification data without notification name. If
+             * notification was created from native data, data is serialized
+             * on first call.
              */
             const std::string& getSerializedNotification() const;
 
+            /**
+             * @brief Get notification name, as used in notification channel.
+             */
+            const char* getName() const;
+
+            /**
+             * @brief Set timestamp of processing stage (nanoseconds of
+             * steady clock).
+             */
+            void setTraceTimestamp(
+                    _In_ TraceStage stage,
+                    _In_ uint64_t timestamp);
+
+            /**
+             * @brief Get timestamp of processing stage, zero when stage was
+             * not traced.
+             */
+            uint64_t getTraceTimestamp(
+                    _In_ TraceStage stage) const;
+
+            /**
+             * @brief Notification is traced if callback timestamp is set.
+             */
+            bool isTraced() const;
+
+        protected:
+
+            /**
+             * @brief Drop serialized notification after data was modified.
+             */
+            void resetSerializedNotification();
+
         private:
 
             const sai_switch_notification_type_t m_switchNotificationType;
 
-            const std::string m_serializedNotification;
+            mutable std::string m_serializedNotification;
+
+            std::array<uint64_t, TRACE_STAGE_COUNT> m_traceTimestamps;
     };
 }
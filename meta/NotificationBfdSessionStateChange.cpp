@@ -21,6 +21,21 @@ NotificationBfdSessionStateChange::NotificationBfdSessionStateChange(
             &m_bfdSessionStateNotificationData);
 }
 
+NotificationBfdSessionStateChange::NotificationBfdSessionStateChange(
+        _In_ uint32_t count,
+        _In_ const sai_bfd_session_state_notification_t* bfdSessionState):
+    Notification(SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE),
+    m_count(count),
+    m_bfdSessionStateNotificationData(new sai_bfd_session_state_notification_t[count])
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        m_bfdSessionStateNotificationData[idx] = bfdSessionState[idx];
+    }
+}
+
 NotificationBfdSessionStateChange::~NotificationBfdSessionStateChange()
 {
     SWSS_LOG_ENTER();
@@ -75,3 +90,24 @@ void NotificationBfdSessionStateChange::executeCallback(
         switchNotifications.on_bfd_session_state_change(m_count, m_bfdSessionStateNotificationData);
     }
 }
+
+std::string NotificationBfdSessionStateChange::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_bfd_session_state_ntf(m_count, m_bfdSessionStateNotificationData);
+}
+
+uint32_t NotificationBfdSessionStateChange::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+sai_bfd_session_state_notification_t* NotificationBfdSessionStateChange::getData()
+{
+    SWSS_LOG_ENTER();
+
+    return m_bfdSessionStateNotificationData;
+}
@@ -12,6 +12,16 @@ namespace sairedis
             NotificationBfdSessionStateChange(
                     _In_ const std::string& serializedNotification);
 
+            /**
+             * @brief Create notification from vendor callback data.
+             *
+             * Data is deep copied, so notification can be queued after
+             * callback returns.
+             */
+            NotificationBfdSessionStateChange(
+                    _In_ uint32_t count,
+                    _In_ const sai_bfd_session_state_notification_t* bfdSessionState);
+
             virtual ~NotificationBfdSessionStateChange();
 
         public:
@@ -26,6 +36,20 @@ namespace sairedis
             virtual void executeCallback(
                     _In_ const sai_switch_notifications_t& switchNotifications) const override;
 
+            virtual std::string serialize() const override;
+
+        public:
+
+            uint32_t getCount() const;
+
+            /**
+             * @brief Get notification data, which can be modified in place.
+             *
+             * Serialized notification is not updated, use serialize() to
+             * obtain modified data.
+             */
+            sai_bfd_session_state_notification_t* getData();
+
         private:
 
             uint32_t m_count;
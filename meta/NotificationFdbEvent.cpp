@@ -6,6 +6,36 @@
 
 using namespace sairedis;
 
+static void copyAttribute(
+        _In_ const sai_attribute_t& src,
+        _Out_ sai_attribute_t& dst)
+{
+    SWSS_LOG_ENTER();
+
+    auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_FDB_ENTRY, src.id);
+
+    if (meta == NULL)
+    {
+        SWSS_LOG_THROW("unable to get metadata for object type %s, attribute %d",
+                sai_serialize_object_type(SAI_OBJECT_TYPE_FDB_ENTRY).c_str(),
+                src.id);
+    }
+
+    if (meta->isprimitive)
+    {
+        dst = src;
+
+        return;
+    }
+
+    // lists must be allocated the same way as deserialize does, since they
+    // will be released by sai_deserialize_free_fdb_event_ntf
+
+    dst.id = src.id;
+
+    sai_deserialize_attr_value(sai_serialize_attr_value(*meta, src), *meta, dst);
+}
+
 NotificationFdbEvent::NotificationFdbEvent(
         _In_ const std::string& serializedNotification):
     Notification(
@@ -21,6 +51,30 @@ NotificationFdbEvent::NotificationFdbEvent(
             &m_fdbEventNotificationData);
 }
 
+NotificationFdbEvent::NotificationFdbEvent(
+        _In_ uint32_t count,
+        _In_ const sai_fdb_event_notification_data_t* fdbEvent):
+    Notification(SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT),
+    m_count(count),
+    m_fdbEventNotificationData(new sai_fdb_event_notification_data_t[count])
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        auto& dst = m_fdbEventNotificationData[idx];
+
+        dst = fdbEvent[idx];
+
+        dst.attr = new sai_attribute_t[dst.attr_count];
+
+        for (uint32_t i = 0; i < dst.attr_count; i++)
+        {
+            copyAttribute(fdbEvent[idx].attr[i], dst.attr[i]);
+        }
+    }
+}
+
 NotificationFdbEvent::~NotificationFdbEvent()
 {
     SWSS_LOG_ENTER();
@@ -98,3 +152,75 @@ void NotificationFdbEvent::executeCallback(
         switchNotifications.on_fdb_event(m_count, m_fdbEventNotificationData);
     }
 }
+
+std::string NotificationFdbEvent::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_fdb_event_ntf(m_count, m_fdbEventNotificationData);
+}
+
+uint32_t NotificationFdbEvent::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+sai_fdb_event_notification_data_t* NotificationFdbEvent::getData()
+{
+    SWSS_LOG_ENTER();
+
+    return m_fdbEventNotificationData;
+}
+
+void NotificationFdbEvent::swapEntry(
+        _In_ uint32_t index,
+        _Inout_ NotificationFdbEvent& other,
+        _In_ uint32_t otherIndex)
+{
+    SWSS_LOG_ENTER();
+
+    if (index >= m_count || otherIndex >= other.m_count)
+    {
+        SWSS_LOG_THROW("invalid entry index %u/%u, count %u/%u",
+                index,
+                otherIndex,
+                m_count,
+                other.m_count);
+    }
+
+    std::swap(m_fdbEventNotificationData[index], other.m_fdbEventNotificationData[otherIndex]);
+
+    resetSerializedNotification();
+
+    other.resetSerializedNotification();
+}
+
+void NotificationFdbEvent::removeEntries(
+        _In_ const std::vector<bool>& remove)
+{
+    SWSS_LOG_ENTER();
+
+    if (remove.size() != m_count)
+    {
+        SWSS_LOG_THROW("remove vector size %zu don't match count %u", remove.size(), m_count);
+    }
+
+    uint32_t count = 0;
+
+    for (uint32_t idx = 0; idx < m_count; idx++)
+    {
+        if (remove[idx])
+        {
+            sai_deserialize_free_fdb_event(m_fdbEventNotificationData[idx]);
+            continue;
+        }
+
+        m_fdbEventNotificationData[count++] = m_fdbEventNotificationData[idx];
+    }
+
+    m_count = count;
+
+    resetSerializedNotification();
+}
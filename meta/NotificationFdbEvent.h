@@ -12,6 +12,16 @@ namespace sairedis
             NotificationFdbEvent(
                     _In_ const std::string& serializedNotification);
 
+            /**
+             * @brief Create notification from vendor callback data.
+             *
+             * Data is deep copied, so notification can be queued after
+             * callback returns.
+             */
+            NotificationFdbEvent(
+                    _In_ uint32_t count,
+                    _In_ const sai_fdb_event_notification_data_t* fdbEvent);
+
             virtual ~NotificationFdbEvent();
 
         public:
@@ -26,6 +36,39 @@ namespace sairedis
             virtual void executeCallback(
                     _In_ const sai_switch_notifications_t& switchNotifications) const override;
 
+            virtual std::string serialize() const override;
+
+        public:
+
+            uint32_t getCount() const;
+
+            /**
+             * @brief Get notification data, which can be modified in place.
+             *
+             * Serialized notification is not updated, use serialize() to
+             * obtain modified data.
+             */
+            sai_fdb_event_notification_data_t* getData();
+
+            /**
+             * @brief Swap entry with entry of other notification.
+             *
+             * Used to coalesce events of the same FDB entry, serialized
+             * notification of both notifications is reset.
+             */
+            void swapEntry(
+                    _In_ uint32_t index,
+                    _Inout_ NotificationFdbEvent& other,
+                    _In_ uint32_t otherIndex);
+
+            /**
+             * @brief Remove entries marked in remove vector.
+             *
+             * Order of remaining entries is preserved.
+             */
+            void removeEntries(
+                    _In_ const std::vector<bool>& remove);
+
         private:
 
             uint32_t m_count;
@@ -21,6 +21,21 @@ NotificationNatEvent::NotificationNatEvent(
             &m_natEventNotificationData);
 }
 
+NotificationNatEvent::NotificationNatEvent(
+        _In_ uint32_t count,
+        _In_ const sai_nat_event_notification_data_t* natEvent):
+    Notification(SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT),
+    m_count(count),
+    m_natEventNotificationData(new sai_nat_event_notification_data_t[count])
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        m_natEventNotificationData[idx] = natEvent[idx];
+    }
+}
+
 NotificationNatEvent::~NotificationNatEvent()
 {
     SWSS_LOG_ENTER();
@@ -95,3 +110,24 @@ void NotificationNatEvent::executeCallback(
         switchNotifications.on_nat_event(m_count, m_natEventNotificationData);
     }
 }
+
+std::string NotificationNatEvent::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_nat_event_ntf(m_count, m_natEventNotificationData);
+}
+
+uint32_t NotificationNatEvent::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+sai_nat_event_notification_data_t* NotificationNatEvent::getData()
+{
+    SWSS_LOG_ENTER();
+
+    return m_natEventNotificationData;
+}
@@ -21,6 +21,21 @@ NotificationPortStateChange::NotificationPortStateChange(
             &m_portOperaStatusNotificationData);
 }
 
+NotificationPortStateChange::NotificationPortStateChange(
+        _In_ uint32_t count,
+        _In_ const sai_port_oper_status_notification_t* portOperStatus):
+    Notification(SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE),
+    m_count(count),
+    m_portOperaStatusNotificationData(new sai_port_oper_status_notification_t[count])
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        m_portOperaStatusNotificationData[idx] = portOperStatus[idx];
+    }
+}
+
 NotificationPortStateChange::~NotificationPortStateChange()
 {
     SWSS_LOG_ENTER();
@@ -75,3 +90,24 @@ void NotificationPortStateChange::executeCallback(
         switchNotifications.on_port_state_change(m_count, m_portOperaStatusNotificationData);
     }
 }
+
+std::string NotificationPortStateChange::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_port_oper_status_ntf(m_count, m_portOperaStatusNotificationData);
+}
+
+uint32_t NotificationPortStateChange::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+sai_port_oper_status_notification_t* NotificationPortStateChange::getData()
+{
+    SWSS_LOG_ENTER();
+
+    return m_portOperaStatusNotificationData;
+}
@@ -21,6 +21,21 @@ NotificationQueuePfcDeadlock::NotificationQueuePfcDeadlock(
             &m_queueDeadlockNotificationData);
 }
 
+NotificationQueuePfcDeadlock::NotificationQueuePfcDeadlock(
+        _In_ uint32_t count,
+        _In_ const sai_queue_deadlock_notification_data_t* queueDeadlock):
+    Notification(SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK),
+    m_count(count),
+    m_queueDeadlockNotificationData(new sai_queue_deadlock_notification_data_t[count])
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        m_queueDeadlockNotificationData[idx] = queueDeadlock[idx];
+    }
+}
+
 NotificationQueuePfcDeadlock::~NotificationQueuePfcDeadlock()
 {
     SWSS_LOG_ENTER();
@@ -75,3 +90,24 @@ void NotificationQueuePfcDeadlock::executeCallback(
         switchNotifications.on_queue_pfc_deadlock(m_count, m_queueDeadlockNotificationData);
     }
 }
+
+std::string NotificationQueuePfcDeadlock::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_queue_deadlock_ntf(m_count, m_queueDeadlockNotificationData);
+}
+
+uint32_t NotificationQueuePfcDeadlock::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+sai_queue_deadlock_notification_data_t* NotificationQueuePfcDeadlock::getData()
+{
+    SWSS_LOG_ENTER();
+
+    return m_queueDeadlockNotificationData;
+}
@@ -17,6 +17,16 @@ NotificationSwitchShutdownRequest::NotificationSwitchShutdownRequest(
     sai_deserialize_switch_shutdown_request(serializedNotification, m_switchId);
 }
 
+NotificationSwitchShutdownRequest::NotificationSwitchShutdownRequest(
+        _In_ sai_object_id_t switchId):
+    Notification(SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST),
+    m_switchId(switchId)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
 sai_object_id_t NotificationSwitchShutdownRequest::getSwitchId() const
 {
     SWSS_LOG_ENTER();
@@ -49,3 +59,10 @@ void NotificationSwitchShutdownRequest::executeCallback(
         switchNotifications.on_switch_shutdown_request(m_switchId);
     }
 }
+
+std::string NotificationSwitchShutdownRequest::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_switch_shutdown_request(m_switchId);
+}
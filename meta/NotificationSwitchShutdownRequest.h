@@ -12,6 +12,9 @@ namespace sairedis
             NotificationSwitchShutdownRequest(
                     _In_ const std::string& serializedNotification);
 
+            NotificationSwitchShutdownRequest(
+                    _In_ sai_object_id_t switchId);
+
             virtual ~NotificationSwitchShutdownRequest() = default;
 
         public:
@@ -26,6 +29,8 @@ namespace sairedis
             virtual void executeCallback(
                     _In_ const sai_switch_notifications_t& switchNotifications) const override;
 
+            virtual std::string serialize() const override;
+
         private:
 
             sai_object_id_t m_switchId;
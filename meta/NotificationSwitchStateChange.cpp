@@ -20,6 +20,18 @@ NotificationSwitchStateChange::NotificationSwitchStateChange(
             m_switchOperStatus);
 }
 
+NotificationSwitchStateChange::NotificationSwitchStateChange(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_switch_oper_status_t switchOperStatus):
+    Notification(SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE),
+    m_switchId(switchId),
+    m_switchOperStatus(switchOperStatus)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
 sai_object_id_t NotificationSwitchStateChange::getSwitchId() const
 {
     SWSS_LOG_ENTER();
@@ -52,3 +64,17 @@ void NotificationSwitchStateChange::executeCallback(
         switchNotifications.on_switch_state_change(m_switchId, m_switchOperStatus);
     }
 }
+
+std::string NotificationSwitchStateChange::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_switch_oper_status(m_switchId, m_switchOperStatus);
+}
+
+sai_switch_oper_status_t NotificationSwitchStateChange::getSwitchOperStatus() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_switchOperStatus;
+}
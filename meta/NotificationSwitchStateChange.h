@@ -12,6 +12,10 @@ namespace sairedis
             NotificationSwitchStateChange(
                     _In_ const std::string& serializedNotification);
 
+            NotificationSwitchStateChange(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_switch_oper_status_t switchOperStatus);
+
             virtual ~NotificationSwitchStateChange() = default;
 
         public:
@@ -26,6 +30,12 @@ namespace sairedis
             virtual void executeCallback(
                     _In_ const sai_switch_notifications_t& switchNotifications) const override;
 
+            virtual std::string serialize() const override;
+
+        public:
+
+            sai_switch_oper_status_t getSwitchOperStatus() const;
+
         private:
 
             sai_object_id_t m_switchId;
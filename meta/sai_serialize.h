@@ -478,6 +478,9 @@ void sai_deserialize_free_attribute_value(
 
 // deserialize free notifications
 
+void sai_deserialize_free_fdb_event(
+        _In_ sai_fdb_event_notification_data_t& fdb_event);
+
 void sai_deserialize_free_fdb_event_ntf(
         _In_ uint32_t count,
         _In_ sai_fdb_event_notification_data_t* fdbdata);
@@ -192,7 +192,8 @@ bool ViewCmp::compareViews(
             initViewRemovedVids,
             m_va->m_asicView, // current
             m_vb->m_asicView, // temp
-            breakConfig);
+            breakConfig,
+            true); // enableViewFingerprints
 
     cl->compareViews();
 
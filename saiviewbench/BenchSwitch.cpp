@@ -0,0 +1,179 @@
+#include "BenchSwitch.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=noreturn"
+
+using namespace saiviewbench;
+
+BenchSwitch::BenchSwitch(
+        _In_ sai_object_id_t switchVid,
+        _In_ sai_object_id_t switchRid,
+        _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& vid2rid,
+        _In_ const std::map<sai_attr_id_t, sai_object_id_t>& defaultRidMap,
+        _In_ const std::set<sai_object_id_t>& discoveredVids):
+    SaiSwitchInterface(switchVid, switchRid),
+    m_vid2rid(vid2rid)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& v2r: m_vid2rid)
+    {
+        m_rid2vid[v2r.second] = v2r.first;
+    }
+
+    m_default_rid_map = defaultRidMap;
+
+    m_coldBootDiscoveredVids = discoveredVids;
+
+    for (auto vid: discoveredVids)
+    {
+        m_discoveredRids.insert(m_vid2rid.at(vid));
+    }
+}
+
+std::unordered_map<sai_object_id_t, sai_object_id_t> BenchSwitch::getVidToRidMap() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_vid2rid;
+}
+
+std::unordered_map<sai_object_id_t, sai_object_id_t> BenchSwitch::getRidToVidMap() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_rid2vid;
+}
+
+bool BenchSwitch::isDiscoveredRid(
+        _In_ sai_object_id_t rid) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_discoveredRids.find(rid) != m_discoveredRids.end();
+}
+
+bool BenchSwitch::isColdBootDiscoveredRid(
+        _In_ sai_object_id_t rid) const
+{
+    SWSS_LOG_ENTER();
+
+    return isDiscoveredRid(rid);
+}
+
+bool BenchSwitch::isSwitchObjectDefaultRid(
+        _In_ sai_object_id_t rid) const
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &p: m_default_rid_map)
+    {
+        if (p.second == rid)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool BenchSwitch::isNonRemovableRid(
+        _In_ sai_object_id_t rid) const
+{
+    SWSS_LOG_ENTER();
+
+    if (rid == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_THROW("NULL rid passed");
+    }
+
+    /*
+     * Benchmark only discovers switch, ports and switch default objects, all
+     * of them are non removable.
+     */
+
+    return isDiscoveredRid(rid);
+}
+
+std::set<sai_object_id_t> BenchSwitch::getDiscoveredRids() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_discoveredRids;
+}
+
+void BenchSwitch::removeExistingObject(
+        _In_ sai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
+
+void BenchSwitch::removeExistingObjectReference(
+        _In_ sai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented, discovered object %s should not be removed",
+            sai_serialize_object_id(rid).c_str());
+}
+
+void BenchSwitch::getDefaultMacAddress(
+        _Out_ sai_mac_t& mac) const
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
+
+sai_object_id_t BenchSwitch::getDefaultValueForOidAttr(
+        _In_ sai_object_id_t rid,
+        _In_ sai_attr_id_t attr_id)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
+
+std::set<sai_object_id_t> BenchSwitch::getColdBootDiscoveredVids() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_coldBootDiscoveredVids;
+}
+
+std::set<sai_object_id_t> BenchSwitch::getWarmBootDiscoveredVids() const
+{
+    SWSS_LOG_ENTER();
+
+    return {};
+}
+
+void BenchSwitch::onPostPortCreate(
+        _In_ sai_object_id_t port_rid,
+        _In_ sai_object_id_t port_vid)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
+
+void BenchSwitch::postPortRemove(
+        _In_ sai_object_id_t portRid)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
+
+void BenchSwitch::collectPortRelatedObjects(
+        _In_ sai_object_id_t portRid)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
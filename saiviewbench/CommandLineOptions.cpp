@@ -0,0 +1,47 @@
+#include "CommandLineOptions.h"
+
+#include "swss/logger.h"
+
+#include <sstream>
+
+using namespace saiviewbench;
+
+CommandLineOptions::CommandLineOptions()
+{
+    SWSS_LOG_ENTER();
+
+    // default values for command line options
+
+    m_enableLogLevelInfo = false;
+
+    m_routes = 10000;
+    m_neighbors = 256;
+    m_nextHopGroups = 64;
+    m_nextHopGroupMembers = 4;
+    m_aclEntries = 256;
+
+    m_changedFraction = 0.01;
+
+    m_seed = 0;
+
+    m_disableViewFingerprints = false;
+}
+
+std::string CommandLineOptions::getCommandLineString() const
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    ss << " EnableLogLevelInfo=" << (m_enableLogLevelInfo ? "YES" : "NO");
+    ss << " Routes=" << m_routes;
+    ss << " Neighbors=" << m_neighbors;
+    ss << " NextHopGroups=" << m_nextHopGroups;
+    ss << " NextHopGroupMembers=" << m_nextHopGroupMembers;
+    ss << " AclEntries=" << m_aclEntries;
+    ss << " ChangedFraction=" << m_changedFraction;
+    ss << " Seed=" << m_seed;
+    ss << " DisableViewFingerprints=" << (m_disableViewFingerprints ? "YES" : "NO");
+
+    return ss.str();
+}
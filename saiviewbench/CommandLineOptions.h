@@ -0,0 +1,46 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <cstdint>
+
+namespace saiviewbench
+{
+    class CommandLineOptions
+    {
+        public:
+
+            CommandLineOptions();
+
+            virtual ~CommandLineOptions() = default;
+
+        public:
+
+            virtual std::string getCommandLineString() const;
+
+        public:
+
+            bool m_enableLogLevelInfo;
+
+            uint32_t m_routes;
+
+            uint32_t m_neighbors;
+
+            uint32_t m_nextHopGroups;
+
+            uint32_t m_nextHopGroupMembers;
+
+            uint32_t m_aclEntries;
+
+            /**
+             * @brief Fraction of objects (0.0 - 1.0) that will be modified in
+             * temporary view compared to current view.
+             */
+            double m_changedFraction;
+
+            uint32_t m_seed;
+
+            bool m_disableViewFingerprints;
+    };
+}
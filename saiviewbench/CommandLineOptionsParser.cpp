@@ -0,0 +1,139 @@
+#include "CommandLineOptionsParser.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+
+#include <iostream>
+
+using namespace saiviewbench;
+
+std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
+        _In_ int argc,
+        _In_ char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    auto options = std::make_shared<CommandLineOptions>();
+
+    const char* const optstring = "ir:n:g:m:a:c:s:Vh";
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "enableLogLevelInfo",      no_argument,       0, 'i' },
+            { "routes",                  required_argument, 0, 'r' },
+            { "neighbors",               required_argument, 0, 'n' },
+            { "nextHopGroups",           required_argument, 0, 'g' },
+            { "nextHopGroupMembers",     required_argument, 0, 'm' },
+            { "aclEntries",              required_argument, 0, 'a' },
+            { "changed",                 required_argument, 0, 'c' },
+            { "seed",                    required_argument, 0, 's' },
+            { "disableViewFingerprints", no_argument,       0, 'V' },
+            { "help",                    no_argument,       0, 'h' },
+            { 0,                         0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'i':
+                options->m_enableLogLevelInfo = true;
+                break;
+
+            case 'r':
+                options->m_routes = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'n':
+                options->m_neighbors = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'g':
+                options->m_nextHopGroups = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'm':
+                options->m_nextHopGroupMembers = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'a':
+                options->m_aclEntries = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'c':
+                options->m_changedFraction = std::stod(optarg);
+
+                if (options->m_changedFraction < 0.0 || options->m_changedFraction > 1.0)
+                {
+                    SWSS_LOG_ERROR("changed fraction must be in range 0.0 - 1.0, given: %s", optarg);
+                    exit(EXIT_FAILURE);
+                }
+
+                break;
+
+            case 's':
+                options->m_seed = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'V':
+                options->m_disableViewFingerprints = true;
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            case '?':
+                SWSS_LOG_WARN("unknown option %c", optopt);
+                printUsage();
+                exit(EXIT_FAILURE);
+
+            default:
+                SWSS_LOG_ERROR("getopt_long failure");
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    return options;
+}
+
+void CommandLineOptionsParser::printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: saiviewbench [-i] [-r routes] [-n neighbors] [-g groups] [-m members] [-a entries] [-c fraction] [-s seed] [-V] [-h]" << std::endl << std::endl;
+
+    std::cout << "    Generates synthetic current and temporary ASIC views, runs apply view" << std::endl;
+    std::cout << "    comparison logic against virtual switch and prints timings as json" << std::endl << std::endl;
+
+    std::cout << "    -i --enableLogLevelInfo" << std::endl;
+    std::cout << "        Enable LogLevel INFO" << std::endl;
+    std::cout << "    -r --routes" << std::endl;
+    std::cout << "        Number of route entries" << std::endl;
+    std::cout << "    -n --neighbors" << std::endl;
+    std::cout << "        Number of neighbor entries (and next hops)" << std::endl;
+    std::cout << "    -g --nextHopGroups" << std::endl;
+    std::cout << "        Number of next hop groups" << std::endl;
+    std::cout << "    -m --nextHopGroupMembers" << std::endl;
+    std::cout << "        Number of members in each next hop group" << std::endl;
+    std::cout << "    -a --aclEntries" << std::endl;
+    std::cout << "        Number of ACL entries" << std::endl;
+    std::cout << "    -c --changed" << std::endl;
+    std::cout << "        Fraction of objects changed in temporary view (0.0 - 1.0)" << std::endl;
+    std::cout << "    -s --seed" << std::endl;
+    std::cout << "        Seed used to select changed objects" << std::endl;
+    std::cout << "    -V --disableViewFingerprints" << std::endl;
+    std::cout << "        Disable skipping of identical object types in comparison logic" << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CommandLineOptions.h"
+
+#include <memory>
+
+namespace saiviewbench
+{
+    class CommandLineOptionsParser
+    {
+        private:
+
+            CommandLineOptionsParser() = delete;
+
+            ~CommandLineOptionsParser() = delete;
+
+        public:
+
+            static std::shared_ptr<CommandLineOptions> parseCommandLine(
+                    _In_ int argc,
+                    _In_ char **argv);
+
+            static void printUsage();
+    };
+}
@@ -0,0 +1,664 @@
+#include "ViewBench.h"
+#include "BenchSwitch.h"
+
+#include "syncd/AsicView.h"
+#include "syncd/ComparisonLogic.h"
+
+#include "vslib/ContextConfigContainer.h"
+#include "vslib/VirtualSwitchSaiInterface.h"
+
+#include "meta/NumberOidIndexGenerator.h"
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/json.hpp"
+
+#include <arpa/inet.h>
+#include <sys/resource.h>
+#include <inttypes.h>
+#include <errno.h>
+
+#include <cstring>
+#include <chrono>
+
+using json = nlohmann::json;
+
+using namespace saiviewbench;
+
+#define MAX_PORTS 1024
+
+#define NEIGHBOR_IP_BASE    0x0a000001 // 10.0.0.1
+#define ROUTE_PREFIX_BASE   0x14000000 // 20.0.0.0/24
+#define ACL_DST_IP_BASE     0x1e000000 // 30.0.0.0
+
+ViewBench::ViewBench(
+        _In_ std::shared_ptr<CommandLineOptions> options):
+    m_options(options),
+    m_generator(options->m_seed)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& o: m_objects)
+    {
+        o.switchId = SAI_NULL_OBJECT_ID;
+        o.cpuPort = SAI_NULL_OBJECT_ID;
+        o.virtualRouter = SAI_NULL_OBJECT_ID;
+        o.trapGroup = SAI_NULL_OBJECT_ID;
+        o.aclTable = SAI_NULL_OBJECT_ID;
+    }
+
+    if (m_options->m_neighbors == 0 && (m_options->m_routes || m_options->m_nextHopGroups))
+    {
+        SWSS_LOG_THROW("routes and next hop groups require at least one neighbor");
+    }
+
+    auto sc = std::make_shared<sairedis::SwitchConfig>(0, "");
+
+    auto scc = std::make_shared<sairedis::SwitchConfigContainer>();
+
+    scc->insert(sc);
+
+    m_vidManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, scc, std::make_shared<saimeta::NumberOidIndexGenerator>());
+
+    m_changedNeighbors = selectChanged(m_options->m_neighbors);
+    m_changedNextHopGroups = selectChanged(m_options->m_nextHopGroups);
+    m_changedRoutes = selectChanged(m_options->m_routes);
+    m_changedAclEntries = selectChanged(m_options->m_aclEntries);
+}
+
+ViewBench::~ViewBench()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_vssai && m_objects[PASS_ASIC].switchId != SAI_NULL_OBJECT_ID)
+    {
+        m_vssai->remove(SAI_OBJECT_TYPE_SWITCH, m_objects[PASS_ASIC].switchId);
+    }
+}
+
+std::vector<bool> ViewBench::selectChanged(
+        _In_ size_t count)
+{
+    SWSS_LOG_ENTER();
+
+    std::bernoulli_distribution distribution(m_options->m_changedFraction);
+
+    std::vector<bool> changed(count);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        changed[idx] = distribution(m_generator);
+    }
+
+    return changed;
+}
+
+void ViewBench::createSwitch()
+{
+    SWSS_LOG_ENTER();
+
+    auto ccc = saivs::ContextConfigContainer::getDefault();
+
+    auto cc = ccc->get(0);
+
+    auto sc = cc->m_scc->getConfig(0);
+
+    sc->m_saiSwitchType = SAI_SWITCH_TYPE_NPU;
+    sc->m_switchType = saivs::SAI_VS_SWITCH_TYPE_BCM56850;
+    sc->m_bootType = saivs::SAI_VS_BOOT_TYPE_COLD;
+    sc->m_useTapDevice = false;
+    sc->m_laneMap = saivs::LaneMap::getDefaultLaneMap();
+    sc->m_eventQueue = std::make_shared<saivs::EventQueue>(std::make_shared<saivs::Signal>());
+
+    m_vssai = std::make_shared<saivs::VirtualSwitchSaiInterface>(cc);
+
+    auto& asic = m_objects[PASS_ASIC];
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    sai_status_t status = m_vssai->create(SAI_OBJECT_TYPE_SWITCH, &asic.switchId, SAI_NULL_OBJECT_ID, 1, &attr);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to create switch: %s", sai_serialize_status(status).c_str());
+    }
+
+    std::vector<sai_object_id_t> ports(MAX_PORTS);
+
+    sai_attribute_t attrs[4];
+
+    attrs[0].id = SAI_SWITCH_ATTR_PORT_LIST;
+    attrs[0].value.objlist.count = MAX_PORTS;
+    attrs[0].value.objlist.list = ports.data();
+
+    attrs[1].id = SAI_SWITCH_ATTR_CPU_PORT;
+    attrs[2].id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+    attrs[3].id = SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP;
+
+    status = m_vssai->get(SAI_OBJECT_TYPE_SWITCH, asic.switchId, 4, attrs);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to query switch discovered objects: %s", sai_serialize_status(status).c_str());
+    }
+
+    ports.resize(attrs[0].value.objlist.count);
+
+    asic.ports = ports;
+    asic.cpuPort = attrs[1].value.oid;
+    asic.virtualRouter = attrs[2].value.oid;
+    asic.trapGroup = attrs[3].value.oid;
+
+    SWSS_LOG_NOTICE("created switch %s with %zu ports",
+            sai_serialize_object_id(asic.switchId).c_str(),
+            asic.ports.size());
+}
+
+void ViewBench::allocateDiscoveredVids()
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Discovered objects have the same VIDs in both views, like they would
+     * have after warm boot.
+     */
+
+    auto& asic = m_objects[PASS_ASIC];
+    auto& cur = m_objects[PASS_CURRENT];
+
+    cur.switchId = m_vidManager->allocateNewSwitchObjectId("");
+    cur.cpuPort = m_vidManager->allocateNewObjectId(SAI_OBJECT_TYPE_PORT, cur.switchId);
+    cur.virtualRouter = m_vidManager->allocateNewObjectId(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, cur.switchId);
+    cur.trapGroup = m_vidManager->allocateNewObjectId(SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP, cur.switchId);
+
+    for (size_t idx = 0; idx < asic.ports.size(); idx++)
+    {
+        cur.ports.push_back(m_vidManager->allocateNewObjectId(SAI_OBJECT_TYPE_PORT, cur.switchId));
+    }
+
+    mapVidsToRids({ cur.switchId, cur.cpuPort, cur.virtualRouter, cur.trapGroup },
+            { asic.switchId, asic.cpuPort, asic.virtualRouter, asic.trapGroup });
+
+    mapVidsToRids(cur.ports, asic.ports);
+
+    for (auto& v2r: m_vid2rid)
+    {
+        m_discoveredVids.insert(v2r.first);
+    }
+
+    auto& tmp = m_objects[PASS_TEMPORARY];
+
+    tmp.switchId = cur.switchId;
+    tmp.cpuPort = cur.cpuPort;
+    tmp.virtualRouter = cur.virtualRouter;
+    tmp.trapGroup = cur.trapGroup;
+    tmp.ports = cur.ports;
+}
+
+void ViewBench::mapVidsToRids(
+        _In_ const std::vector<sai_object_id_t>& vids,
+        _In_ const std::vector<sai_object_id_t>& rids)
+{
+    SWSS_LOG_ENTER();
+
+    if (vids.size() != rids.size())
+    {
+        SWSS_LOG_THROW("vids count %zu differs from rids count %zu", vids.size(), rids.size());
+    }
+
+    for (size_t idx = 0; idx < vids.size(); idx++)
+    {
+        m_vid2rid[vids[idx]] = rids[idx];
+    }
+}
+
+sai_object_id_t ViewBench::createObject(
+        _In_ Pass pass,
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<sai_attribute_t>& attrs)
+{
+    SWSS_LOG_ENTER();
+
+    auto switchId = m_objects[pass].switchId;
+
+    if (pass == PASS_ASIC)
+    {
+        sai_object_id_t rid;
+
+        sai_status_t status = m_vssai->create(objectType, &rid, switchId, (uint32_t)attrs.size(), attrs.data());
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_THROW("failed to create %s: %s",
+                    sai_serialize_object_type(objectType).c_str(),
+                    sai_serialize_status(status).c_str());
+        }
+
+        return rid;
+    }
+
+    sai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = objectType;
+    metaKey.objectkey.key.object_id = m_vidManager->allocateNewObjectId(objectType, switchId);
+
+    addToDump(pass, metaKey, attrs);
+
+    return metaKey.objectkey.key.object_id;
+}
+
+void ViewBench::createEntry(
+        _In_ Pass pass,
+        _In_ sai_object_meta_key_t& metaKey,
+        _In_ const std::vector<sai_attribute_t>& attrs)
+{
+    SWSS_LOG_ENTER();
+
+    if (pass != PASS_ASIC)
+    {
+        addToDump(pass, metaKey, attrs);
+        return;
+    }
+
+    sai_status_t status = m_vssai->create(metaKey, m_objects[pass].switchId, (uint32_t)attrs.size(), attrs.data());
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to create %s: %s",
+                sai_serialize_object_meta_key(metaKey).c_str(),
+                sai_serialize_status(status).c_str());
+    }
+}
+
+void ViewBench::addToDump(
+        _In_ Pass pass,
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const std::vector<sai_attribute_t>& attrs)
+{
+    SWSS_LOG_ENTER();
+
+    auto& map = m_dump[pass][sai_serialize_object_meta_key(metaKey)];
+
+    for (auto& attr: attrs)
+    {
+        auto meta = sai_metadata_get_attr_metadata(metaKey.objecttype, attr.id);
+
+        if (meta == nullptr)
+        {
+            SWSS_LOG_THROW("failed to get metadata for %s attr %d",
+                    sai_serialize_object_type(metaKey.objecttype).c_str(),
+                    attr.id);
+        }
+
+        map[meta->attridname] = sai_serialize_attr_value(*meta, attr);
+    }
+}
+
+void ViewBench::addDiscoveredToDump(
+        _In_ Pass pass)
+{
+    SWSS_LOG_ENTER();
+
+    auto& o = m_objects[pass];
+
+    sai_object_meta_key_t metaKey;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_SWITCH;
+    metaKey.objectkey.key.object_id = o.switchId;
+
+    addToDump(pass, metaKey, { attr });
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER;
+    metaKey.objectkey.key.object_id = o.virtualRouter;
+
+    addToDump(pass, metaKey, {});
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP;
+    metaKey.objectkey.key.object_id = o.trapGroup;
+
+    addToDump(pass, metaKey, {});
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_PORT;
+    metaKey.objectkey.key.object_id = o.cpuPort;
+
+    addToDump(pass, metaKey, {});
+
+    for (auto port: o.ports)
+    {
+        metaKey.objectkey.key.object_id = port;
+
+        addToDump(pass, metaKey, {});
+    }
+}
+
+void ViewBench::populate(
+        _In_ Pass pass)
+{
+    SWSS_LOG_ENTER();
+
+    auto& o = m_objects[pass];
+
+    const bool temp = (pass == PASS_TEMPORARY);
+
+    if (pass != PASS_ASIC)
+    {
+        addDiscoveredToDump(pass);
+    }
+
+    sai_attribute_t attr;
+
+    std::vector<sai_attribute_t> attrs;
+
+    sai_object_meta_key_t metaKey;
+
+    memset(&metaKey, 0, sizeof(metaKey));
+
+    // router interfaces, one per port
+
+    for (auto port: o.ports)
+    {
+        attrs.clear();
+
+        attr.id = SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID;
+        attr.value.oid = o.virtualRouter;
+        attrs.push_back(attr);
+
+        attr.id = SAI_ROUTER_INTERFACE_ATTR_TYPE;
+        attr.value.s32 = SAI_ROUTER_INTERFACE_TYPE_PORT;
+        attrs.push_back(attr);
+
+        attr.id = SAI_ROUTER_INTERFACE_ATTR_PORT_ID;
+        attr.value.oid = port;
+        attrs.push_back(attr);
+
+        o.routerInterfaces.push_back(createObject(pass, SAI_OBJECT_TYPE_ROUTER_INTERFACE, attrs));
+    }
+
+    if (o.routerInterfaces.empty() && m_options->m_neighbors)
+    {
+        SWSS_LOG_THROW("no ports discovered, can't create router interfaces");
+    }
+
+    // neighbors and next hops, one next hop per neighbor
+
+    for (uint32_t idx = 0; idx < m_options->m_neighbors; idx++)
+    {
+        sai_ip_address_t ip;
+
+        ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        ip.addr.ip4 = htonl(NEIGHBOR_IP_BASE + idx);
+
+        auto rif = o.routerInterfaces[idx % o.routerInterfaces.size()];
+
+        metaKey.objecttype = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY;
+        metaKey.objectkey.key.neighbor_entry.switch_id = o.switchId;
+        metaKey.objectkey.key.neighbor_entry.rif_id = rif;
+        metaKey.objectkey.key.neighbor_entry.ip_address = ip;
+
+        attrs.clear();
+
+        attr.id = SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS;
+        attr.value.mac[0] = 0x00;
+        attr.value.mac[1] = 0x01;
+        attr.value.mac[2] = (uint8_t)((temp && m_changedNeighbors[idx]) ? 0x02 : 0x01);
+        attr.value.mac[3] = (uint8_t)(idx >> 16);
+        attr.value.mac[4] = (uint8_t)(idx >> 8);
+        attr.value.mac[5] = (uint8_t)(idx);
+        attrs.push_back(attr);
+
+        createEntry(pass, metaKey, attrs);
+
+        attrs.clear();
+
+        attr.id = SAI_NEXT_HOP_ATTR_TYPE;
+        attr.value.s32 = SAI_NEXT_HOP_TYPE_IP;
+        attrs.push_back(attr);
+
+        attr.id = SAI_NEXT_HOP_ATTR_IP;
+        attr.value.ipaddr = ip;
+        attrs.push_back(attr);
+
+        attr.id = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+        attr.value.oid = rif;
+        attrs.push_back(attr);
+
+        o.nextHops.push_back(createObject(pass, SAI_OBJECT_TYPE_NEXT_HOP, attrs));
+    }
+
+    // next hop groups, first member of changed group points to other next hop
+
+    for (uint32_t idx = 0; idx < m_options->m_nextHopGroups; idx++)
+    {
+        attrs.clear();
+
+        attr.id = SAI_NEXT_HOP_GROUP_ATTR_TYPE;
+        attr.value.s32 = SAI_NEXT_HOP_GROUP_TYPE_ECMP;
+        attrs.push_back(attr);
+
+        auto nhg = createObject(pass, SAI_OBJECT_TYPE_NEXT_HOP_GROUP, attrs);
+
+        o.nextHopGroups.push_back(nhg);
+
+        for (uint32_t member = 0; member < m_options->m_nextHopGroupMembers; member++)
+        {
+            size_t nh = idx * m_options->m_nextHopGroupMembers + member;
+
+            if (temp && m_changedNextHopGroups[idx] && member == 0)
+            {
+                nh += m_options->m_nextHopGroupMembers;
+            }
+
+            attrs.clear();
+
+            attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
+            attr.value.oid = nhg;
+            attrs.push_back(attr);
+
+            attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+            attr.value.oid = o.nextHops[nh % o.nextHops.size()];
+            attrs.push_back(attr);
+
+            o.nextHopGroupMembers.push_back(createObject(pass, SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, attrs));
+        }
+    }
+
+    // routes, changed route points to next group or next hop
+
+    for (uint32_t idx = 0; idx < m_options->m_routes; idx++)
+    {
+        metaKey.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+        metaKey.objectkey.key.route_entry.switch_id = o.switchId;
+        metaKey.objectkey.key.route_entry.vr_id = o.virtualRouter;
+        metaKey.objectkey.key.route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        metaKey.objectkey.key.route_entry.destination.addr.ip4 = htonl(ROUTE_PREFIX_BASE + (idx << 8));
+        metaKey.objectkey.key.route_entry.destination.mask.ip4 = htonl(0xffffff00);
+
+        size_t target = idx + ((temp && m_changedRoutes[idx]) ? 1 : 0);
+
+        attrs.clear();
+
+        attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+        attr.value.oid = o.nextHopGroups.size()
+            ? o.nextHopGroups[target % o.nextHopGroups.size()]
+            : o.nextHops[target % o.nextHops.size()];
+        attrs.push_back(attr);
+
+        createEntry(pass, metaKey, attrs);
+    }
+
+    if (m_options->m_aclEntries == 0)
+    {
+        return;
+    }
+
+    // acl table with dst ip drop entries, changed entry has different priority
+
+    attrs.clear();
+
+    attr.id = SAI_ACL_TABLE_ATTR_ACL_STAGE;
+    attr.value.s32 = SAI_ACL_STAGE_INGRESS;
+    attrs.push_back(attr);
+
+    attr.id = SAI_ACL_TABLE_ATTR_FIELD_DST_IP;
+    attr.value.booldata = true;
+    attrs.push_back(attr);
+
+    o.aclTable = createObject(pass, SAI_OBJECT_TYPE_ACL_TABLE, attrs);
+
+    for (uint32_t idx = 0; idx < m_options->m_aclEntries; idx++)
+    {
+        attrs.clear();
+
+        attr.id = SAI_ACL_ENTRY_ATTR_TABLE_ID;
+        attr.value.oid = o.aclTable;
+        attrs.push_back(attr);
+
+        attr.id = SAI_ACL_ENTRY_ATTR_PRIORITY;
+        attr.value.u32 = 100 + idx + ((temp && m_changedAclEntries[idx]) ? m_options->m_aclEntries : 0);
+        attrs.push_back(attr);
+
+        attr.id = SAI_ACL_ENTRY_ATTR_FIELD_DST_IP;
+        attr.value.aclfield.enable = true;
+        attr.value.aclfield.data.ip4 = htonl(ACL_DST_IP_BASE + idx);
+        attr.value.aclfield.mask.ip4 = htonl(0xffffffff);
+        attrs.push_back(attr);
+
+        attr.id = SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION;
+        attr.value.aclaction.enable = true;
+        attr.value.aclaction.parameter.s32 = SAI_PACKET_ACTION_DROP;
+        attrs.push_back(attr);
+
+        o.aclEntries.push_back(createObject(pass, SAI_OBJECT_TYPE_ACL_ENTRY, attrs));
+    }
+}
+
+uint64_t ViewBench::getPeakRss()
+{
+    SWSS_LOG_ENTER();
+
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        SWSS_LOG_ERROR("getrusage failed: %s", strerror(errno));
+
+        return 0;
+    }
+
+    return (uint64_t)usage.ru_maxrss; // in kilobytes
+}
+
+std::string ViewBench::run()
+{
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    createSwitch();
+
+    allocateDiscoveredVids();
+
+    populate(PASS_ASIC);
+    populate(PASS_CURRENT);
+    populate(PASS_TEMPORARY);
+
+    auto& asic = m_objects[PASS_ASIC];
+    auto& cur = m_objects[PASS_CURRENT];
+
+    mapVidsToRids(cur.routerInterfaces, asic.routerInterfaces);
+    mapVidsToRids(cur.nextHops, asic.nextHops);
+    mapVidsToRids(cur.nextHopGroups, asic.nextHopGroups);
+    mapVidsToRids(cur.nextHopGroupMembers, asic.nextHopGroupMembers);
+    mapVidsToRids(cur.aclEntries, asic.aclEntries);
+
+    if (m_options->m_aclEntries)
+    {
+        mapVidsToRids({ cur.aclTable }, { asic.aclTable });
+    }
+
+    auto current = std::make_shared<syncd::AsicView>(m_dump[PASS_CURRENT]);
+    auto temporary = std::make_shared<syncd::AsicView>(m_dump[PASS_TEMPORARY]);
+
+    std::map<sai_attr_id_t, sai_object_id_t> defaultRidMap;
+
+    defaultRidMap[SAI_SWITCH_ATTR_CPU_PORT] = asic.cpuPort;
+    defaultRidMap[SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID] = asic.virtualRouter;
+    defaultRidMap[SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP] = asic.trapGroup;
+
+    auto sw = std::make_shared<BenchSwitch>(
+            cur.switchId,
+            asic.switchId,
+            m_vid2rid,
+            defaultRidMap,
+            m_discoveredVids);
+
+    auto setupUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t setupPeakRss = getPeakRss();
+
+    json j;
+
+    j["scale"] = {
+        { "routes", m_options->m_routes },
+        { "neighbors", m_options->m_neighbors },
+        { "nextHopGroups", m_options->m_nextHopGroups },
+        { "nextHopGroupMembers", m_options->m_nextHopGroupMembers },
+        { "aclEntries", m_options->m_aclEntries },
+        { "changed", m_options->m_changedFraction },
+        { "seed", m_options->m_seed },
+        { "viewFingerprints", !m_options->m_disableViewFingerprints },
+    };
+
+    j["objects"] = {
+        { "current", current->m_soAll.size() },
+        { "temporary", temporary->m_soAll.size() },
+    };
+
+    SWSS_LOG_NOTICE("views created in %" PRId64 " us, current: %zu objects, temporary: %zu objects",
+            (int64_t)setupUs,
+            current->m_soAll.size(),
+            temporary->m_soAll.size());
+
+    start = std::chrono::steady_clock::now();
+
+    syncd::ComparisonLogic cl(
+            m_vssai,
+            sw,
+            nullptr, // handler
+            {}, // initViewRemovedVids
+            current,
+            temporary,
+            std::make_shared<syncd::BreakConfig>(),
+            !m_options->m_disableViewFingerprints);
+
+    cl.compareViews();
+
+    j["asicOperations"] = current->asicGetOperationsCount();
+
+    cl.executeOperationsOnAsic();
+
+    auto totalUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    json phases = json::array();
+
+    for (auto& phase: cl.getPhaseTimes())
+    {
+        phases.push_back({ { "phase", phase.first }, { "us", phase.second } });
+    }
+
+    j["phases"] = phases;
+    j["setupUs"] = setupUs;
+    j["totalUs"] = totalUs;
+    j["setupPeakRssKb"] = setupPeakRss;
+    j["peakRssKb"] = getPeakRss();
+
+    return j.dump(4);
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "CommandLineOptions.h"
+
+#include "meta/SaiInterface.h"
+#include "lib/VirtualObjectIdManager.h"
+
+#include "swss/table.h"
+
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace saiviewbench
+{
+    /**
+     * @brief Apply view benchmark.
+     *
+     * Creates synthetic set of router interfaces, neighbors, next hops, next
+     * hop groups, routes and ACL entries on virtual switch, then builds
+     * current view (VIDs of created objects) and temporary view (new VIDs,
+     * like after orchagent warm restart) where fraction of objects is
+     * modified. After that comparison logic is executed on those views and
+     * operations are applied on virtual switch.
+     */
+    class ViewBench
+    {
+        private:
+
+            ViewBench(const ViewBench&) = delete;
+            ViewBench& operator=(const ViewBench&) = delete;
+
+        public:
+
+            ViewBench(
+                    _In_ std::shared_ptr<CommandLineOptions> options);
+
+            virtual ~ViewBench();
+
+        public:
+
+            /**
+             * @brief Run benchmark.
+             *
+             * @return Benchmark results in json format.
+             */
+            std::string run();
+
+        private:
+
+            typedef enum _Pass
+            {
+                /**
+                 * @brief Objects are created on virtual switch, ids are RIDs.
+                 */
+                PASS_ASIC = 0,
+
+                /**
+                 * @brief Objects are put to current view, ids are VIDs.
+                 */
+                PASS_CURRENT,
+
+                /**
+                 * @brief Objects are put to temporary view, ids are new VIDs
+                 * and some objects are modified.
+                 */
+                PASS_TEMPORARY,
+
+                PASS_COUNT
+
+            } Pass;
+
+            typedef struct _PassObjects
+            {
+                sai_object_id_t switchId;
+
+                sai_object_id_t cpuPort;
+
+                sai_object_id_t virtualRouter;
+
+                sai_object_id_t trapGroup;
+
+                sai_object_id_t aclTable;
+
+                std::vector<sai_object_id_t> ports;
+
+                std::vector<sai_object_id_t> routerInterfaces;
+
+                std::vector<sai_object_id_t> nextHops;
+
+                std::vector<sai_object_id_t> nextHopGroups;
+
+                std::vector<sai_object_id_t> nextHopGroupMembers;
+
+                std::vector<sai_object_id_t> aclEntries;
+
+            } PassObjects;
+
+            void createSwitch();
+
+            void allocateDiscoveredVids();
+
+            std::vector<bool> selectChanged(
+                    _In_ size_t count);
+
+            void populate(
+                    _In_ Pass pass);
+
+            sai_object_id_t createObject(
+                    _In_ Pass pass,
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<sai_attribute_t>& attrs);
+
+            void createEntry(
+                    _In_ Pass pass,
+                    _In_ sai_object_meta_key_t& metaKey,
+                    _In_ const std::vector<sai_attribute_t>& attrs);
+
+            void addToDump(
+                    _In_ Pass pass,
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ const std::vector<sai_attribute_t>& attrs);
+
+            void addDiscoveredToDump(
+                    _In_ Pass pass);
+
+            void mapVidsToRids(
+                    _In_ const std::vector<sai_object_id_t>& vids,
+                    _In_ const std::vector<sai_object_id_t>& rids);
+
+            static uint64_t getPeakRss();
+
+        private:
+
+            std::shared_ptr<CommandLineOptions> m_options;
+
+            std::shared_ptr<sairedis::SaiInterface> m_vssai;
+
+            std::shared_ptr<sairedis::VirtualObjectIdManager> m_vidManager;
+
+            std::mt19937 m_generator;
+
+            PassObjects m_objects[PASS_COUNT];
+
+            swss::TableDump m_dump[PASS_COUNT];
+
+            std::unordered_map<sai_object_id_t, sai_object_id_t> m_vid2rid;
+
+            std::set<sai_object_id_t> m_discoveredVids;
+
+            std::vector<bool> m_changedNeighbors;
+
+            std::vector<bool> m_changedNextHopGroups;
+
+            std::vector<bool> m_changedRoutes;
+
+            std::vector<bool> m_changedAclEntries;
+    };
+}
@@ -0,0 +1,41 @@
+#include "CommandLineOptionsParser.h"
+#include "ViewBench.h"
+
+#include "swss/logger.h"
+
+#include <iostream>
+
+using namespace saiviewbench;
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
+
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    auto commandLineOptions = CommandLineOptionsParser::parseCommandLine(argc, argv);
+
+    SWSS_LOG_NOTICE("command line: %s",  commandLineOptions->getCommandLineString().c_str());
+
+    if (commandLineOptions->m_enableLogLevelInfo)
+    {
+        swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_INFO);
+    }
+
+    try
+    {
+        ViewBench bench(commandLineOptions);
+
+        std::cout << bench.run() << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "ERROR: benchmark failed: " << e.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
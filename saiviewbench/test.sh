@@ -0,0 +1,39 @@
+#!/bin/bash
+
+EXIT_VALUE=0
+
+function test_small_view()
+{
+    ./saiviewbench --routes 100 --neighbors 16 --nextHopGroups 4 --aclEntries 16 --changed 0.1 > /dev/null
+
+    if [ $? != 0 ]; then
+        echo "${FUNCNAME[0]} ERROR: expected benchmark to succeed"
+        EXIT_VALUE=1
+    fi
+}
+
+function test_no_changes()
+{
+    ./saiviewbench --routes 100 --neighbors 16 --nextHopGroups 4 --aclEntries 16 --changed 0 > /dev/null
+
+    if [ $? != 0 ]; then
+        echo "${FUNCNAME[0]} ERROR: expected benchmark to succeed"
+        EXIT_VALUE=1
+    fi
+}
+
+function test_no_view_fingerprints()
+{
+    ./saiviewbench --routes 100 --neighbors 16 --nextHopGroups 4 --aclEntries 16 --changed 0.1 --disableViewFingerprints > /dev/null
+
+    if [ $? != 0 ]; then
+        echo "${FUNCNAME[0]} ERROR: expected benchmark to succeed"
+        EXIT_VALUE=1
+    fi
+}
+
+test_small_view;
+test_no_changes;
+test_no_view_fingerprints;
+
+exit $EXIT_VALUE
@@ -0,0 +1,377 @@
+#include "AsicViewFingerprint.h"
+
+#include "swss/logger.h"
+
+#include "meta/sai_serialize.h"
+
+#include <inttypes.h>
+
+#include <cstring>
+#include <algorithm>
+#include <functional>
+
+using namespace syncd;
+
+#define OID_PREFIX "oid:0x"
+
+AsicViewFingerprint::AsicViewFingerprint(
+        _In_ const AsicView& view,
+        _In_ const AsicView::ObjectIdMap& matchedVidToRid):
+    m_view(view),
+    m_matchedVidToRid(matchedVidToRid)
+{
+    SWSS_LOG_ENTER();
+
+    compute();
+}
+
+void AsicViewFingerprint::compute()
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& kvp: m_view.m_soAll)
+    {
+        computeObject(*kvp.second);
+    }
+
+    /*
+     * Not matched OID objects are identified only by content hash, if there
+     * are more objects with the same content hash in view, then we can't tell
+     * which one is referenced by other objects, so mark them as ambiguous.
+     */
+
+    std::unordered_map<uint64_t, const SaiObj*> unmatched;
+
+    for (auto& kvp: m_entries)
+    {
+        const SaiObj* obj = kvp.first;
+
+        if (!obj->isOidObject() || m_matchedVidToRid.find(obj->getVid()) != m_matchedVidToRid.end())
+        {
+            continue;
+        }
+
+        auto it = unmatched.find(kvp.second.hash);
+
+        if (it == unmatched.end())
+        {
+            unmatched[kvp.second.hash] = obj;
+            continue;
+        }
+
+        kvp.second.ambiguous = true;
+
+        m_entries.at(it->second).ambiguous = true;
+    }
+
+    std::unordered_map<const SaiObj*, int> state;
+
+    for (const auto& kvp: m_view.m_soAll)
+    {
+        resolve(*kvp.second, state);
+    }
+
+    for (const auto& kvp: m_view.m_soAll)
+    {
+        const auto& entry = m_entries.at(kvp.second.get());
+
+        auto ot = kvp.second->getObjectType();
+
+        auto it = m_typeFingerprints.find(ot);
+
+        if (it == m_typeFingerprints.end())
+        {
+            it = m_typeFingerprints.emplace(ot, TypeFingerprint{0, 0, 0, true}).first;
+        }
+
+        auto& fp = it->second;
+
+        fp.count++;
+        fp.sum += entry.hash;
+        fp.xor_ ^= entry.hash;
+        fp.resolved = fp.resolved && entry.resolved;
+    }
+}
+
+AsicViewFingerprint::Entry& AsicViewFingerprint::computeObject(
+        _In_ const SaiObj& obj)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(&obj);
+
+    if (it != m_entries.end())
+    {
+        return it->second;
+    }
+
+    /*
+     * References to unordered map elements are not invalidated by rehash, so
+     * we can safely keep this reference while recursing to other objects.
+     */
+
+    Entry& entry = m_entries[&obj];
+
+    entry.hash = 0;
+    entry.inProgress = true;
+    entry.ambiguous = false;
+    entry.resolved = false;
+
+    entry.hash = std::hash<std::string>()(buildCanonicalString(obj, &entry));
+
+    entry.inProgress = false;
+
+    return entry;
+}
+
+std::string AsicViewFingerprint::buildCanonicalString(
+        _In_ const SaiObj& obj,
+        _Inout_ Entry* entry)
+{
+    SWSS_LOG_ENTER();
+
+    auto ot = obj.getObjectType();
+
+    std::string str = obj.m_str_object_type;
+
+    str += "|";
+
+    if (obj.isOidObject())
+    {
+        /*
+         * Matched objects are identified by RID, not matched objects are
+         * identified only by their content.
+         */
+
+        auto it = m_matchedVidToRid.find(obj.getVid());
+
+        if (it != m_matchedVidToRid.end())
+        {
+            str += "rid:" + sai_serialize_object_id(it->second);
+        }
+    }
+    else
+    {
+        str += canonicalize(obj.m_str_object_id, entry, ot);
+    }
+
+    std::vector<std::pair<sai_attr_id_t, std::shared_ptr<SaiAttr>>> attrs(
+            obj.getAllAttributes().begin(),
+            obj.getAllAttributes().end());
+
+    std::sort(attrs.begin(), attrs.end(),
+            [](const std::pair<sai_attr_id_t, std::shared_ptr<SaiAttr>>& a,
+               const std::pair<sai_attr_id_t, std::shared_ptr<SaiAttr>>& b) { return a.first < b.first; });
+
+    for (const auto& attr: attrs)
+    {
+        str += "|";
+        str += attr.second->getStrAttrId();
+        str += "=";
+
+        if (attr.second->isObjectIdAttr())
+        {
+            str += canonicalize(attr.second->getStrAttrValue(), entry, ot);
+        }
+        else
+        {
+            str += attr.second->getStrAttrValue();
+        }
+    }
+
+    return str;
+}
+
+std::string AsicViewFingerprint::canonicalize(
+        _In_ const std::string& str,
+        _Inout_ Entry* entry,
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    std::string out;
+
+    size_t pos = 0;
+
+    while (true)
+    {
+        size_t start = str.find(OID_PREFIX, pos);
+
+        if (start == std::string::npos)
+        {
+            out.append(str, pos, std::string::npos);
+            break;
+        }
+
+        size_t end = start + strlen(OID_PREFIX);
+
+        while (end < str.size() && isxdigit(str[end]))
+        {
+            end++;
+        }
+
+        out.append(str, pos, start - pos);
+
+        pos = end;
+
+        sai_object_id_t vid = (sai_object_id_t)strtoull(str.c_str() + start + strlen(OID_PREFIX), NULL, 16);
+
+        if (vid == SAI_NULL_OBJECT_ID)
+        {
+            out.append(str, start, end - start);
+            continue;
+        }
+
+        auto mit = m_matchedVidToRid.find(vid);
+
+        if (mit != m_matchedVidToRid.end())
+        {
+            out += "rid:" + sai_serialize_object_id(mit->second);
+            continue;
+        }
+
+        auto oit = m_view.m_oOids.find(vid);
+
+        if (oit == m_view.m_oOids.end())
+        {
+            SWSS_LOG_INFO("VID %s not found in view, can't canonicalize", sai_serialize_object_id(vid).c_str());
+
+            entry->ambiguous = true;
+
+            out.append(str, start, end - start);
+            continue;
+        }
+
+        const SaiObj* ref = oit->second.get();
+
+        m_referencedTypes[objectType].insert(ref->getObjectType());
+
+        entry->refs.push_back(ref);
+
+        Entry& refEntry = computeObject(*ref);
+
+        if (refEntry.inProgress)
+        {
+            // reference cycle, object content can't be used as identity
+
+            entry->ambiguous = true;
+
+            out.append(str, start, end - start);
+            continue;
+        }
+
+        char buf[32];
+
+        snprintf(buf, sizeof(buf), "hash:0x%016" PRIx64, (uint64_t)refEntry.hash);
+
+        out += buf;
+    }
+
+    return out;
+}
+
+bool AsicViewFingerprint::resolve(
+        _In_ const SaiObj& obj,
+        _Inout_ std::unordered_map<const SaiObj*, int>& state)
+{
+    SWSS_LOG_ENTER();
+
+    auto& entry = m_entries.at(&obj);
+
+    int& s = state[&obj];
+
+    if (s == 2)
+    {
+        return entry.resolved;
+    }
+
+    if (s == 1)
+    {
+        // cycle, already marked as ambiguous during compute
+
+        return false;
+    }
+
+    s = 1;
+
+    bool resolved = !entry.ambiguous;
+
+    for (auto* ref: entry.refs)
+    {
+        resolved = resolve(*ref, state) && resolved;
+    }
+
+    entry.resolved = resolved;
+
+    state[&obj] = 2;
+
+    return resolved;
+}
+
+AsicViewFingerprint::TypeFingerprint AsicViewFingerprint::getTypeFingerprint(
+        _In_ sai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_typeFingerprints.find(objectType);
+
+    if (it == m_typeFingerprints.end())
+    {
+        return TypeFingerprint{0, 0, 0, true};
+    }
+
+    return it->second;
+}
+
+const std::set<sai_object_type_t>& AsicViewFingerprint::getReferencedObjectTypes(
+        _In_ sai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    static const std::set<sai_object_type_t> empty;
+
+    auto it = m_referencedTypes.find(objectType);
+
+    if (it == m_referencedTypes.end())
+    {
+        return empty;
+    }
+
+    return it->second;
+}
+
+uint64_t AsicViewFingerprint::getObjectHash(
+        _In_ const std::shared_ptr<const SaiObj>& obj) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.at(obj.get()).hash;
+}
+
+bool AsicViewFingerprint::isResolved(
+        _In_ const std::shared_ptr<const SaiObj>& obj) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.at(obj.get()).resolved;
+}
+
+std::string AsicViewFingerprint::getCanonicalString(
+        _In_ const std::shared_ptr<const SaiObj>& obj)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * All referenced objects are already computed, so this will not modify
+     * any existing entry, only use their hashes.
+     */
+
+    Entry entry;
+
+    entry.hash = 0;
+    entry.inProgress = false;
+    entry.ambiguous = false;
+    entry.resolved = false;
+
+    return buildCanonicalString(*obj, &entry);
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "AsicView.h"
+
+#include <string>
+#include <memory>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Order independent fingerprint of ASIC view.
+     *
+     * Each object in view is converted to canonical string, where every VID
+     * present in object key or attribute value is replaced by canonical token.
+     * For VIDs matched between current and temporary view this token is RID,
+     * and for not matched VIDs this token is content hash of referenced object
+     * (Merkle style), so identical objects in both views will produce identical
+     * canonical strings even if their VIDs are different.
+     *
+     * Object type fingerprint is then computed as order independent
+     * combination of all object hashes of given type.
+     */
+    class AsicViewFingerprint
+    {
+        private:
+
+            AsicViewFingerprint(const AsicViewFingerprint&) = delete;
+            AsicViewFingerprint& operator=(const AsicViewFingerprint&) = delete;
+
+        public:
+
+            typedef struct _TypeFingerprint
+            {
+                size_t count;
+
+                uint64_t sum;
+
+                uint64_t xor_;
+
+                /**
+                 * @brief Tells whether all objects of this type have
+                 * canonical form without ambiguity.
+                 */
+                bool resolved;
+
+                bool operator==(
+                        _In_ const struct _TypeFingerprint& other) const
+                {
+                    return count == other.count && sum == other.sum && xor_ == other.xor_;
+                }
+
+            } TypeFingerprint;
+
+        public:
+
+            /**
+             * @brief Constructor.
+             *
+             * @param[in] view View to be fingerprinted.
+             * @param[in] matchedVidToRid Map of VIDs matched between views,
+             * this should be temporary view VID to RID map right after
+             * matching OIDs.
+             */
+            AsicViewFingerprint(
+                    _In_ const AsicView& view,
+                    _In_ const AsicView::ObjectIdMap& matchedVidToRid);
+
+            virtual ~AsicViewFingerprint() = default;
+
+        public:
+
+            TypeFingerprint getTypeFingerprint(
+                    _In_ sai_object_type_t objectType) const;
+
+            /**
+             * @brief Get object types of not matched objects referenced by
+             * objects of given type.
+             */
+            const std::set<sai_object_type_t>& getReferencedObjectTypes(
+                    _In_ sai_object_type_t objectType) const;
+
+            uint64_t getObjectHash(
+                    _In_ const std::shared_ptr<const SaiObj>& obj) const;
+
+            bool isResolved(
+                    _In_ const std::shared_ptr<const SaiObj>& obj) const;
+
+            std::string getCanonicalString(
+                    _In_ const std::shared_ptr<const SaiObj>& obj);
+
+        private:
+
+            typedef struct _Entry
+            {
+                uint64_t hash;
+
+                bool inProgress;
+
+                bool ambiguous;
+
+                bool resolved;
+
+                std::vector<const SaiObj*> refs;
+
+            } Entry;
+
+            void compute();
+
+            Entry& computeObject(
+                    _In_ const SaiObj& obj);
+
+            std::string buildCanonicalString(
+                    _In_ const SaiObj& obj,
+                    _Inout_ Entry* entry);
+
+            std::string canonicalize(
+                    _In_ const std::string& str,
+                    _Inout_ Entry* entry,
+                    _In_ sai_object_type_t objectType);
+
+            bool resolve(
+                    _In_ const SaiObj& obj,
+                    _Inout_ std::unordered_map<const SaiObj*, int>& state);
+
+        private:
+
+            const AsicView& m_view;
+
+            const AsicView::ObjectIdMap& m_matchedVidToRid;
+
+            std::unordered_map<const SaiObj*, Entry> m_entries;
+
+            std::map<sai_object_type_t, TypeFingerprint> m_typeFingerprints;
+
+            std::map<sai_object_type_t, std::set<sai_object_type_t>> m_referencedTypes;
+    };
+}
@@ -36,6 +36,22 @@ CommandLineOptions::CommandLineOptions()
 
     m_watchdogWarnTimeSpan = 30 * 1000000;
 
+    m_apiLockPolicy = SAI_API_LOCK_POLICY_GLOBAL;
+
+    m_eventPipelineThreads = 0;
+
+    m_supportedCountersCache = "";
+
+    m_hwSku = "";
+
+    m_enableNotificationTrace = false;
+
+    m_notificationRingSize = 0;
+
+    m_fdbEventDedupWindow = 0;
+
+    m_disableViewFingerprints = false;
+
 #ifdef SAITHRIFT
 
     m_runRPCServer = false;
@@ -66,6 +82,14 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " ContextConfig=" << m_contextConfig;
     ss << " BreakConfig=" << m_breakConfig;
     ss << " WatchdogWarnTimeSpan=" << m_watchdogWarnTimeSpan;
+    ss << " ApiLockPolicy=" << VendorSaiLock::policyToString(m_apiLockPolicy);
+    ss << " EventPipelineThreads=" << m_eventPipelineThreads;
+    ss << " SupportedCountersCache=" << m_supportedCountersCache;
+    ss << " HwSku=" << m_hwSku;
+    ss << " EnableNotificationTrace=" << (m_enableNotificationTrace ? "YES" : "NO");
+    ss << " NotificationRingSize=" << m_notificationRingSize;
+    ss << " FdbEventDedupWindow=" << m_fdbEventDedupWindow;
+    ss << " DisableViewFingerprints=" << (m_disableViewFingerprints ? "YES" : "NO");
 
 #ifdef SAITHRIFT
 
@@ -2,6 +2,8 @@
 
 #include "sairedis.h"
 
+#include "VendorSaiLock.h"
+
 #include "swss/sal.h"
 
 #include <string>
@@ -86,6 +88,54 @@ namespace syncd
 
             int64_t m_watchdogWarnTimeSpan;
 
+            /**
+             * Vendor SAI api lock policy, allows counter polling threads to
+             * not block switch programming.
+             */
+            sai_api_lock_policy_t m_apiLockPolicy;
+
+            /**
+             * Number of threads decoding events ahead of execution, zero
+             * disables event pipeline.
+             */
+            uint32_t m_eventPipelineThreads;
+
+            /**
+             * File where supported counters discovered by flex counter are
+             * persisted across restarts, empty disables cache.
+             */
+            std::string m_supportedCountersCache;
+
+            /**
+             * HW SKU, part of supported counters cache key.
+             */
+            std::string m_hwSku;
+
+            /**
+             * When set to true notifications are traced from vendor callback
+             * to send and latencies are published to STATE_DB.
+             */
+            bool m_enableNotificationTrace;
+
+            /**
+             * Size (in KiB) of shared memory ring notifications are written
+             * to for local subscribers, 0 disables ring.
+             */
+            uint32_t m_notificationRingSize;
+
+            /**
+             * Window (in milliseconds) within which repeated FDB events are
+             * suppressed in vendor callback, 0 disables suppression.
+             */
+            uint32_t m_fdbEventDedupWindow;
+
+            /**
+             * When set to true comparison logic compares all object types
+             * one by one, even those with identical fingerprints on both
+             * views.
+             */
+            bool m_disableViewFingerprints;
+
 #ifdef SAITHRIFT
             bool m_runRPCServer;
             std::string m_portMapFile;
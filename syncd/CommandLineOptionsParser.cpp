@@ -19,9 +19,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     auto options = std::make_shared<CommandLineOptions>();
 
 #ifdef SAITHRIFT
-    const char* const optstring = "dp:t:g:x:b:w:uSUCsz:lrm:h";
+    const char* const optstring = "dp:t:g:x:b:w:L:P:k:H:uSUCsz:lTN:D:Vrm:h";
 #else
-    const char* const optstring = "dp:t:g:x:b:w:uSUCsz:lh";
+    const char* const optstring = "dp:t:g:x:b:w:L:P:k:H:uSUCsz:lTN:D:Vh";
 #endif // SAITHRIFT
 
     while (true)
@@ -42,6 +42,14 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "contextContig",           required_argument, 0, 'x' },
             { "breakConfig",             required_argument, 0, 'b' },
             { "watchdogWarnTimeSpan",    optional_argument, 0, 'w' },
+            { "apiLockPolicy",           required_argument, 0, 'L' },
+            { "eventPipelineThreads",    required_argument, 0, 'P' },
+            { "supportedCountersCache",  required_argument, 0, 'k' },
+            { "hwSku",                   required_argument, 0, 'H' },
+            { "enableNotificationTrace", no_argument,       0, 'T' },
+            { "notificationRingSize",    required_argument, 0, 'N' },
+            { "fdbEventDedupWindow",     required_argument, 0, 'D' },
+            { "disableViewFingerprints", no_argument,       0, 'V' },
 #ifdef SAITHRIFT
             { "rpcserver",               no_argument,       0, 'r' },
             { "portmap",                 required_argument, 0, 'm' },
@@ -124,6 +132,44 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_watchdogWarnTimeSpan = (int64_t)std::stoll(optarg);
                 break;
 
+            case 'L':
+                options->m_apiLockPolicy = VendorSaiLock::policyStringToPolicy(optarg);
+
+                if (options->m_apiLockPolicy == SAI_API_LOCK_POLICY_UNKNOWN)
+                {
+                    SWSS_LOG_ERROR("unknown api lock policy '%s'", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'P':
+                options->m_eventPipelineThreads = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'k':
+                options->m_supportedCountersCache = std::string(optarg);
+                break;
+
+            case 'H':
+                options->m_hwSku = std::string(optarg);
+                break;
+
+            case 'T':
+                options->m_enableNotificationTrace = true;
+                break;
+
+            case 'N':
+                options->m_notificationRingSize = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'D':
+                options->m_fdbEventDedupWindow = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'V':
+                options->m_disableViewFingerprints = true;
+                break;
+
 #ifdef SAITHRIFT
             case 'r':
                 options->m_runRPCServer = true;
@@ -156,9 +202,9 @@ void CommandLineOptionsParser::printUsage()
     SWSS_LOG_ENTER();
 
 #ifdef SAITHRIFT
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-r] [-m portmap] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-L policy] [-P threads] [-k file] [-H sku] [-T] [-N size] [-D window] [-V] [-r] [-m portmap] [-h]" << std::endl;
 #else
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-L policy] [-P threads] [-k file] [-H sku] [-T] [-N size] [-D window] [-V] [-h]" << std::endl;
 #endif // SAITHRIFT
 
     std::cout << "    -d --diag" << std::endl;
@@ -189,6 +235,22 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Comparison logic 'break before make' configuration file" << std::endl;
     std::cout << "    -w --watchdogWarnTimeSpan" << std::endl;
     std::cout << "        Watchdog time span (in microseconds) to watch for execution" << std::endl;
+    std::cout << "    -L --apiLockPolicy policy" << std::endl;
+    std::cout << "        Vendor SAI api lock policy (global|stats|rw|none), default: global" << std::endl;
+    std::cout << "    -P --eventPipelineThreads threads" << std::endl;
+    std::cout << "        Number of threads decoding events ahead of execution, 0 disables pipeline, default: 0" << std::endl;
+    std::cout << "    -k --supportedCountersCache file" << std::endl;
+    std::cout << "        File caching supported counters across restarts, default: disabled" << std::endl;
+    std::cout << "    -H --hwSku sku" << std::endl;
+    std::cout << "        HW SKU, part of supported counters cache key" << std::endl;
+    std::cout << "    -T --enableNotificationTrace" << std::endl;
+    std::cout << "        Trace latency of notifications, published to STATE_DB" << std::endl;
+    std::cout << "    -N --notificationRingSize size" << std::endl;
+    std::cout << "        Size (in KiB) of shared memory notification ring for local subscribers, 0 disables ring, default: 0" << std::endl;
+    std::cout << "    -D --fdbEventDedupWindow window" << std::endl;
+    std::cout << "        Suppress repeated FDB events within window (in milliseconds), 0 disables suppression, default: 0" << std::endl;
+    std::cout << "    -V --disableViewFingerprints" << std::endl;
+    std::cout << "        Disable skipping of identical object types in comparison logic" << std::endl;
 
 #ifdef SAITHRIFT
 
@@ -1,6 +1,7 @@
 #include "ComparisonLogic.h"
 #include "VidManager.h"
 #include "BestCandidateFinder.h"
+#include "AsicViewFingerprint.h"
 #include "NotificationHandler.h"
 #include "VirtualOidTranslator.h"
 #include "CommandLineOptions.h"
@@ -29,7 +30,8 @@ ComparisonLogic::ComparisonLogic(
         _In_ std::set<sai_object_id_t> initViewRemovedVids,
         _In_ std::shared_ptr<AsicView> current,
         _In_ std::shared_ptr<AsicView> temp,
-        _In_ std::shared_ptr<BreakConfig> breakConfig):
+        _In_ std::shared_ptr<BreakConfig> breakConfig,
+        _In_ bool enableViewFingerprints):
     m_vendorSai(vendorSai),
     m_switch(sw),
     m_initViewRemovedVids(initViewRemovedVids),
@@ -42,6 +44,8 @@ ComparisonLogic::ComparisonLogic(
 
     m_enableRefernceCountLogs = false;
 
+    m_enableViewFingerprints = enableViewFingerprints;
+
     // will inside filter only RID/VID to this particular switch
 
     // TODO move outside switch ? since later could be in different ASIC_DB
@@ -78,6 +82,26 @@ ComparisonLogic::~ComparisonLogic()
     // empty
 }
 
+const std::vector<std::pair<std::string, uint64_t>>& ComparisonLogic::getPhaseTimes() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_phaseTimes;
+}
+
+void ComparisonLogic::recordPhaseTime(
+        _In_ const std::string& phase,
+        _In_ const std::chrono::steady_clock::time_point& start)
+{
+    SWSS_LOG_ENTER();
+
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    SWSS_LOG_NOTICE("phase %s took %" PRIu64 " us", phase.c_str(), (uint64_t)us);
+
+    m_phaseTimes.emplace_back(phase, (uint64_t)us);
+}
+
 void ComparisonLogic::compareViews()
 {
     SWSS_LOG_ENTER();
@@ -90,8 +114,12 @@ void ComparisonLogic::compareViews()
      * matching oids RID and VID maps will be populated.
      */
 
+    auto start = std::chrono::steady_clock::now();
+
     matchOids(current, temp);
 
+    recordPhaseTime("matchOids", start);
+
     /*
      * Populate existing objects to current and temp view if they don't
      * exist since we are populating them when syncd starts, and when we
@@ -102,8 +130,12 @@ void ComparisonLogic::compareViews()
      * existing objects needs to be updated in the switch!
      */
 
+    start = std::chrono::steady_clock::now();
+
     populateExistingObjects(current, temp);
 
+    recordPhaseTime("populateExistingObjects", start);
+
     checkInternalObjects(current, temp);
 
     /*
@@ -116,12 +148,20 @@ void ComparisonLogic::compareViews()
         temp.dumpRef("temp START");
     }
 
+    start = std::chrono::steady_clock::now();
+
     createPreMatchMap(current, temp);
 
+    recordPhaseTime("createPreMatchMap", start);
+
     logViewObjectCount(current, temp);
 
+    start = std::chrono::steady_clock::now();
+
     applyViewTransition(current, temp);
 
+    recordPhaseTime("applyViewTransition", start);
+
     transferNotProcessed(current, temp);
 
     // TODO have a method to check for not processed objects
@@ -3066,6 +3106,11 @@ void ComparisonLogic::applyViewTransition(
 
     checkMatchedPorts(temp);
 
+    if (m_enableViewFingerprints)
+    {
+        finalizeIdenticalObjectTypes(current, temp);
+    }
+
     /*
      * Process all objects
      */
@@ -3255,6 +3300,172 @@ void ComparisonLogic::applyViewTransition(
      */
 }
 
+/**
+ * @brief Finalize object types which are identical on both views.
+ *
+ * On most warm boots temporary view is identical to current view for the
+ * majority of object types. For each object type we compare order independent
+ * fingerprints of both views (with VIDs canonicalized through RID mapping or
+ * referenced object content) and if they are equal, we pair objects and move
+ * them in bulk to FINAL state, so view transition will skip them.
+ *
+ * Object type can be finalized only when all not matched object types
+ * referenced by it are also finalized, otherwise view transition could match
+ * referenced temporary object to different current object than the one we
+ * assumed when pairing objects by content.
+ *
+ * @param current Current view.
+ * @param temp Temporary view.
+ */
+void ComparisonLogic::finalizeIdenticalObjectTypes(
+        _In_ AsicView& current,
+        _In_ AsicView& temp)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("view fingerprints");
+
+    /*
+     * At this point temporary view VID to RID map contains only matched
+     * objects, and will be modified when finalizing objects, that's why we
+     * need to make a copy of it.
+     */
+
+    AsicView::ObjectIdMap matchedVidToRid = temp.m_vidToRid;
+
+    AsicViewFingerprint cfp(current, matchedVidToRid);
+    AsicViewFingerprint tfp(temp, matchedVidToRid);
+
+    // pairs of current and temporary objects
+
+    typedef std::vector<std::pair<std::shared_ptr<SaiObj>, std::shared_ptr<SaiObj>>> ObjectPairs;
+
+    std::map<sai_object_type_t, ObjectPairs> identical;
+
+    for (int i = SAI_OBJECT_TYPE_NULL + 1; i < SAI_OBJECT_TYPE_EXTENSIONS_MAX; i++)
+    {
+        sai_object_type_t ot = (sai_object_type_t)i;
+
+        auto cf = cfp.getTypeFingerprint(ot);
+        auto tf = tfp.getTypeFingerprint(ot);
+
+        if (tf.count == 0 || !cf.resolved || !tf.resolved || !(cf == tf))
+        {
+            continue;
+        }
+
+        std::unordered_map<uint64_t, std::shared_ptr<SaiObj>> currentByHash;
+
+        bool paired = true;
+
+        for (const auto& cobj: current.getObjectsByObjectType(ot))
+        {
+            paired = paired && currentByHash.emplace(cfp.getObjectHash(cobj), cobj).second;
+        }
+
+        ObjectPairs pairs;
+
+        for (const auto& tobj: temp.getObjectsByObjectType(ot))
+        {
+            if (!paired)
+            {
+                break;
+            }
+
+            auto it = currentByHash.find(tfp.getObjectHash(tobj));
+
+            if (it == currentByHash.end())
+            {
+                paired = false;
+                break;
+            }
+
+            const auto& cobj = it->second;
+
+            auto status = tobj->getObjectStatus();
+
+            paired = (status == cobj->getObjectStatus()) &&
+                (status == SAI_OBJECT_STATUS_MATCHED || status == SAI_OBJECT_STATUS_NOT_PROCESSED) &&
+                (cfp.getCanonicalString(cobj) == tfp.getCanonicalString(tobj));
+
+            pairs.emplace_back(cobj, tobj);
+        }
+
+        if (!paired)
+        {
+            SWSS_LOG_INFO("object type %s has identical fingerprint, but objects can't be paired",
+                    sai_serialize_object_type(ot).c_str());
+            continue;
+        }
+
+        identical[ot] = std::move(pairs);
+    }
+
+    for (bool changed = true; changed; )
+    {
+        changed = false;
+
+        for (auto it = identical.begin(); it != identical.end(); )
+        {
+            bool referencesFinal = true;
+
+            for (auto rot: cfp.getReferencedObjectTypes(it->first))
+            {
+                referencesFinal = referencesFinal && (identical.find(rot) != identical.end());
+            }
+
+            for (auto rot: tfp.getReferencedObjectTypes(it->first))
+            {
+                referencesFinal = referencesFinal && (identical.find(rot) != identical.end());
+            }
+
+            if (referencesFinal)
+            {
+                it++;
+                continue;
+            }
+
+            SWSS_LOG_INFO("object type %s has identical fingerprint, but references not identical object types",
+                    sai_serialize_object_type(it->first).c_str());
+
+            it = identical.erase(it);
+
+            changed = true;
+        }
+    }
+
+    size_t count = 0;
+
+    for (const auto& kvp: identical)
+    {
+        for (const auto& p: kvp.second)
+        {
+            const auto& cobj = p.first;
+            const auto& tobj = p.second;
+
+            if (tobj->isOidObject() && tobj->getObjectStatus() != SAI_OBJECT_STATUS_MATCHED)
+            {
+                /*
+                 * Same as in processObjectForViewTransition, temporary VID
+                 * needs to be present in current view reference map.
+                 */
+
+                current.insertNewVidReference(tobj->getVid());
+            }
+
+            updateObjectStatus(current, temp, cobj, tobj);
+        }
+
+        count += kvp.second.size();
+
+        SWSS_LOG_INFO("object type %s is identical on both views, moved %zu objects to FINAL",
+                sai_serialize_object_type(kvp.first).c_str(),
+                kvp.second.size());
+    }
+
+    SWSS_LOG_NOTICE("%zu object types are identical on both views, moved %zu objects to FINAL", identical.size(), count);
+}
+
 void ComparisonLogic::logViewObjectCount(
         _In_ const AsicView &currentView,
         _In_ const AsicView &temporaryView)
@@ -3764,6 +3975,8 @@ void ComparisonLogic::executeOperationsOnAsic()
 
     SWSS_LOG_NOTICE("operations to execute on ASIC: %zu", currentView.asicGetOperationsCount());
 
+    auto start = std::chrono::steady_clock::now();
+
     try
     {
         //swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_INFO);
@@ -3850,6 +4063,8 @@ void ComparisonLogic::executeOperationsOnAsic()
         throw;
     }
 
+    recordPhaseTime("executeOperationsOnAsic", start);
+
     SWSS_LOG_NOTICE("performed all operations on asic successfully");
 }
 
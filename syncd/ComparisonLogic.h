@@ -12,6 +12,8 @@ extern "C"{
 #include "BreakConfig.h"
 
 #include <set>
+#include <chrono>
+#include <vector>
 
 namespace syncd
 {
@@ -26,7 +28,8 @@ namespace syncd
                 _In_ std::set<sai_object_id_t> initViewRemovedVids,
                 _In_ std::shared_ptr<AsicView> current,
                 _In_ std::shared_ptr<AsicView> temp,
-                _In_ std::shared_ptr<BreakConfig> breakConfig);
+                _In_ std::shared_ptr<BreakConfig> breakConfig,
+                _In_ bool enableViewFingerprints);
 
             virtual ~ComparisonLogic();;
 
@@ -40,8 +43,20 @@ namespace syncd
 
             void compareViews();
 
+            /**
+             * @brief Gets wall time of comparison logic phases.
+             *
+             * @return Phase names with time in microseconds, in order of
+             * execution.
+             */
+            const std::vector<std::pair<std::string, uint64_t>>& getPhaseTimes() const;
+
         private:
 
+            void recordPhaseTime(
+                    _In_ const std::string& phase,
+                    _In_ const std::chrono::steady_clock::time_point& start);
+
             void matchOids(
                     _In_ AsicView& currentView,
                     _In_ AsicView& temporaryView);
@@ -58,6 +73,10 @@ namespace syncd
                     _In_ AsicView& current,
                     _In_ AsicView& temp);
 
+            void finalizeIdenticalObjectTypes(
+                    _In_ AsicView& current,
+                    _In_ AsicView& temp);
+
             void transferNotProcessed(
                     _In_ AsicView& current,
                     _In_ AsicView& temp);
@@ -241,6 +260,15 @@ namespace syncd
              */
             bool m_enableRefernceCountLogs;
 
+            /**
+             * @brief Enable view fingerprints.
+             *
+             * When set to true, object types which have identical fingerprint
+             * on both views will be moved to FINAL state in bulk before view
+             * transition, since no ASIC operations are needed for them.
+             */
+            bool m_enableViewFingerprints;
+
             std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
 
             std::shared_ptr<SaiSwitchInterface> m_switch;
@@ -254,5 +282,7 @@ namespace syncd
             std::shared_ptr<NotificationHandler> m_handler;
 
             std::shared_ptr<BreakConfig> m_breakConfig;
+
+            std::vector<std::pair<std::string, uint64_t>> m_phaseTimes;
     };
 }
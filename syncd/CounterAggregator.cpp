@@ -0,0 +1,147 @@
+#include "CounterAggregator.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace syncd;
+
+CounterAggregator::CounterAggregator(
+        _In_ Function function,
+        _In_ uint32_t window):
+    m_function(function),
+    m_window(window),
+    m_windowStart(std::chrono::steady_clock::now())
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void CounterAggregator::update(
+        _In_ sai_object_id_t vid,
+        _In_ uint32_t count,
+        _In_ const sai_stat_id_t* statIds,
+        _In_ const uint64_t* values)
+{
+    SWSS_LOG_ENTER();
+
+    auto& window = m_windows[vid];
+
+    if (window.samples == 0 ||
+            window.statIds.size() != count ||
+            !std::equal(window.statIds.begin(), window.statIds.end(), statIds))
+    {
+        window.statIds.assign(statIds, statIds + count);
+        window.values.assign(values, values + count);
+        window.samples = 1;
+
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto& value = window.values[i];
+
+        switch (m_function)
+        {
+            case FUNCTION_MAX:
+                value = std::max(value, values[i]);
+                break;
+
+            case FUNCTION_MIN:
+                value = std::min(value, values[i]);
+                break;
+
+            case FUNCTION_SUM:
+                value += values[i];
+                break;
+
+            case FUNCTION_LAST:
+                value = values[i];
+                break;
+        }
+    }
+
+    window.samples++;
+}
+
+void CounterAggregator::removeObject(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    m_windows.erase(vid);
+}
+
+bool CounterAggregator::isWindowComplete(
+        _In_ std::chrono::steady_clock::time_point now) const
+{
+    SWSS_LOG_ENTER();
+
+    return now - m_windowStart >= m_window;
+}
+
+const std::unordered_map<sai_object_id_t, CounterAggregator::Window>& CounterAggregator::getWindows() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_windows;
+}
+
+void CounterAggregator::startWindow(
+        _In_ std::chrono::steady_clock::time_point now)
+{
+    SWSS_LOG_ENTER();
+
+    m_windowStart = now;
+
+    for (auto& kv: m_windows)
+    {
+        kv.second.samples = 0;
+    }
+}
+
+CounterAggregator::Function CounterAggregator::getFunction() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_function;
+}
+
+uint32_t CounterAggregator::getWindow() const
+{
+    SWSS_LOG_ENTER();
+
+    return (uint32_t)m_window.count();
+}
+
+bool CounterAggregator::parseFunction(
+        _In_ const std::string& name,
+        _Out_ Function& function)
+{
+    SWSS_LOG_ENTER();
+
+    if (name == AGGREGATION_MAX)
+    {
+        function = FUNCTION_MAX;
+    }
+    else if (name == AGGREGATION_MIN)
+    {
+        function = FUNCTION_MIN;
+    }
+    else if (name == AGGREGATION_SUM)
+    {
+        function = FUNCTION_SUM;
+    }
+    else if (name == AGGREGATION_LAST)
+    {
+        function = FUNCTION_LAST;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define CONTEXT_AGGREGATION_FIELD       "CONTEXT_AGGREGATION"
+
+#define AGGREGATION_MAX                 "max"
+#define AGGREGATION_MIN                 "min"
+#define AGGREGATION_SUM                 "sum"
+#define AGGREGATION_LAST                "last"
+
+namespace syncd
+{
+    /**
+     * @brief Aggregates counter samples over publishing window.
+     *
+     * Counter context with aggregator samples counters on every poll, but
+     * publishes only aggregated values at window boundary. For example
+     * watermarks can be sampled (read and cleared) every second for
+     * accuracy, while maximum is published once per minute.
+     *
+     * Aggregator is used only by poller of its context.
+     */
+    class CounterAggregator
+    {
+        private:
+
+            CounterAggregator(const CounterAggregator&) = delete;
+            CounterAggregator& operator=(const CounterAggregator&) = delete;
+
+        public:
+
+            typedef enum _Function
+            {
+                FUNCTION_MAX,
+
+                FUNCTION_MIN,
+
+                FUNCTION_SUM,
+
+                FUNCTION_LAST,
+
+            } Function;
+
+            typedef struct _Window
+            {
+                std::vector<sai_stat_id_t> statIds;
+
+                std::vector<uint64_t> values;
+
+                /**
+                 * @brief Number of samples in current window, zero when
+                 * object was not sampled yet.
+                 */
+                uint32_t samples;
+
+            } Window;
+
+        public:
+
+            /**
+             * @param function Aggregation of samples.
+             * @param window Publishing window (in milliseconds).
+             */
+            CounterAggregator(
+                    _In_ Function function,
+                    _In_ uint32_t window);
+
+            virtual ~CounterAggregator() = default;
+
+        public:
+
+            /**
+             * @brief Add sample of object stats to current window.
+             *
+             * If object stats changed, window of object is restarted.
+             */
+            void update(
+                    _In_ sai_object_id_t vid,
+                    _In_ uint32_t count,
+                    _In_ const sai_stat_id_t* statIds,
+                    _In_ const uint64_t* values);
+
+            void removeObject(
+                    _In_ sai_object_id_t vid);
+
+            /**
+             * @brief Check if current window is over and aggregated values
+             * should be published.
+             */
+            bool isWindowComplete(
+                    _In_ std::chrono::steady_clock::time_point now) const;
+
+            /**
+             * @brief Get windows of all objects, objects without samples
+             * should be skipped.
+             */
+            const std::unordered_map<sai_object_id_t, Window>& getWindows() const;
+
+            /**
+             * @brief Start next window, samples of all objects are dropped.
+             */
+            void startWindow(
+                    _In_ std::chrono::steady_clock::time_point now);
+
+            Function getFunction() const;
+
+            uint32_t getWindow() const;
+
+        public:
+
+            static bool parseFunction(
+                    _In_ const std::string& name,
+                    _Out_ Function& function);
+
+        private:
+
+            Function m_function;
+
+            std::chrono::milliseconds m_window;
+
+            std::chrono::steady_clock::time_point m_windowStart;
+
+            std::unordered_map<sai_object_id_t, Window> m_windows;
+    };
+}
@@ -0,0 +1,148 @@
+#include "CounterPublishBuffer.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+CounterPublishBuffer::CounterPublishBuffer(
+        _In_ const StatNameFunction& statName):
+    m_statName(statName),
+    m_count(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void CounterPublishBuffer::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_count = 0;
+}
+
+void CounterPublishBuffer::add(
+        _In_ sai_stat_id_t statId,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_count == m_values.size())
+    {
+        m_values.emplace_back();
+    }
+
+    auto& fvt = m_values[m_count++];
+
+    fvt.first = getStatName(statId);
+
+    formatValue(value, fvt.second);
+}
+
+bool CounterPublishBuffer::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count == 0;
+}
+
+size_t CounterPublishBuffer::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+const std::vector<swss::FieldValueTuple>& CounterPublishBuffer::getValues() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_values;
+}
+
+void CounterPublishBuffer::publish(
+        _Inout_ swss::Table& table,
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    // values are swapped back after set, so published vector holds only
+    // empty strings and resizing it does not allocate or free storage
+
+    m_published.resize(m_count);
+
+    for (size_t idx = 0; idx < m_count; idx++)
+    {
+        std::swap(m_published[idx], m_values[idx]);
+    }
+
+    table.set(key, m_published, "");
+
+    for (size_t idx = 0; idx < m_count; idx++)
+    {
+        std::swap(m_published[idx], m_values[idx]);
+    }
+}
+
+void CounterPublishBuffer::formatValue(
+        _In_ uint64_t value,
+        _Inout_ std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[20]; // UINT64_MAX has 20 digits
+
+    char* end = buffer + sizeof(buffer);
+    char* p = end;
+
+    while (value >= 100)
+    {
+        auto index = (value % 100) * 2;
+
+        value /= 100;
+
+        *--p = DIGIT_PAIRS[index + 1];
+        *--p = DIGIT_PAIRS[index];
+    }
+
+    if (value >= 10)
+    {
+        auto index = value * 2;
+
+        *--p = DIGIT_PAIRS[index + 1];
+        *--p = DIGIT_PAIRS[index];
+    }
+    else
+    {
+        *--p = (char)('0' + value);
+    }
+
+    str.assign(p, end);
+}
+
+const std::string& CounterPublishBuffer::getStatName(
+        _In_ sai_stat_id_t statId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_statNames.find(statId);
+
+    if (it != m_statNames.end())
+    {
+        return it->second;
+    }
+
+    return m_statNames.emplace(statId, m_statName(statId)).first->second;
+}
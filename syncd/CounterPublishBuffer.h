@@ -0,0 +1,117 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/table.h"
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Reusable buffer of counter values published to COUNTERS_DB.
+     *
+     * Counter context publishes every counter of every object on each poll.
+     * Buffer keeps serialized stat names and field value strings between
+     * polls, so after first poll values are formatted into already
+     * allocated strings and no memory is allocated.
+     *
+     * Buffer is not thread safe, each counter context has its own.
+     */
+    class CounterPublishBuffer
+    {
+        private:
+
+            CounterPublishBuffer(const CounterPublishBuffer&) = delete;
+            CounterPublishBuffer& operator=(const CounterPublishBuffer&) = delete;
+
+        public:
+
+            typedef std::function<std::string(sai_stat_id_t)> StatNameFunction;
+
+        public:
+
+            /**
+             * @param statName Used to serialize stat when it is seen first
+             * time.
+             */
+            CounterPublishBuffer(
+                    _In_ const StatNameFunction& statName);
+
+            virtual ~CounterPublishBuffer() = default;
+
+        public:
+
+            /**
+             * @brief Start values of next object.
+             */
+            void clear();
+
+            void add(
+                    _In_ sai_stat_id_t statId,
+                    _In_ uint64_t value);
+
+            bool empty() const;
+
+            /**
+             * @brief Number of values added since last clear.
+             */
+            size_t getCount() const;
+
+            /**
+             * @brief Get values storage, only first getCount() values are
+             * valid.
+             */
+            const std::vector<swss::FieldValueTuple>& getValues() const;
+
+            /**
+             * @brief Set values added since last clear to table key.
+             */
+            void publish(
+                    _Inout_ swss::Table& table,
+                    _In_ const std::string& key);
+
+        public:
+
+            /**
+             * @brief Format unsigned integer as decimal string.
+             *
+             * Same output as std::to_string, but string storage is reused.
+             */
+            static void formatValue(
+                    _In_ uint64_t value,
+                    _Inout_ std::string& str);
+
+        private:
+
+            const std::string& getStatName(
+                    _In_ sai_stat_id_t statId);
+
+        private:
+
+            StatNameFunction m_statName;
+
+            std::unordered_map<sai_stat_id_t, std::string> m_statNames;
+
+            /**
+             * @brief Values, only first m_count are valid.
+             *
+             * Vector is never shrunk, so strings keep their storage when
+             * objects publish different number of values.
+             */
+            std::vector<swss::FieldValueTuple> m_values;
+
+            size_t m_count;
+
+            /**
+             * @brief Values passed to table, table accepts only whole vector,
+             * so valid values are moved here for the call and moved back.
+             */
+            std::vector<swss::FieldValueTuple> m_published;
+    };
+}
@@ -0,0 +1,62 @@
+#include "CounterRing.h"
+
+#include "swss/logger.h"
+
+#include <cctype>
+
+using namespace syncd;
+
+static_assert(sizeof(CounterRingSeries) % sizeof(uint64_t) == 0, "series must be 8 bytes aligned");
+static_assert(sizeof(CounterRingHeader) % sizeof(uint64_t) == 0, "header must be 8 bytes aligned");
+
+std::string CounterRing::getShmName(
+        _In_ const std::string& group)
+{
+    SWSS_LOG_ENTER();
+
+    std::string name = COUNTER_RING_SHM_PREFIX;
+
+    for (char c: group)
+    {
+        name += (std::isalnum((unsigned char)c) || c == '_' || c == '-') ? c : '_';
+    }
+
+    return name;
+}
+
+size_t CounterRing::getSeriesSize(
+        _In_ uint32_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    return sizeof(CounterRingSeries) + (size_t)capacity * sizeof(CounterRingSample);
+}
+
+size_t CounterRing::getShmSize(
+        _In_ uint32_t capacity,
+        _In_ uint32_t maxSeries)
+{
+    SWSS_LOG_ENTER();
+
+    return sizeof(CounterRingHeader) + (size_t)maxSeries * getSeriesSize(capacity);
+}
+
+CounterRingSeries* CounterRing::getSeries(
+        _In_ void* base,
+        _In_ uint32_t capacity,
+        _In_ uint32_t index)
+{
+    SWSS_LOG_ENTER();
+
+    auto ptr = reinterpret_cast<uint8_t*>(base) + sizeof(CounterRingHeader) + (size_t)index * getSeriesSize(capacity);
+
+    return reinterpret_cast<CounterRingSeries*>(ptr);
+}
+
+CounterRingSample* CounterRing::getSamples(
+        _In_ CounterRingSeries* series)
+{
+    SWSS_LOG_ENTER();
+
+    return reinterpret_cast<CounterRingSample*>(series + 1);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <string>
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define COUNTER_RING_MAGIC              0x474e5243
+#define COUNTER_RING_VERSION            1
+#define COUNTER_RING_STAT_NAME_SIZE     64
+#define COUNTER_RING_SHM_PREFIX         "/sairedis_counter_ring_"
+
+namespace syncd
+{
+    /*
+     * Shared memory layout of counter ring:
+     *
+     * CounterRingHeader
+     * maxSeries times:
+     *   CounterRingSeries
+     *   capacity times CounterRingSample
+     *
+     * Single writer (flex counter poller) appends samples, readers are
+     * lock free and use sequence of each series as seqlock: sequence is
+     * odd while series is modified, reader retries when sequence changed
+     * during read.
+     */
+
+    typedef struct _CounterRingSample
+    {
+        /**
+         * @brief Sample time, nanoseconds since epoch.
+         */
+        uint64_t timestamp;
+
+        uint64_t value;
+
+    } CounterRingSample;
+
+    typedef struct _CounterRingSeries
+    {
+        std::atomic<uint64_t> sequence;
+
+        /**
+         * @brief Object VID, zero when series is not used.
+         */
+        uint64_t objectId;
+
+        uint32_t statId;
+
+        uint32_t reserved;
+
+        /**
+         * @brief Total number of samples written, newest sample is at
+         * index (count - 1) % capacity.
+         */
+        uint64_t count;
+
+        char statName[COUNTER_RING_STAT_NAME_SIZE];
+
+    } CounterRingSeries;
+
+    typedef struct _CounterRingHeader
+    {
+        /**
+         * @brief Written last by writer, ring is valid when set.
+         */
+        std::atomic<uint32_t> magic;
+
+        uint32_t version;
+
+        /**
+         * @brief Number of samples kept per series.
+         */
+        uint32_t capacity;
+
+        uint32_t maxSeries;
+
+        /**
+         * @brief Number of used entries of series table, only grows.
+         */
+        std::atomic<uint32_t> seriesCount;
+
+        uint32_t reserved;
+
+    } CounterRingHeader;
+
+    class CounterRing
+    {
+        private:
+
+            CounterRing() = delete;
+
+        public:
+
+            /**
+             * @brief Shared memory name of flex counter group ring.
+             */
+            static std::string getShmName(
+                    _In_ const std::string& group);
+
+            static size_t getSeriesSize(
+                    _In_ uint32_t capacity);
+
+            static size_t getShmSize(
+                    _In_ uint32_t capacity,
+                    _In_ uint32_t maxSeries);
+
+            static CounterRingSeries* getSeries(
+                    _In_ void* base,
+                    _In_ uint32_t capacity,
+                    _In_ uint32_t index);
+
+            static CounterRingSample* getSamples(
+                    _In_ CounterRingSeries* series);
+    };
+}
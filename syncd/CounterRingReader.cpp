@@ -0,0 +1,184 @@
+#include "CounterRingReader.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <inttypes.h>
+
+using namespace syncd;
+
+CounterRingReader::CounterRingReader(
+        _In_ const std::string& group):
+    m_shmName(CounterRing::getShmName(group)),
+    m_size(0),
+    m_base(nullptr),
+    m_header(nullptr),
+    m_capacity(0),
+    m_maxSeries(0)
+{
+    SWSS_LOG_ENTER();
+
+    int fd = shm_open(m_shmName.c_str(), O_RDONLY, 0);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_THROW("failed to open counter ring %s: %s", m_shmName.c_str(), strerror(errno));
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CounterRingHeader))
+    {
+        close(fd);
+
+        SWSS_LOG_THROW("counter ring %s is not valid", m_shmName.c_str());
+    }
+
+    m_size = (size_t)st.st_size;
+
+    m_base = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (m_base == MAP_FAILED)
+    {
+        SWSS_LOG_THROW("failed to map counter ring %s: %s", m_shmName.c_str(), strerror(errno));
+    }
+
+    m_header = reinterpret_cast<const CounterRingHeader*>(m_base);
+
+    if (m_header->magic.load(std::memory_order_acquire) != COUNTER_RING_MAGIC ||
+            m_header->version != COUNTER_RING_VERSION ||
+            m_size < CounterRing::getShmSize(m_header->capacity, m_header->maxSeries))
+    {
+        munmap(m_base, m_size);
+
+        SWSS_LOG_THROW("counter ring %s is not valid or not initialized", m_shmName.c_str());
+    }
+
+    m_capacity = m_header->capacity;
+    m_maxSeries = m_header->maxSeries;
+}
+
+CounterRingReader::~CounterRingReader()
+{
+    SWSS_LOG_ENTER();
+
+    munmap(m_base, m_size);
+}
+
+uint32_t CounterRingReader::getCapacity() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_capacity;
+}
+
+uint32_t CounterRingReader::getSeriesCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return std::min(m_header->seriesCount.load(std::memory_order_acquire), m_maxSeries);
+}
+
+bool CounterRingReader::readSeries(
+        _In_ uint32_t index,
+        _In_ uint32_t maxSamples,
+        _Out_ Series& series) const
+{
+    SWSS_LOG_ENTER();
+
+    if (index >= m_maxSeries)
+    {
+        SWSS_LOG_THROW("series index %u out of range, max %u", index, m_maxSeries);
+    }
+
+    auto shared = CounterRing::getSeries(m_base, m_capacity, index);
+
+    auto samples = CounterRing::getSamples(shared);
+
+    uint32_t limit = (maxSamples == 0) ? m_capacity : std::min(maxSamples, m_capacity);
+
+    char statName[COUNTER_RING_STAT_NAME_SIZE];
+
+    for (int attempt = 0; attempt < MAX_READ_RETRIES; attempt++)
+    {
+        uint64_t begin = shared->sequence.load(std::memory_order_acquire);
+
+        if (begin & 1)
+        {
+            // writer is modifying series
+
+            continue;
+        }
+
+        uint64_t objectId = shared->objectId;
+        uint32_t statId = shared->statId;
+        uint64_t count = shared->count;
+
+        memcpy(statName, shared->statName, sizeof(statName));
+
+        uint64_t available = std::min<uint64_t>(count, limit);
+
+        series.samples.resize(available);
+
+        for (uint64_t i = 0; i < available; i++)
+        {
+            series.samples[i] = samples[(count - available + i) % m_capacity];
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (shared->sequence.load(std::memory_order_relaxed) != begin)
+        {
+            continue;
+        }
+
+        if (objectId == 0)
+        {
+            return false;
+        }
+
+        statName[COUNTER_RING_STAT_NAME_SIZE - 1] = 0;
+
+        series.index = index;
+        series.objectId = objectId;
+        series.statId = statId;
+        series.statName = statName;
+
+        return true;
+    }
+
+    SWSS_LOG_WARN("failed to read consistent series %u of counter ring %s", index, m_shmName.c_str());
+
+    return false;
+}
+
+std::vector<CounterRingReader::Series> CounterRingReader::readAll(
+        _In_ uint32_t maxSamples) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<Series> result;
+
+    uint32_t count = getSeriesCount();
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        Series series;
+
+        if (readSeries(index, maxSamples, series))
+        {
+            result.push_back(std::move(series));
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CounterRing.h"
+
+#include <string>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Lock free reader of shared memory counter ring.
+     *
+     * Reader maps ring read only and never blocks the writer, series
+     * modified during read are read again.
+     */
+    class CounterRingReader
+    {
+        private:
+
+            CounterRingReader(const CounterRingReader&) = delete;
+            CounterRingReader& operator=(const CounterRingReader&) = delete;
+
+        public:
+
+            typedef struct _Series
+            {
+                uint32_t index;
+
+                uint64_t objectId;
+
+                uint32_t statId;
+
+                std::string statName;
+
+                /**
+                 * @brief Samples from oldest to newest.
+                 */
+                std::vector<CounterRingSample> samples;
+
+            } Series;
+
+            /**
+             * @brief Maximum number of attempts to read consistent series.
+             */
+            static constexpr int MAX_READ_RETRIES = 1000;
+
+        public:
+
+            /**
+             * @brief Open ring of flex counter group.
+             *
+             * Throws when ring does not exist or is not valid.
+             */
+            CounterRingReader(
+                    _In_ const std::string& group);
+
+            virtual ~CounterRingReader();
+
+        public:
+
+            uint32_t getCapacity() const;
+
+            /**
+             * @brief Number of series table entries, including free ones.
+             */
+            uint32_t getSeriesCount() const;
+
+            /**
+             * @brief Read series at index.
+             *
+             * @param index Series index.
+             * @param maxSamples Maximum number of newest samples to read,
+             * zero reads all samples.
+             * @param series Read series.
+             *
+             * @return False if series is free or could not be read
+             * consistently.
+             */
+            bool readSeries(
+                    _In_ uint32_t index,
+                    _In_ uint32_t maxSamples,
+                    _Out_ Series& series) const;
+
+            /**
+             * @brief Read all used series.
+             */
+            std::vector<Series> readAll(
+                    _In_ uint32_t maxSamples) const;
+
+        private:
+
+            std::string m_shmName;
+
+            size_t m_size;
+
+            void* m_base;
+
+            const CounterRingHeader* m_header;
+
+            uint32_t m_capacity;
+
+            uint32_t m_maxSeries;
+    };
+}
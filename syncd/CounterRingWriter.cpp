@@ -0,0 +1,293 @@
+#include "CounterRingWriter.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+using namespace syncd;
+
+CounterRingWriter::CounterRingWriter(
+        _In_ const std::string& group,
+        _In_ uint32_t capacity,
+        _In_ uint32_t maxSeries):
+    m_shmName(CounterRing::getShmName(group)),
+    m_capacity(capacity),
+    m_maxSeries(maxSeries),
+    m_size(CounterRing::getShmSize(capacity, maxSeries)),
+    m_base(nullptr),
+    m_header(nullptr),
+    m_fullLogged(false)
+{
+    SWSS_LOG_ENTER();
+
+    if (capacity == 0 || maxSeries == 0)
+    {
+        SWSS_LOG_THROW("counter ring %s capacity and max series must be positive", m_shmName.c_str());
+    }
+
+    // previous instance could leave stale ring
+
+    shm_unlink(m_shmName.c_str());
+
+    int fd = shm_open(m_shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_THROW("failed to create counter ring %s: %s", m_shmName.c_str(), strerror(errno));
+    }
+
+    if (ftruncate(fd, (off_t)m_size) != 0)
+    {
+        int err = errno;
+
+        close(fd);
+        shm_unlink(m_shmName.c_str());
+
+        SWSS_LOG_THROW("failed to resize counter ring %s to %zu bytes: %s", m_shmName.c_str(), m_size, strerror(err));
+    }
+
+    m_base = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (m_base == MAP_FAILED)
+    {
+        int err = errno;
+
+        shm_unlink(m_shmName.c_str());
+
+        SWSS_LOG_THROW("failed to map counter ring %s: %s", m_shmName.c_str(), strerror(err));
+    }
+
+    // memory is zeroed by ftruncate, all series are free
+
+    m_header = reinterpret_cast<CounterRingHeader*>(m_base);
+
+    m_header->version = COUNTER_RING_VERSION;
+    m_header->capacity = capacity;
+    m_header->maxSeries = maxSeries;
+    m_header->seriesCount.store(0, std::memory_order_relaxed);
+    m_header->magic.store(COUNTER_RING_MAGIC, std::memory_order_release);
+
+    SWSS_LOG_NOTICE("counter ring %s created, %u samples per series, max %u series, %zu bytes",
+            m_shmName.c_str(), capacity, maxSeries, m_size);
+}
+
+CounterRingWriter::~CounterRingWriter()
+{
+    SWSS_LOG_ENTER();
+
+    munmap(m_base, m_size);
+
+    shm_unlink(m_shmName.c_str());
+
+    SWSS_LOG_NOTICE("counter ring %s removed", m_shmName.c_str());
+}
+
+uint32_t CounterRingWriter::getCapacity() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_capacity;
+}
+
+uint32_t CounterRingWriter::getMaxSeries() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_maxSeries;
+}
+
+void CounterRingWriter::append(
+        _In_ sai_object_id_t vid,
+        _In_ uint32_t count,
+        _In_ const sai_stat_id_t* statIds,
+        _In_ const uint64_t* values,
+        _In_ const StatNameFunction& statName)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& object = m_objects[vid];
+
+    if (object.statIds.size() != count || !std::equal(object.statIds.begin(), object.statIds.end(), statIds))
+    {
+        // stats of object changed, release series of previous stats
+
+        for (auto index: object.series)
+        {
+            freeSeries(index);
+        }
+
+        object.statIds.assign(statIds, statIds + count);
+        object.series.clear();
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            object.series.push_back(allocateSeries(vid, statIds[i], statName(statIds[i])));
+        }
+    }
+
+    uint64_t timestamp = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t index = object.series[i];
+
+        if (index == INVALID_SERIES)
+        {
+            if (m_freeSeries.empty() && m_header->seriesCount.load(std::memory_order_relaxed) >= m_maxSeries)
+            {
+                continue;
+            }
+
+            // ring was full when series was added
+
+            index = allocateSeries(vid, statIds[i], statName(statIds[i]));
+
+            object.series[i] = index;
+        }
+
+        auto series = CounterRing::getSeries(m_base, m_capacity, index);
+
+        uint64_t sequence = series->sequence.load(std::memory_order_relaxed);
+
+        series->sequence.store(sequence + 1, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto& sample = CounterRing::getSamples(series)[series->count % m_capacity];
+
+        sample.timestamp = timestamp;
+        sample.value = values[i];
+
+        series->count++;
+
+        series->sequence.store(sequence + 2, std::memory_order_release);
+    }
+}
+
+void CounterRingWriter::removeObject(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_objects.find(vid);
+
+    if (it == m_objects.end())
+    {
+        return;
+    }
+
+    for (auto index: it->second.series)
+    {
+        freeSeries(index);
+    }
+
+    m_objects.erase(it);
+}
+
+uint32_t CounterRingWriter::allocateSeries(
+        _In_ sai_object_id_t vid,
+        _In_ sai_stat_id_t statId,
+        _In_ const std::string& statName)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t index;
+
+    uint32_t seriesCount = m_header->seriesCount.load(std::memory_order_relaxed);
+
+    if (m_freeSeries.size())
+    {
+        index = m_freeSeries.back();
+
+        m_freeSeries.pop_back();
+    }
+    else if (seriesCount < m_maxSeries)
+    {
+        index = seriesCount;
+    }
+    else
+    {
+        if (!m_fullLogged)
+        {
+            SWSS_LOG_WARN("counter ring %s is full (%u series), %s %s is not recorded",
+                    m_shmName.c_str(),
+                    m_maxSeries,
+                    sai_serialize_object_id(vid).c_str(),
+                    statName.c_str());
+
+            m_fullLogged = true;
+        }
+
+        return INVALID_SERIES;
+    }
+
+    auto series = CounterRing::getSeries(m_base, m_capacity, index);
+
+    uint64_t sequence = series->sequence.load(std::memory_order_relaxed);
+
+    series->sequence.store(sequence + 1, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    series->objectId = vid;
+    series->statId = statId;
+    series->count = 0;
+
+    strncpy(series->statName, statName.c_str(), COUNTER_RING_STAT_NAME_SIZE - 1);
+
+    series->statName[COUNTER_RING_STAT_NAME_SIZE - 1] = 0;
+
+    series->sequence.store(sequence + 2, std::memory_order_release);
+
+    if (index == seriesCount)
+    {
+        m_header->seriesCount.store(seriesCount + 1, std::memory_order_release);
+    }
+
+    return index;
+}
+
+void CounterRingWriter::freeSeries(
+        _In_ uint32_t index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index == INVALID_SERIES)
+    {
+        return;
+    }
+
+    auto series = CounterRing::getSeries(m_base, m_capacity, index);
+
+    uint64_t sequence = series->sequence.load(std::memory_order_relaxed);
+
+    series->sequence.store(sequence + 1, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    series->objectId = SAI_NULL_OBJECT_ID;
+    series->count = 0;
+
+    series->sequence.store(sequence + 2, std::memory_order_release);
+
+    m_freeSeries.push_back(index);
+
+    m_fullLogged = false;
+}
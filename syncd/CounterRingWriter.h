@@ -0,0 +1,126 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "CounterRing.h"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define RING_SIZE_FIELD                 "RING_SIZE"
+#define RING_MAX_SERIES_FIELD           "RING_MAX_SERIES"
+
+#define DEFAULT_RING_MAX_SERIES         (16 * 1024)
+
+namespace syncd
+{
+    /**
+     * @brief Writes flex counter samples to shared memory counter ring.
+     *
+     * Keeps last samples of each (object, stat) series with timestamps, so
+     * local readers can sample counters more often than COUNTERS_DB is
+     * refreshed. Contexts of group are never polled in parallel, since
+     * poller holds group poll mutex, so writer lock is not contended and
+     * only keeps writer safe on its own. Readers are lock free.
+     */
+    class CounterRingWriter
+    {
+        private:
+
+            CounterRingWriter(const CounterRingWriter&) = delete;
+            CounterRingWriter& operator=(const CounterRingWriter&) = delete;
+
+        public:
+
+            typedef std::function<std::string(sai_stat_id_t)> StatNameFunction;
+
+        public:
+
+            /**
+             * @brief Create shared memory ring of flex counter group.
+             *
+             * @param group Flex counter group name.
+             * @param capacity Number of samples kept per series.
+             * @param maxSeries Maximum number of series.
+             */
+            CounterRingWriter(
+                    _In_ const std::string& group,
+                    _In_ uint32_t capacity,
+                    _In_ uint32_t maxSeries);
+
+            virtual ~CounterRingWriter();
+
+        public:
+
+            /**
+             * @brief Append samples of object stats.
+             *
+             * @param statName Used to name series when stat is seen first
+             * time.
+             */
+            void append(
+                    _In_ sai_object_id_t vid,
+                    _In_ uint32_t count,
+                    _In_ const sai_stat_id_t* statIds,
+                    _In_ const uint64_t* values,
+                    _In_ const StatNameFunction& statName);
+
+            void removeObject(
+                    _In_ sai_object_id_t vid);
+
+            uint32_t getCapacity() const;
+
+            uint32_t getMaxSeries() const;
+
+        private:
+
+            typedef struct _ObjectSeries
+            {
+                std::vector<sai_stat_id_t> statIds;
+
+                /**
+                 * @brief Series index of each stat, INVALID_SERIES when ring
+                 * is full.
+                 */
+                std::vector<uint32_t> series;
+
+            } ObjectSeries;
+
+            static constexpr uint32_t INVALID_SERIES = UINT32_MAX;
+
+            uint32_t allocateSeries(
+                    _In_ sai_object_id_t vid,
+                    _In_ sai_stat_id_t statId,
+                    _In_ const std::string& statName);
+
+            void freeSeries(
+                    _In_ uint32_t index);
+
+        private:
+
+            std::string m_shmName;
+
+            uint32_t m_capacity;
+
+            uint32_t m_maxSeries;
+
+            size_t m_size;
+
+            void* m_base;
+
+            CounterRingHeader* m_header;
+
+            std::unordered_map<sai_object_id_t, ObjectSeries> m_objects;
+
+            std::vector<uint32_t> m_freeSeries;
+
+            bool m_fullLogged;
+
+            std::mutex m_mutex;
+    };
+}
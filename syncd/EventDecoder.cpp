@@ -0,0 +1,355 @@
+#include "EventDecoder.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace syncd;
+using namespace saimeta;
+
+DecodedEvent::DecodedEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple& kco):
+    m_kco(kco),
+    m_api(SAI_COMMON_API_MAX),
+    m_objectType(SAI_OBJECT_TYPE_NULL),
+    m_pending(0)
+{
+    SWSS_LOG_ENTER();
+
+    memset(&m_metaKey, 0, sizeof(m_metaKey));
+}
+
+EventDecoder::EventDecoder(
+        _In_ size_t threads,
+        _In_ size_t bulkChunkSize):
+    m_bulkChunkSize(bulkChunkSize),
+    m_runThread(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (threads == 0)
+    {
+        SWSS_LOG_THROW("at least one decode thread is required");
+    }
+
+    if (bulkChunkSize == 0)
+    {
+        SWSS_LOG_THROW("bulk chunk size must be positive");
+    }
+
+    for (size_t idx = 0; idx < threads; idx++)
+    {
+        m_threads.push_back(std::make_shared<std::thread>(&EventDecoder::threadFunction, this));
+    }
+
+    SWSS_LOG_NOTICE("event decoder started with %zu threads", threads);
+}
+
+EventDecoder::~EventDecoder()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_runThread = false;
+    }
+
+    m_taskCv.notify_all();
+
+    for (auto& thread: m_threads)
+    {
+        thread->join();
+    }
+}
+
+void EventDecoder::decode(
+        _In_ std::shared_ptr<DecodedEvent> event)
+{
+    SWSS_LOG_ENTER();
+
+    sai_common_api_t api;
+
+    if (!opToApi(kfvOp(event->m_kco), api) || kfvKey(event->m_kco).length() == 0)
+    {
+        // event will be processed without decode
+
+        return;
+    }
+
+    event->m_api = api;
+
+    std::vector<Task> tasks;
+
+    if (isBulkApi(api))
+    {
+        try
+        {
+            prepareBulkEvent(
+                    event->m_kco,
+                    event->m_objectType,
+                    event->m_objectIds,
+                    event->m_strAttributes,
+                    event->m_attributes);
+        }
+        catch (...)
+        {
+            event->m_error = std::current_exception();
+
+            return;
+        }
+
+        size_t count = event->m_objectIds.size();
+
+        for (size_t begin = 0; begin < count; begin += m_bulkChunkSize)
+        {
+            tasks.push_back({event, begin, std::min(count, begin + m_bulkChunkSize)});
+        }
+    }
+    else
+    {
+        tasks.push_back({event, 0, 0});
+    }
+
+    if (tasks.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        event->m_pending = tasks.size();
+
+        m_tasks.insert(m_tasks.end(), tasks.begin(), tasks.end());
+    }
+
+    if (tasks.size() == 1)
+    {
+        m_taskCv.notify_one();
+    }
+    else
+    {
+        m_taskCv.notify_all();
+    }
+}
+
+void EventDecoder::wait(
+        _In_ const DecodedEvent& event)
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_doneCv.wait(lock, [&]{ return event.m_pending == 0; });
+    }
+
+    if (event.m_error)
+    {
+        std::rethrow_exception(event.m_error);
+    }
+}
+
+void EventDecoder::threadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    while (true)
+    {
+        Task task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_taskCv.wait(lock, [&]{ return !m_runThread || !m_tasks.empty(); });
+
+            if (!m_runThread)
+            {
+                break;
+            }
+
+            task = m_tasks.front();
+
+            m_tasks.pop_front();
+        }
+
+        execute(task);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            task.event->m_pending--;
+        }
+
+        m_doneCv.notify_all();
+    }
+}
+
+void EventDecoder::execute(
+        _In_ const Task& task)
+{
+    SWSS_LOG_ENTER();
+
+    auto& event = *task.event;
+
+    try
+    {
+        if (isBulkApi(event.m_api))
+        {
+            // each task writes to its own range of prepared containers
+
+            decodeBulkEvent(
+                    event.m_kco,
+                    event.m_objectType,
+                    task.begin,
+                    task.end,
+                    event.m_objectIds,
+                    event.m_strAttributes,
+                    event.m_attributes);
+        }
+        else
+        {
+            event.m_list = decodeQuadEvent(event.m_kco, event.m_metaKey);
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // in case of multiple failed chunks, report first one
+
+        if (!event.m_error)
+        {
+            event.m_error = std::current_exception();
+        }
+    }
+}
+
+bool EventDecoder::opToApi(
+        _In_ const std::string& op,
+        _Out_ sai_common_api_t& api)
+{
+    SWSS_LOG_ENTER();
+
+    if (op == REDIS_ASIC_STATE_COMMAND_CREATE)
+        api = SAI_COMMON_API_CREATE;
+    else if (op == REDIS_ASIC_STATE_COMMAND_REMOVE)
+        api = SAI_COMMON_API_REMOVE;
+    else if (op == REDIS_ASIC_STATE_COMMAND_SET)
+        api = SAI_COMMON_API_SET;
+    else if (op == REDIS_ASIC_STATE_COMMAND_GET)
+        api = SAI_COMMON_API_GET;
+    else if (op == REDIS_ASIC_STATE_COMMAND_BULK_CREATE)
+        api = SAI_COMMON_API_BULK_CREATE;
+    else if (op == REDIS_ASIC_STATE_COMMAND_BULK_REMOVE)
+        api = SAI_COMMON_API_BULK_REMOVE;
+    else if (op == REDIS_ASIC_STATE_COMMAND_BULK_SET)
+        api = SAI_COMMON_API_BULK_SET;
+    else
+    {
+        api = SAI_COMMON_API_MAX;
+
+        return false;
+    }
+
+    return true;
+}
+
+bool EventDecoder::isBulkApi(
+        _In_ sai_common_api_t api)
+{
+    SWSS_LOG_ENTER();
+
+    return api == SAI_COMMON_API_BULK_CREATE
+        || api == SAI_COMMON_API_BULK_REMOVE
+        || api == SAI_COMMON_API_BULK_SET
+        || api == SAI_COMMON_API_BULK_GET;
+}
+
+std::shared_ptr<SaiAttributeList> EventDecoder::decodeQuadEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple& kco,
+        _Out_ sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string& key = kfvKey(kco);
+
+    sai_deserialize_object_meta_key(key, metaKey);
+
+    if (!sai_metadata_is_object_type_valid(metaKey.objecttype))
+    {
+        SWSS_LOG_THROW("invalid object type %s", key.c_str());
+    }
+
+    return std::make_shared<SaiAttributeList>(metaKey.objecttype, kfvFieldsValues(kco), false);
+}
+
+void EventDecoder::prepareBulkEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple& kco,
+        _Out_ sai_object_type_t& objectType,
+        _Out_ std::vector<std::string>& objectIds,
+        _Out_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+        _Out_ std::vector<std::shared_ptr<SaiAttributeList>>& attributes)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string& key = kfvKey(kco); // objectType:count
+
+    std::string strObjectType = key.substr(0, key.find(":"));
+
+    sai_deserialize_object_type(strObjectType, objectType);
+
+    size_t count = kfvFieldsValues(kco).size();
+
+    objectIds.resize(count);
+    strAttributes.resize(count);
+    attributes.resize(count);
+}
+
+void EventDecoder::decodeBulkEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple& kco,
+        _In_ sai_object_type_t objectType,
+        _In_ size_t begin,
+        _In_ size_t end,
+        _Inout_ std::vector<std::string>& objectIds,
+        _Inout_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+        _Inout_ std::vector<std::shared_ptr<SaiAttributeList>>& attributes)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& values = kfvFieldsValues(kco);
+
+    // field = objectId
+    // value = attrid=attrvalue|...
+
+    for (size_t idx = begin; idx < end; idx++)
+    {
+        const auto& fvt = values.at(idx);
+
+        objectIds[idx] = fvField(fvt);
+
+        auto v = swss::tokenize(fvValue(fvt), '|');
+
+        auto& entries = strAttributes[idx]; // attributes per object id
+
+        entries.clear();
+
+        for (const auto& item: v)
+        {
+            auto start = item.find_first_of("=");
+
+            entries.emplace_back(item.substr(0, start), item.substr(start + 1));
+        }
+
+        // since now we converted this to proper list, we can extract attributes
+
+        attributes[idx] = std::make_shared<SaiAttributeList>(objectType, entries, false);
+    }
+}
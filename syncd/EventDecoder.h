@@ -0,0 +1,214 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "meta/SaiAttributeList.h"
+
+#include "swss/table.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Event popped from ASIC channel with deserialized object keys
+     * and attributes.
+     *
+     * Only quad and bulk quad events are decoded, all other events are
+     * processed directly from key op fields values tuple.
+     */
+    class DecodedEvent
+    {
+        private:
+
+            DecodedEvent(const DecodedEvent&) = delete;
+            DecodedEvent& operator=(const DecodedEvent&) = delete;
+
+        public:
+
+            DecodedEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
+            virtual ~DecodedEvent() = default;
+
+        public:
+
+            swss::KeyOpFieldsValuesTuple m_kco;
+
+            /**
+             * @brief Api of decoded event, SAI_COMMON_API_MAX if event was
+             * not decoded.
+             */
+            sai_common_api_t m_api;
+
+            // quad event
+
+            sai_object_meta_key_t m_metaKey;
+
+            std::shared_ptr<saimeta::SaiAttributeList> m_list;
+
+            // bulk quad event
+
+            sai_object_type_t m_objectType;
+
+            std::vector<std::string> m_objectIds;
+
+            std::vector<std::vector<swss::FieldValueTuple>> m_strAttributes;
+
+            std::vector<std::shared_ptr<saimeta::SaiAttributeList>> m_attributes;
+
+            /**
+             * @brief Exception thrown during decode, rethrown when event is
+             * executed, so errors are reported in event order.
+             */
+            std::exception_ptr m_error;
+
+        private:
+
+            friend class EventDecoder;
+
+            /**
+             * @brief Number of decode tasks not yet finished, guarded by
+             * decoder mutex.
+             */
+            size_t m_pending;
+    };
+
+    /**
+     * @brief Decodes ASIC channel events on worker threads.
+     *
+     * Events are decoded ahead of execution, so while single executor
+     * thread is calling vendor SAI for one event, attributes of next
+     * events are already being deserialized. Bulk events are split to
+     * chunks decoded in parallel.
+     *
+     * VID to RID translation is not done here, since objects created by
+     * previous events in the same batch are not yet known.
+     */
+    class EventDecoder
+    {
+        private:
+
+            EventDecoder(const EventDecoder&) = delete;
+            EventDecoder& operator=(const EventDecoder&) = delete;
+
+        public:
+
+            static constexpr size_t DEFAULT_BULK_CHUNK_SIZE = 256;
+
+            /**
+             * @brief Maximum number of events popped ahead of execution.
+             */
+            static constexpr size_t MAX_BATCH_SIZE = 128;
+
+        public:
+
+            EventDecoder(
+                    _In_ size_t threads,
+                    _In_ size_t bulkChunkSize = DEFAULT_BULK_CHUNK_SIZE);
+
+            virtual ~EventDecoder();
+
+        public:
+
+            /**
+             * @brief Schedule event decode on worker threads.
+             */
+            void decode(
+                    _In_ std::shared_ptr<DecodedEvent> event);
+
+            /**
+             * @brief Wait until event is decoded.
+             *
+             * Rethrows exception caught during decode.
+             */
+            void wait(
+                    _In_ const DecodedEvent& event);
+
+        public:
+
+            /**
+             * @brief Get api for quad and bulk quad operation.
+             *
+             * @return True if operation is quad or bulk quad operation.
+             */
+            static bool opToApi(
+                    _In_ const std::string& op,
+                    _Out_ sai_common_api_t& api);
+
+            static bool isBulkApi(
+                    _In_ sai_common_api_t api);
+
+            static std::shared_ptr<saimeta::SaiAttributeList> decodeQuadEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco,
+                    _Out_ sai_object_meta_key_t& metaKey);
+
+            /**
+             * @brief Deserialize bulk object type and prepare containers for
+             * all bulk entries.
+             */
+            static void prepareBulkEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco,
+                    _Out_ sai_object_type_t& objectType,
+                    _Out_ std::vector<std::string>& objectIds,
+                    _Out_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+                    _Out_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes);
+
+            /**
+             * @brief Decode bulk entries in range [begin, end).
+             *
+             * Containers must be prepared by prepareBulkEvent, different
+             * ranges can be decoded concurrently.
+             */
+            static void decodeBulkEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco,
+                    _In_ sai_object_type_t objectType,
+                    _In_ size_t begin,
+                    _In_ size_t end,
+                    _Inout_ std::vector<std::string>& objectIds,
+                    _Inout_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+                    _Inout_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes);
+
+        private:
+
+            typedef struct _Task
+            {
+                std::shared_ptr<DecodedEvent> event;
+
+                size_t begin;
+
+                size_t end;
+
+            } Task;
+
+            void threadFunction();
+
+            void execute(
+                    _In_ const Task& task);
+
+        private:
+
+            size_t m_bulkChunkSize;
+
+            bool m_runThread;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_taskCv;
+
+            std::condition_variable m_doneCv;
+
+            std::deque<Task> m_tasks;
+
+            std::vector<std::shared_ptr<std::thread>> m_threads;
+    };
+}
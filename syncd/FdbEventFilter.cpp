@@ -0,0 +1,264 @@
+#include "FdbEventFilter.h"
+
+#include "sairediscommon.h"
+
+#include "swss/logger.h"
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+using namespace syncd;
+
+FdbEventFilter::FdbEventFilter(
+        _In_ uint32_t window,
+        _In_ std::shared_ptr<swss::DBConnector> dbState,
+        _In_ size_t size):
+    m_window(window),
+    m_windowNs((uint64_t)window * 1000000)
+{
+    SWSS_LOG_ENTER();
+
+    size_t slots = 1;
+
+    while (slots < size)
+    {
+        slots <<= 1;
+    }
+
+    m_slots = std::vector<Slot>(slots);
+
+    m_mask = slots - 1;
+
+    m_generation = 0;
+    m_passed = 0;
+    m_suppressed = 0;
+    m_invalidated = 0;
+
+    if (dbState)
+    {
+        m_table = std::make_shared<swss::Table>(dbState.get(), NOTIFICATION_FILTER_TABLE);
+    }
+
+    SWSS_LOG_NOTICE("fdb event filter window %u ms, %zu slots", window, slots);
+}
+
+uint64_t FdbEventFilter::mix(
+        _In_ uint64_t hash,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    // avalanche bits, so similar keys are spread over all slots
+
+    uint64_t x = hash ^ (value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+
+    return x ^ (x >> 31);
+}
+
+uint64_t FdbEventFilter::now()
+{
+    SWSS_LOG_ENTER();
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool FdbEventFilter::getAttributesHash(
+        _In_ const sai_fdb_event_notification_data_t& event,
+        _Out_ uint64_t& hash)
+{
+    SWSS_LOG_ENTER();
+
+    hash = event.attr_count;
+
+    for (uint32_t idx = 0; idx < event.attr_count; idx++)
+    {
+        const sai_attribute_t& attr = event.attr[idx];
+
+        auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_FDB_ENTRY, attr.id);
+
+        if (meta == NULL)
+        {
+            return false;
+        }
+
+        hash = mix(hash, attr.id);
+
+        switch (meta->attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                hash = mix(hash, attr.value.oid);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_INT32:
+                hash = mix(hash, (uint32_t)attr.value.s32);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT32:
+                hash = mix(hash, attr.value.u32);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_UINT16:
+                hash = mix(hash, attr.value.u16);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_BOOL:
+                hash = mix(hash, attr.value.booldata);
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_IP_ADDRESS:
+                {
+                    uint64_t words[2] = { 0, 0 };
+
+                    if (attr.value.ipaddr.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+                    {
+                        words[0] = attr.value.ipaddr.addr.ip4;
+                    }
+                    else
+                    {
+                        memcpy(words, attr.value.ipaddr.addr.ip6, sizeof(words));
+                    }
+
+                    hash = mix(hash, attr.value.ipaddr.addr_family);
+                    hash = mix(hash, words[0]);
+                    hash = mix(hash, words[1]);
+                }
+                break;
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool FdbEventFilter::suppress(
+        _In_ const sai_fdb_event_notification_data_t& event)
+{
+    SWSS_LOG_ENTER();
+
+    if (event.event_type == SAI_FDB_EVENT_FLUSHED)
+    {
+        // flushed entries could be learned again
+
+        invalidate();
+
+        m_passed++;
+        return false;
+    }
+
+    uint64_t attributesHash;
+
+    if (!getAttributesHash(event, attributesHash))
+    {
+        m_passed++;
+        return false;
+    }
+
+    uint64_t mac = 0;
+
+    memcpy(&mac, event.fdb_entry.mac_address, sizeof(sai_mac_t));
+
+    uint64_t key = mix(mix(event.fdb_entry.switch_id, event.fdb_entry.bv_id), mac);
+
+    uint64_t signature = mix(mix(mix(key, event.event_type), attributesHash), m_generation.load(std::memory_order_relaxed));
+
+    // zero marks empty slot
+
+    signature = signature ? signature : 1;
+
+    Slot& slot = m_slots[key & m_mask];
+
+    uint64_t timestamp = now();
+
+    if (slot.signature.load(std::memory_order_acquire) == signature &&
+            timestamp - slot.timestamp.load(std::memory_order_relaxed) < m_windowNs)
+    {
+        // window is not extended by duplicates, so repeated event is passed
+        // at least once per window
+
+        m_suppressed++;
+        return true;
+    }
+
+    slot.timestamp.store(timestamp, std::memory_order_relaxed);
+    slot.signature.store(signature, std::memory_order_release);
+
+    m_passed++;
+    return false;
+}
+
+void FdbEventFilter::invalidate()
+{
+    SWSS_LOG_ENTER();
+
+    m_generation++;
+
+    m_invalidated++;
+}
+
+uint32_t FdbEventFilter::getWindow() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_window;
+}
+
+uint64_t FdbEventFilter::getPassedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_passed.load();
+}
+
+uint64_t FdbEventFilter::getSuppressedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_suppressed.load();
+}
+
+uint64_t FdbEventFilter::getInvalidatedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_invalidated.load();
+}
+
+std::string FdbEventFilter::dump() const
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    ss << "window " << m_window << " ms"
+        << " passed " << m_passed.load()
+        << " suppressed " << m_suppressed.load()
+        << " invalidated " << m_invalidated.load();
+
+    return ss.str();
+}
+
+void FdbEventFilter::publish()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_table)
+    {
+        return;
+    }
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("window_ms", std::to_string(m_window));
+    values.emplace_back("passed", std::to_string(m_passed.load()));
+    values.emplace_back("suppressed", std::to_string(m_suppressed.load()));
+    values.emplace_back("invalidated", std::to_string(m_invalidated.load()));
+
+    m_table->set(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, values);
+}
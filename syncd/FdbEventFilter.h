@@ -0,0 +1,171 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief STATE_DB table with notification filter counters, key is
+ * notification name.
+ */
+#define NOTIFICATION_FILTER_TABLE "NOTIFICATION_FILTER"
+
+/**
+ * @brief Interval of publishing FDB event filter counters to STATE_DB (in
+ * seconds).
+ */
+#define FDB_EVENT_FILTER_PUBLISH_INTERVAL (10)
+
+/**
+ * @brief Default number of FDB event filter cache slots.
+ */
+#define DEFAULT_FDB_EVENT_FILTER_SIZE (16 * 1024)
+
+namespace syncd
+{
+    /**
+     * @brief Suppresses repeated FDB events in vendor callback.
+     *
+     * Some vendors report the same event (usually LEARNED) many times while
+     * hardware learning settles. Filter remembers signature of last event of
+     * each FDB entry (switch, bv_id, mac), signature covers event type and
+     * all event attributes, like bridge port. Event equal to last event of
+     * entry seen within window is suppressed before it's copied and queued.
+     *
+     * Any other event of entry replaces remembered one, so event sequences
+     * like LEARNED, AGED, LEARNED are never suppressed. FLUSHED events are
+     * never suppressed and they invalidate whole cache, as well as changes
+     * of FDB entries made by application (see invalidate).
+     *
+     * Cache is fixed size and direct mapped by entry hash, entries colliding
+     * in slot just evict each other, so filter never suppresses more than
+     * exact duplicates. Filter is lock free and can be used from multiple
+     * vendor callback threads.
+     */
+    class FdbEventFilter
+    {
+        private:
+
+            FdbEventFilter(const FdbEventFilter&) = delete;
+            FdbEventFilter& operator=(const FdbEventFilter&) = delete;
+
+        public:
+
+            /**
+             * @param window Duplicates window in milliseconds.
+             * @param dbState STATE_DB connector, counters are not published
+             * when null.
+             * @param size Number of cache slots, rounded up to power of two.
+             */
+            FdbEventFilter(
+                    _In_ uint32_t window,
+                    _In_ std::shared_ptr<swss::DBConnector> dbState,
+                    _In_ size_t size = DEFAULT_FDB_EVENT_FILTER_SIZE);
+
+            virtual ~FdbEventFilter() = default;
+
+        public:
+
+            /**
+             * @brief Check whether event is duplicate of last event of the
+             * same FDB entry and remember event if not.
+             *
+             * @return True if event should be suppressed.
+             */
+            bool suppress(
+                    _In_ const sai_fdb_event_notification_data_t& event);
+
+            /**
+             * @brief Forget all remembered events, next event of every entry
+             * is not suppressed.
+             *
+             * Must be called when FDB entry could change without event, like
+             * when it's removed by application or when event was dropped.
+             */
+            void invalidate();
+
+            uint32_t getWindow() const;
+
+            uint64_t getPassedCount() const;
+
+            uint64_t getSuppressedCount() const;
+
+            uint64_t getInvalidatedCount() const;
+
+            /**
+             * @brief Get summary of counters, like "window 1000 ms passed 10
+             * suppressed 2 invalidated 1".
+             */
+            std::string dump() const;
+
+            /**
+             * @brief Write counters to STATE_DB.
+             */
+            void publish();
+
+        private:
+
+            /**
+             * @brief Compute hash of event attributes.
+             *
+             * @return False if event has attribute which value can't be
+             * hashed, such event is never suppressed.
+             */
+            static bool getAttributesHash(
+                    _In_ const sai_fdb_event_notification_data_t& event,
+                    _Out_ uint64_t& hash);
+
+            static uint64_t mix(
+                    _In_ uint64_t hash,
+                    _In_ uint64_t value);
+
+            static uint64_t now();
+
+        private:
+
+            typedef struct _Slot
+            {
+                /**
+                 * @brief Signature of last event, zero when slot is empty.
+                 */
+                std::atomic<uint64_t> signature;
+
+                /**
+                 * @brief Time when event was seen, nanoseconds of steady
+                 * clock.
+                 */
+                std::atomic<uint64_t> timestamp;
+
+            } Slot;
+
+            uint32_t m_window;
+
+            uint64_t m_windowNs;
+
+            std::vector<Slot> m_slots;
+
+            size_t m_mask;
+
+            /**
+             * @brief Part of event signature, incremented on invalidate, so
+             * all remembered signatures become stale at once.
+             */
+            std::atomic<uint64_t> m_generation;
+
+            std::atomic<uint64_t> m_passed;
+
+            std::atomic<uint64_t> m_suppressed;
+
+            std::atomic<uint64_t> m_invalidated;
+
+            std::shared_ptr<swss::Table> m_table;
+    };
+}
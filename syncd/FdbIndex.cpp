@@ -0,0 +1,291 @@
+#include "FdbIndex.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+#define FDB_KEY_PREFIX "SAI_OBJECT_TYPE_FDB_ENTRY:"
+
+FdbIndex::FdbIndex()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool FdbIndex::isFdbKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    return key.compare(0, sizeof(FDB_KEY_PREFIX) - 1, FDB_KEY_PREFIX) == 0;
+}
+
+void FdbIndex::setEntry(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    if (!isFdbKey(key))
+    {
+        return;
+    }
+
+    auto& entry = getOrCreateEntry(key);
+
+    for (const auto& fv: values)
+    {
+        updateAttribute(key, entry, fvField(fv), fvValue(fv));
+    }
+}
+
+void FdbIndex::setEntryAttribute(
+        _In_ const std::string& key,
+        _In_ const std::string& attr,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (!isFdbKey(key))
+    {
+        return;
+    }
+
+    auto& entry = getOrCreateEntry(key);
+
+    updateAttribute(key, entry, attr, value);
+}
+
+void FdbIndex::removeEntry(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it == m_entries.end())
+    {
+        return;
+    }
+
+    removeFromSet(m_byBvId, it->second.bvId, key);
+    removeFromSet(m_byBridgePortId, it->second.bridgePortId, key);
+
+    m_entries.erase(it);
+}
+
+void FdbIndex::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+    m_byBvId.clear();
+    m_byBridgePortId.clear();
+}
+
+size_t FdbIndex::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.size();
+}
+
+const FdbIndex::Entry* FdbIndex::getEntry(
+        _In_ const std::string& key) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it == m_entries.end())
+    {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+std::vector<std::string> FdbIndex::flush(
+        _In_ sai_object_id_t bridgePortId,
+        _In_ sai_object_id_t bvId,
+        _In_ sai_fdb_flush_entry_type_t type)
+{
+    SWSS_LOG_ENTER();
+
+    bool flushDynamic = (type == SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC || type == SAI_FDB_FLUSH_ENTRY_TYPE_ALL);
+    bool flushStatic = (type == SAI_FDB_FLUSH_ENTRY_TYPE_STATIC || type == SAI_FDB_FLUSH_ENTRY_TYPE_ALL);
+
+    if (!flushDynamic && !flushStatic)
+    {
+        SWSS_LOG_THROW("unknown fdb flush entry type: %d", type);
+    }
+
+    std::vector<std::string> keys;
+
+    auto match = [&](const std::string& key, const Entry& entry)
+    {
+        if (bridgePortId != SAI_NULL_OBJECT_ID && entry.bridgePortId != bridgePortId)
+            return;
+
+        if (bvId != SAI_NULL_OBJECT_ID && entry.bvId != bvId)
+            return;
+
+        if ((entry.type == ENTRY_TYPE_DYNAMIC && flushDynamic) ||
+                (entry.type == ENTRY_TYPE_STATIC && flushStatic))
+        {
+            keys.push_back(key);
+        }
+    };
+
+    // select smallest candidate set, remaining filters are checked per entry
+
+    const std::unordered_set<std::string>* candidates = nullptr;
+
+    if (bridgePortId != SAI_NULL_OBJECT_ID)
+    {
+        auto it = m_byBridgePortId.find(bridgePortId);
+
+        if (it == m_byBridgePortId.end())
+        {
+            return keys;
+        }
+
+        candidates = &it->second;
+    }
+
+    if (bvId != SAI_NULL_OBJECT_ID)
+    {
+        auto it = m_byBvId.find(bvId);
+
+        if (it == m_byBvId.end())
+        {
+            return keys;
+        }
+
+        if (candidates == nullptr || it->second.size() < candidates->size())
+        {
+            candidates = &it->second;
+        }
+    }
+
+    if (candidates)
+    {
+        for (const auto& key: *candidates)
+        {
+            match(key, m_entries.at(key));
+        }
+    }
+    else
+    {
+        for (const auto& kvp: m_entries)
+        {
+            match(kvp.first, kvp.second);
+        }
+    }
+
+    for (const auto& key: keys)
+    {
+        removeEntry(key);
+    }
+
+    SWSS_LOG_INFO("flushed %zu fdb entries from index, %zu left", keys.size(), m_entries.size());
+
+    return keys;
+}
+
+FdbIndex::Entry& FdbIndex::getOrCreateEntry(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(key);
+
+    if (it != m_entries.end())
+    {
+        return it->second;
+    }
+
+    sai_object_meta_key_t metaKey;
+
+    sai_deserialize_object_meta_key(key, metaKey);
+
+    auto& entry = m_entries[key];
+
+    entry.bvId = metaKey.objectkey.key.fdb_entry.bv_id;
+    entry.bridgePortId = SAI_NULL_OBJECT_ID;
+    entry.type = ENTRY_TYPE_UNKNOWN;
+
+    m_byBvId[entry.bvId].insert(key);
+
+    return entry;
+}
+
+void FdbIndex::updateAttribute(
+        _In_ const std::string& key,
+        _Inout_ Entry& entry,
+        _In_ const std::string& attr,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (attr == "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID")
+    {
+        sai_object_id_t bridgePortId;
+
+        sai_deserialize_object_id(value, bridgePortId);
+
+        if (bridgePortId == entry.bridgePortId)
+        {
+            return;
+        }
+
+        removeFromSet(m_byBridgePortId, entry.bridgePortId, key);
+
+        entry.bridgePortId = bridgePortId;
+
+        if (bridgePortId != SAI_NULL_OBJECT_ID)
+        {
+            m_byBridgePortId[bridgePortId].insert(key);
+        }
+    }
+    else if (attr == "SAI_FDB_ENTRY_ATTR_TYPE")
+    {
+        if (value == "SAI_FDB_ENTRY_TYPE_DYNAMIC")
+        {
+            entry.type = ENTRY_TYPE_DYNAMIC;
+        }
+        else if (value == "SAI_FDB_ENTRY_TYPE_STATIC")
+        {
+            entry.type = ENTRY_TYPE_STATIC;
+        }
+        else
+        {
+            entry.type = ENTRY_TYPE_UNKNOWN;
+        }
+    }
+}
+
+void FdbIndex::removeFromSet(
+        _Inout_ std::unordered_map<sai_object_id_t, std::unordered_set<std::string>>& index,
+        _In_ sai_object_id_t id,
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = index.find(id);
+
+    if (it == index.end())
+    {
+        return;
+    }
+
+    it->second.erase(key);
+
+    if (it->second.empty())
+    {
+        index.erase(it);
+    }
+}
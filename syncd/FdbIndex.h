@@ -0,0 +1,131 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/table.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Index of FDB entries present in ASIC_STATE.
+     *
+     * Index is keyed by serialized object meta key (without table prefix)
+     * and maintained from every FDB entry write to ASIC_STATE, so FDB
+     * flush can compute exact set of keys to remove without scanning
+     * database keyspace.
+     *
+     * Entries are matched during flush the same way as fdb_flush.lua
+     * script does: by bridge port and FDB entry type, entries without
+     * type attribute are never flushed.
+     */
+    class FdbIndex
+    {
+        private:
+
+            FdbIndex(const FdbIndex&) = delete;
+            FdbIndex& operator=(const FdbIndex&) = delete;
+
+        public:
+
+            typedef enum _EntryType
+            {
+                ENTRY_TYPE_UNKNOWN,
+
+                ENTRY_TYPE_DYNAMIC,
+
+                ENTRY_TYPE_STATIC,
+
+            } EntryType;
+
+            typedef struct _Entry
+            {
+                sai_object_id_t bvId;
+
+                sai_object_id_t bridgePortId;
+
+                EntryType type;
+
+            } Entry;
+
+        public:
+
+            FdbIndex();
+
+            virtual ~FdbIndex() = default;
+
+        public:
+
+            /**
+             * @brief Check if serialized object meta key is FDB entry key.
+             */
+            static bool isFdbKey(
+                    _In_ const std::string& key);
+
+            /**
+             * @brief Create entry or update its attributes, same as HMSET.
+             *
+             * Keys of other object types are ignored.
+             */
+            void setEntry(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            void setEntryAttribute(
+                    _In_ const std::string& key,
+                    _In_ const std::string& attr,
+                    _In_ const std::string& value);
+
+            void removeEntry(
+                    _In_ const std::string& key);
+
+            void clear();
+
+            size_t size() const;
+
+            const Entry* getEntry(
+                    _In_ const std::string& key) const;
+
+            /**
+             * @brief Remove entries matching flush from index.
+             *
+             * Null port or bv id matches all entries.
+             *
+             * @return Keys of removed entries.
+             */
+            std::vector<std::string> flush(
+                    _In_ sai_object_id_t bridgePortId,
+                    _In_ sai_object_id_t bvId,
+                    _In_ sai_fdb_flush_entry_type_t type);
+
+        private:
+
+            Entry& getOrCreateEntry(
+                    _In_ const std::string& key);
+
+            void updateAttribute(
+                    _In_ const std::string& key,
+                    _Inout_ Entry& entry,
+                    _In_ const std::string& attr,
+                    _In_ const std::string& value);
+
+            void removeFromSet(
+                    _Inout_ std::unordered_map<sai_object_id_t, std::unordered_set<std::string>>& index,
+                    _In_ sai_object_id_t id,
+                    _In_ const std::string& key);
+
+        private:
+
+            std::unordered_map<std::string, Entry> m_entries;
+
+            std::unordered_map<sai_object_id_t, std::unordered_set<std::string>> m_byBvId;
+
+            std::unordered_map<sai_object_id_t, std::unordered_set<std::string>> m_byBridgePortId;
+    };
+}
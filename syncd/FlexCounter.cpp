@@ -1,5 +1,6 @@
 #include "FlexCounter.h"
 #include "VidManager.h"
+#include "CounterPublishBuffer.h"
 
 #include "meta/sai_serialize.h"
 
@@ -14,6 +15,8 @@ using namespace std;
 
 #define MUTEX std::unique_lock<std::mutex> _lock(m_mtx);
 #define MUTEX_UNLOCK _lock.unlock();
+#define POLL_MUTEX std::unique_lock<std::mutex> _pollLock(m_pollMtx);
+
 
 static const std::string COUNTER_TYPE_PORT = "Port Counter";
 static const std::string COUNTER_TYPE_PORT_DEBUG = "Port Debug Counter";
@@ -31,6 +34,9 @@ static const std::string ATTR_TYPE_PG = "Priority Group Attribute";
 static const std::string ATTR_TYPE_MACSEC_SA = "MACSEC SA Attribute";
 static const std::string ATTR_TYPE_ACL_COUNTER = "ACL Counter Attribute";
 
+// name of scheduler job polling contexts without own poll interval
+static const std::string GROUP_POLL_JOB = "";
+
 BaseCounterContext::BaseCounterContext(const std::string &name):
 m_name(name)
 {
@@ -54,6 +60,87 @@ void BaseCounterContext::addPlugins(
             SWSS_LOG_ERROR("Plugin %s already registered", sha.c_str());
         }
     }
+
+    stagePlugins();
+}
+
+void BaseCounterContext::removePlugins()
+{
+    SWSS_LOG_ENTER();
+
+    m_plugins.clear();
+
+    stagePlugins();
+}
+
+void BaseCounterContext::stagePlugins()
+{
+    SWSS_LOG_ENTER();
+
+    auto plugins = m_plugins;
+
+    stageChange([this, plugins]() { m_polledPlugins = plugins; });
+}
+
+std::vector<std::function<void()>> BaseCounterContext::takeChanges()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::function<void()>> changes;
+
+    changes.swap(m_changes);
+
+    return changes;
+}
+
+std::map<sai_object_id_t, std::string> BaseCounterContext::takeRemovedObjects()
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_id_t, std::string> removed;
+
+    removed.swap(m_removedObjects);
+
+    return removed;
+}
+
+void BaseCounterContext::stageChange(
+        _In_ const std::function<void()>& change)
+{
+    SWSS_LOG_ENTER();
+
+    m_changes.push_back(change);
+}
+
+void BaseCounterContext::stageRemoval(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    if (polling)
+    {
+        // running poll may still write counters of this object
+
+        m_removedObjects.emplace(vid, "");
+    }
+}
+
+bool BaseCounterContext::stageRatesRemoval(
+        _In_ sai_object_id_t vid,
+        _In_ const std::string &ratePrefix)
+{
+    SWSS_LOG_ENTER();
+
+    if (!polling)
+    {
+        return false;
+    }
+
+    // rate engine or plugins of running poll may still write rates
+
+    m_removedObjects[vid] = ratePrefix;
+
+    return true;
 }
 
 template <typename StatType,
@@ -74,6 +161,7 @@ struct CounterIds
     }
     sai_object_id_t rid;
     std::vector<StatType> counter_ids;
+    std::vector<uint64_t> last_values;
 };
 
 // CounterIds structure contains stats mode, now buffer pool is the only one
@@ -102,6 +190,7 @@ struct CounterIds<StatType, typename std::enable_if_t<std::is_same<StatType, sai
     }
     sai_object_id_t rid;
     std::vector<StatType> counter_ids;
+    std::vector<uint64_t> last_values;
     sai_stats_mode_t stats_mode;
 };
 
@@ -126,6 +215,11 @@ struct BulkStatsContext
     std::vector<StatType> counter_ids;
     std::vector<sai_status_t> object_statuses;
     std::vector<uint64_t> counters;
+    // last published counters, layout same as counters, cleared when
+    // objects are added or removed
+    std::vector<uint64_t> last_counters;
+    // per object flag, set when object counters are in last_counters
+    std::vector<bool> published;
 };
 
 // TODO: use if const expression when cpp17 is supported
@@ -375,7 +469,7 @@ public:
             _In_ sai_object_type_t object_type,
             _In_ sairedis::SaiInterface *vendor_sai,
             _In_ sai_stats_mode_t &stats_mode):
-    BaseCounterContext(name), m_objectType(object_type), m_vendorSai(vendor_sai), m_groupStatsMode(stats_mode)
+    BaseCounterContext(name), m_objectType(object_type), m_vendorSai(vendor_sai), m_groupStatsMode(stats_mode), m_publishBuffer(getStatName)
     {
         SWSS_LOG_ENTER();
     }
@@ -422,7 +516,7 @@ public:
             counter_ids.push_back(stat);
         }
 
-        updateSupportedCounters(rid, counter_ids, effective_stats_mode);
+        updateSupportedCounters(vid, rid, counter_ids, effective_stats_mode);
 
         std::vector<StatType> supportedIds;
         for (auto &counter : counter_ids)
@@ -449,9 +543,6 @@ public:
             }
         }
 
-         // Perform a remove and re-add to simplify the logic here
-        removeObject(vid, false);
-
         bool supportBulk;
         // TODO: use if const expression when cpp17 is supported
         if (HasStatsMode<CounterIdsType>::value)
@@ -463,6 +554,48 @@ public:
             supportBulk = checkBulkCapability(vid, rid, supportedIds);
         }
 
+        m_objects.insert(vid);
+
+        stageChange([this, vid, rid, supportedIds, instance_stats_mode, supportBulk]() {
+            addPolledObject(vid, rid, supportedIds, instance_stats_mode, supportBulk);
+        });
+    }
+
+    void removeObject(
+            _In_ sai_object_id_t vid) override
+    {
+        SWSS_LOG_ENTER();
+
+        if (m_objects.erase(vid) == 0)
+        {
+            SWSS_LOG_NOTICE("Trying to remove nonexisting %s %s",
+                sai_serialize_object_type(m_objectType).c_str(),
+                sai_serialize_object_id(vid).c_str());
+            return;
+        }
+
+        stageRemoval(vid);
+
+        stageChange([this, vid]() { removePolledObject(vid); });
+
+        if (supported_counters_cache && always_check_supported_counters)
+        {
+            supported_counters_cache->removeObject(m_objectType, vid);
+        }
+    }
+
+    void addPolledObject(
+            _In_ sai_object_id_t vid,
+            _In_ sai_object_id_t rid,
+            _In_ std::vector<StatType> supportedIds,
+            _In_ sai_stats_mode_t instance_stats_mode,
+            _In_ bool supportBulk)
+    {
+        SWSS_LOG_ENTER();
+
+         // Perform a remove and re-add to simplify the logic here
+        removePolledObject(vid);
+
         if (!supportBulk)
         {
             auto counter_data = std::make_shared<CounterIds<StatType>>(rid, supportedIds);
@@ -481,19 +614,25 @@ public:
         }
     }
 
-    void removeObject(
-            _In_ sai_object_id_t vid) override
+    void removePolledObject(
+            _In_ sai_object_id_t vid)
     {
         SWSS_LOG_ENTER();
 
-        removeObject(vid, true);
-    }
+        if (rate_engine)
+        {
+            rate_engine->removeObject(vid);
+        }
 
-    void removeObject(
-            _In_ sai_object_id_t vid,
-            _In_ bool log)
-    {
-        SWSS_LOG_ENTER();
+        if (counter_ring)
+        {
+            counter_ring->removeObject(vid);
+        }
+
+        if (aggregator)
+        {
+            aggregator->removeObject(vid);
+        }
 
         auto iter = m_objectIdsMap.find(vid);
         if (iter != m_objectIdsMap.end())
@@ -502,12 +641,7 @@ public:
         }
         else
         {
-            if (!removeBulkStatsContext(vid) && log)
-            {
-                SWSS_LOG_NOTICE("Trying to remove nonexisting %s %s",
-                    sai_serialize_object_type(m_objectType).c_str(),
-                    sai_serialize_object_id(vid).c_str());
-            }
+            removeBulkStatsContext(vid);
         }
     }
 
@@ -516,6 +650,7 @@ public:
     {
         SWSS_LOG_ENTER();
         sai_stats_mode_t effective_stats_mode = m_groupStatsMode;
+        bool rates = rate_engine && rate_engine->refresh();
         for (const auto &kv : m_objectIdsMap)
         {
             const auto &vid = kv.first;
@@ -535,18 +670,43 @@ public:
                 continue;
             }
 
-            std::vector<swss::FieldValueTuple> values;
-            for (size_t i = 0; i != statIds.size(); i++)
+            if (aggregator)
             {
-                values.emplace_back(serializeStat(statIds[i]), std::to_string(stats[i]));
+                aggregator->update(vid, static_cast<uint32_t>(statIds.size()), reinterpret_cast<const sai_stat_id_t *>(statIds.data()), stats.data());
+            }
+            else
+            {
+                auto &last_values = kv.second->last_values;
+                bool changed_only = preparePublishCache(last_values, statIds.size());
+
+                publishStats(countersTable, vid, statIds, stats.data(), last_values.empty() ? nullptr : last_values.data(), changed_only);
+            }
+
+            if (rates)
+            {
+                rate_engine->update(vid, static_cast<uint32_t>(statIds.size()), reinterpret_cast<const sai_stat_id_t *>(statIds.data()), stats.data());
+            }
+
+            if (counter_ring)
+            {
+                counter_ring->append(vid, static_cast<uint32_t>(statIds.size()), reinterpret_cast<const sai_stat_id_t *>(statIds.data()), stats.data(), getStatName);
             }
-            countersTable.set(sai_serialize_object_id(vid), values, "");
         }
 
         for (const auto &kv : m_bulkContexts)
         {
             bulkCollectData(countersTable, *kv.second.get());
         }
+
+        if (aggregator)
+        {
+            publishAggregatedStats(countersTable);
+        }
+
+        if (rates)
+        {
+            rate_engine->flush();
+        }
     }
 
     void runPlugin(
@@ -555,10 +715,13 @@ public:
     {
         SWSS_LOG_ENTER();
 
-        if (!hasObject())
+        if (!hasPolledObject())
         {
             return;
         }
+
+        bool rates = rate_engine && rate_engine->isActive();
+
         std::vector<std::string> idStrings;
         idStrings.reserve(m_objectIdsMap.size());
         std::transform(m_objectIdsMap.begin(),
@@ -574,12 +737,19 @@ public:
                            [] (auto &vid) { return sai_serialize_object_id(vid); });
         }
 
-        std::for_each(m_plugins.begin(),
-                      m_plugins.end(),
-                      [&] (auto &sha) { runRedisScript(counters_db, sha, idStrings, argv); });
+        for (const auto &sha : m_polledPlugins)
+        {
+            if (rates && rate_plugins.count(sha))
+            {
+                // rates already computed during collect
+                continue;
+            }
+
+            runRedisScript(counters_db, sha, idStrings, argv);
+        }
     }
 
-    bool hasObject() const override
+    bool hasPolledObject() const override
     {
         SWSS_LOG_ENTER();
         return !m_objectIdsMap.empty() || !m_bulkContexts.empty();
@@ -679,38 +849,223 @@ private:
     {
         SWSS_LOG_ENTER();
         auto statsMode = m_groupStatsMode == SAI_STATS_MODE_READ ? SAI_STATS_MODE_BULK_READ : SAI_STATS_MODE_BULK_READ_AND_CLEAR;
+        size_t objectCount = ctx.object_keys.size();
+
+        if (bulk_chunk_scheduler && bulk_chunk_size && objectCount > bulk_chunk_size)
+        {
+            // chunks are writing to disjoint parts of context, values are
+            // published when all chunks are collected
+
+            std::vector<FlexCounterScheduler::JobFunction> chunks;
+
+            for (size_t offset = 0; offset < objectCount; offset += bulk_chunk_size)
+            {
+                size_t count = std::min<size_t>(bulk_chunk_size, objectCount - offset);
+
+                chunks.push_back([this, &ctx, statsMode, offset, count]() {
+                    bulkCollectChunk(ctx, statsMode, offset, count);
+                });
+            }
+
+            bulk_chunk_scheduler->runTasks(chunks);
+        }
+        else
+        {
+            bulkCollectChunk(ctx, statsMode, 0, objectCount);
+        }
+
+        bool changed_only = preparePublishCache(ctx.last_counters, ctx.counters.size());
+
+        if (!changed_only)
+        {
+            ctx.published.assign(publish_changed_only ? ctx.object_keys.size() : 0, false);
+        }
+
+        for (size_t i = 0; i < ctx.object_keys.size(); i++)
+        {
+            if (SAI_STATUS_SUCCESS != ctx.object_statuses[i])
+            {
+                SWSS_LOG_ERROR("Failed to get stats of %s 0x%" PRIx64 ": %d", m_name.c_str(), ctx.object_keys[i].key.object_id, ctx.object_statuses[i]);
+                continue;
+            }
+            const auto &vid = ctx.object_vids[i];
+            size_t offset = i * ctx.counter_ids.size();
+
+            if (aggregator)
+            {
+                aggregator->update(vid,
+                        static_cast<uint32_t>(ctx.counter_ids.size()),
+                        reinterpret_cast<const sai_stat_id_t *>(ctx.counter_ids.data()),
+                        &ctx.counters[offset]);
+                continue;
+            }
+
+            if (!publish_changed_only)
+            {
+                publishStats(countersTable, vid, ctx.counter_ids, &ctx.counters[offset], nullptr, false);
+                continue;
+            }
+
+            // object which failed on previous polls has no valid cache yet
+            publishStats(countersTable, vid, ctx.counter_ids, &ctx.counters[offset], &ctx.last_counters[offset], changed_only && ctx.published[i]);
+
+            ctx.published[i] = true;
+        }
+
+        if (rate_engine && rate_engine->isActive())
+        {
+            for (size_t i = 0; i < ctx.object_keys.size(); i++)
+            {
+                if (SAI_STATUS_SUCCESS == ctx.object_statuses[i])
+                {
+                    rate_engine->update(ctx.object_vids[i],
+                            static_cast<uint32_t>(ctx.counter_ids.size()),
+                            reinterpret_cast<const sai_stat_id_t *>(ctx.counter_ids.data()),
+                            &ctx.counters[i * ctx.counter_ids.size()]);
+                }
+            }
+        }
+
+        if (counter_ring)
+        {
+            for (size_t i = 0; i < ctx.object_keys.size(); i++)
+            {
+                if (SAI_STATUS_SUCCESS == ctx.object_statuses[i])
+                {
+                    counter_ring->append(ctx.object_vids[i],
+                            static_cast<uint32_t>(ctx.counter_ids.size()),
+                            reinterpret_cast<const sai_stat_id_t *>(ctx.counter_ids.data()),
+                            &ctx.counters[i * ctx.counter_ids.size()],
+                            getStatName);
+                }
+            }
+        }
+    }
+
+    static std::string getStatName(
+            _In_ sai_stat_id_t statId)
+    {
+        SWSS_LOG_ENTER();
+
+        return serializeStat(static_cast<StatType>(statId));
+    }
+
+    void bulkCollectChunk(
+            _Inout_ BulkContextType &ctx,
+            _In_ sai_stats_mode_t statsMode,
+            _In_ size_t offset,
+            _In_ size_t count)
+    {
+        SWSS_LOG_ENTER();
+
         sai_status_t status = m_vendorSai->bulkGetStats(
                             SAI_NULL_OBJECT_ID,
                             m_objectType,
-                            static_cast<uint32_t>(ctx.object_keys.size()),
-                            ctx.object_keys.data(),
+                            static_cast<uint32_t>(count),
+                            &ctx.object_keys[offset],
                             static_cast<uint32_t>(ctx.counter_ids.size()),
                             reinterpret_cast<const sai_stat_id_t *>(ctx.counter_ids.data()),
                             statsMode,
-                            ctx.object_statuses.data(),
-                            ctx.counters.data());
+                            &ctx.object_statuses[offset],
+                            &ctx.counters[offset * ctx.counter_ids.size()]);
         if (SAI_STATUS_SUCCESS != status)
         {
-            SWSS_LOG_WARN("Failed to bulk get stats for %s: %u", m_name.c_str(), status);
+            SWSS_LOG_WARN("Failed to bulk get stats for %s objects %zu-%zu: %u", m_name.c_str(), offset, offset + count - 1, status);
         }
+    }
 
-        std::vector<swss::FieldValueTuple> values;
-        for (size_t i = 0; i < ctx.object_keys.size(); i++)
+    bool preparePublishCache(
+            _Inout_ std::vector<uint64_t> &cache,
+            _In_ size_t size)
+    {
+        SWSS_LOG_ENTER();
+
+        if (!publish_changed_only)
         {
-            if (SAI_STATUS_SUCCESS != ctx.object_statuses[i])
+            // values published now would not be tracked by cache
+            std::vector<uint64_t>().swap(cache);
+            return false;
+        }
+
+        if (cache.size() != size)
+        {
+            cache.assign(size, 0);
+            return false;
+        }
+
+        return !publish_full_refresh;
+    }
+
+    void publishStats(
+            _In_ swss::Table &countersTable,
+            _In_ sai_object_id_t vid,
+            _In_ const std::vector<StatType> &counter_ids,
+            _In_ const uint64_t *stats,
+            _Inout_ uint64_t *last_values,
+            _In_ bool changed_only)
+    {
+        SWSS_LOG_ENTER();
+
+        m_publishBuffer.clear();
+
+        for (size_t i = 0; i != counter_ids.size(); i++)
+        {
+            if (last_values)
+            {
+                if (changed_only && last_values[i] == stats[i])
+                {
+                    continue;
+                }
+
+                last_values[i] = stats[i];
+            }
+
+            m_publishBuffer.add(static_cast<sai_stat_id_t>(counter_ids[i]), stats[i]);
+        }
+
+        if (m_publishBuffer.empty())
+        {
+            return;
+        }
+
+        m_publishBuffer.publish(countersTable, sai_serialize_object_id(vid));
+    }
+
+    void publishAggregatedStats(
+            _In_ swss::Table &countersTable)
+    {
+        SWSS_LOG_ENTER();
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (!aggregator->isWindowComplete(now))
+        {
+            return;
+        }
+
+        // window values are always published in full, publish mode is
+        // not applied
+
+        for (const auto &kv : aggregator->getWindows())
+        {
+            const auto &window = kv.second;
+
+            if (window.samples == 0)
             {
-                SWSS_LOG_ERROR("Failed to get stats of %s 0x%" PRIx64 ": %d", m_name.c_str(), ctx.object_keys[i].key.object_id, ctx.object_statuses[i]);
                 continue;
             }
-            const auto &vid = ctx.object_vids[i];
 
-            for (size_t j = 0; j < ctx.counter_ids.size(); j++)
+            m_publishBuffer.clear();
+
+            for (size_t i = 0; i != window.statIds.size(); i++)
             {
-                values.emplace_back(serializeStat(ctx.counter_ids[j]), std::to_string(ctx.counters[i * ctx.counter_ids.size() + j]));
+                m_publishBuffer.add(window.statIds[i], window.values[i]);
             }
-            countersTable.set(sai_serialize_object_id(vid), values, "");
-            values.clear();
+
+            m_publishBuffer.publish(countersTable, sai_serialize_object_id(kv.first));
         }
+
+        aggregator->startWindow(now);
     }
 
     auto getBulkStatsContext(
@@ -744,6 +1099,7 @@ private:
         }
         ctx.object_statuses.push_back(SAI_STATUS_SUCCESS);
         ctx.counters.resize(counterIds.size() * ctx.object_keys.size());
+        ctx.last_counters.clear();
     }
 
     bool removeBulkStatsContext(
@@ -773,6 +1129,7 @@ private:
                 ctx.object_keys.erase(key_iter);
                 ctx.counters.resize(ctx.counter_ids.size() * ctx.object_keys.size());
                 ctx.object_statuses.pop_back();
+                ctx.last_counters.clear();
             }
             break;
         }
@@ -803,6 +1160,7 @@ private:
     }
 
     void updateSupportedCounters(
+            _In_ sai_object_id_t vid,
             _In_ sai_object_id_t rid,
             _In_ const std::vector<StatType>& counter_ids,
             _In_ sai_stats_mode_t stats_mode)
@@ -819,14 +1177,76 @@ private:
             m_supportedCounters.clear();
         }
 
+        // support may differ per object when it's always checked, such
+        // contexts cache results per object, by VID, since RID could be
+        // reused by other object after cold start or port breakout
+        sai_object_id_t cacheObjectId = always_check_supported_counters ? vid : SAI_NULL_OBJECT_ID;
+
+        if (supported_counters_cache && loadSupportedCounters(cacheObjectId, counter_ids, stats_mode))
+        {
+            return;
+        }
+
         if (!use_sai_stats_capa_query || querySupportedCounters(rid, stats_mode) != SAI_STATUS_SUCCESS)
         {
             /* Fallback to legacy approach */
             getSupportedCounters(rid, counter_ids, stats_mode);
         }
+
+        if (supported_counters_cache)
+        {
+            storeSupportedCounters(cacheObjectId, counter_ids, stats_mode);
+        }
     }
 
-    sai_status_t querySupportedCounters(
+    bool loadSupportedCounters(
+            _In_ sai_object_id_t cacheObjectId,
+            _In_ const std::vector<StatType>& counter_ids,
+            _In_ sai_stats_mode_t stats_mode)
+    {
+        SWSS_LOG_ENTER();
+
+        std::set<StatType> supportedCounters;
+
+        for (const auto &counter : counter_ids)
+        {
+            bool supported;
+
+            if (!supported_counters_cache->getSupported(m_objectType, cacheObjectId, stats_mode, serializeStat(counter), supported))
+            {
+                // not all counters were discovered before
+                return false;
+            }
+
+            if (supported)
+            {
+                supportedCounters.insert(counter);
+            }
+        }
+
+        m_supportedCounters.insert(supportedCounters.begin(), supportedCounters.end());
+
+        SWSS_LOG_INFO("%s supported counters loaded from cache", m_name.c_str());
+
+        return true;
+    }
+
+    void storeSupportedCounters(
+            _In_ sai_object_id_t cacheObjectId,
+            _In_ const std::vector<StatType>& counter_ids,
+            _In_ sai_stats_mode_t stats_mode)
+    {
+        SWSS_LOG_ENTER();
+
+        // cache is written to file by poller, not for each added object
+
+        for (const auto &counter : counter_ids)
+        {
+            supported_counters_cache->setSupported(m_objectType, cacheObjectId, stats_mode, serializeStat(counter), isCounterSupported(counter));
+        }
+    }
+
+    sai_status_t querySupportedCounters(
             _In_ sai_object_id_t rid,
             _In_ sai_stats_mode_t stats_mode)
     {
@@ -907,6 +1327,9 @@ protected:
     std::set<StatType> m_supportedCounters;
     std::map<sai_object_id_t, std::shared_ptr<CounterIdsType>> m_objectIdsMap;
     std::map<std::vector<StatType>, std::shared_ptr<BulkContextType>> m_bulkContexts;
+
+    // context is polled by single job at a time
+    CounterPublishBuffer m_publishBuffer;
 };
 
 template <typename AttrType>
@@ -942,15 +1365,19 @@ public:
             attrIds.push_back(attr);
         }
 
-        auto it = Base::m_objectIdsMap.find(vid);
-        if (it != Base::m_objectIdsMap.end())
-        {
-            it->second->counter_ids = attrIds;
-            return;
-        }
+        Base::m_objects.insert(vid);
 
-        auto attr_ids = std::make_shared<AttrIdsType>(rid, attrIds);
-        Base::m_objectIdsMap.emplace(vid, attr_ids);
+        Base::stageChange([this, vid, rid, attrIds]() {
+            auto it = Base::m_objectIdsMap.find(vid);
+            if (it != Base::m_objectIdsMap.end())
+            {
+                it->second->counter_ids = attrIds;
+                return;
+            }
+
+            auto attr_ids = std::make_shared<AttrIdsType>(rid, attrIds);
+            Base::m_objectIdsMap.emplace(vid, attr_ids);
+        });
     }
 
     void collectData(
@@ -1002,26 +1429,79 @@ public:
 FlexCounter::FlexCounter(
         _In_ const std::string& instanceId,
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
-        _In_ const std::string& dbCounters):
-    m_readyToPoll(false),
+        _In_ const std::string& dbCounters,
+        _In_ std::shared_ptr<FlexCounterScheduler> scheduler,
+        _In_ std::shared_ptr<SupportedCountersCache> supportedCountersCache):
     m_pollInterval(0),
+    m_pollJitter(0),
     m_instanceId(instanceId),
     m_vendorSai(vendorSai),
-    m_dbCounters(dbCounters)
+    m_dbCounters(dbCounters),
+    m_publishChangedOnly(false),
+    m_fullRefreshInterval(DEFAULT_FULL_REFRESH_INTERVAL),
+    m_nativeRates(false),
+    m_bulkChunkSize(0),
+    m_ringSize(0),
+    m_ringMaxSeries(DEFAULT_RING_MAX_SERIES),
+    m_scheduler(scheduler),
+    m_supportedCountersCache(supportedCountersCache)
 {
     SWSS_LOG_ENTER();
 
     m_enable = false;
     m_isDiscarded = false;
 
-    startFlexCounterThread();
+    if (m_scheduler == nullptr)
+    {
+        m_scheduler = std::make_shared<FlexCounterScheduler>(1);
+    }
+
+    // used only by scheduler jobs, which are serialized by flex counter mutex
+
+    m_db = std::make_shared<swss::DBConnector>(m_dbCounters, 0);
+    m_pipeline = std::make_shared<swss::RedisPipeline>(m_db.get());
+    m_countersTable = std::make_shared<swss::Table>(m_pipeline.get(), COUNTERS_TABLE, true);
+    m_ratesTable = std::make_shared<swss::Table>(m_pipeline.get(), RATES_TABLE, true);
 }
 
 FlexCounter::~FlexCounter(void)
 {
     SWSS_LOG_ENTER();
 
-    endFlexCounterThread();
+    std::vector<FlexCounterScheduler::JobId> jobs;
+    std::vector<FlexCounterScheduler::JobId> removed;
+
+    {
+        MUTEX;
+
+        for (auto& kv: m_contextSchedule)
+        {
+            if (kv.second.jobId != FlexCounterScheduler::INVALID_JOB_ID)
+            {
+                jobs.push_back(kv.second.jobId);
+            }
+        }
+
+        m_contextSchedule.clear();
+
+        removed.assign(m_removedJobs.begin(), m_removedJobs.end());
+
+        m_removedJobs.clear();
+    }
+
+    // NOTE: wait without lock, running job may be waiting for it
+
+    for (auto id: jobs)
+    {
+        m_scheduler->removeJob(id, true);
+    }
+
+    // jobs removed by configuration change could be still running
+
+    for (auto id: removed)
+    {
+        m_scheduler->waitJob(id);
+    }
 }
 
 void FlexCounter::setPollInterval(
@@ -1032,6 +1512,120 @@ void FlexCounter::setPollInterval(
     m_pollInterval = pollInterval;
 }
 
+void FlexCounter::setPollJitter(
+        _In_ uint32_t pollJitter)
+{
+    SWSS_LOG_ENTER();
+
+    m_pollJitter = pollJitter;
+}
+
+void FlexCounter::setContextPollInterval(
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::string, ContextPollInterval> contextPollInterval;
+
+    for (auto& entry: swss::tokenize(value, ','))
+    {
+        auto items = swss::tokenize(entry, ':');
+
+        if (items.size() < 2 || items.size() > 3)
+        {
+            SWSS_LOG_WARN("Input value %s is not supported for context poll interval, enter <context>:<interval>[:<jitter>]", entry.c_str());
+
+            return;
+        }
+
+        ContextPollInterval interval;
+
+        try
+        {
+            interval.pollInterval = (uint32_t)std::stoul(items[1]);
+            interval.pollJitter = (items.size() == 3) ? (uint32_t)std::stoul(items[2]) : m_pollJitter;
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_WARN("Input value %s is not supported for context poll interval: %s", entry.c_str(), e.what());
+
+            return;
+        }
+
+        contextPollInterval[items[0]] = interval;
+    }
+
+    m_contextPollInterval = contextPollInterval;
+}
+
+void FlexCounter::setContextAggregation(
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::string, ContextAggregation> contextAggregation;
+
+    for (auto& entry: swss::tokenize(value, ','))
+    {
+        auto items = swss::tokenize(entry, ':');
+
+        if (items.size() != 3)
+        {
+            SWSS_LOG_WARN("Input value %s is not supported for context aggregation, enter <context>:<function>:<window>", entry.c_str());
+
+            return;
+        }
+
+        if (items[0] == ATTR_TYPE_QUEUE ||
+                items[0] == ATTR_TYPE_PG ||
+                items[0] == ATTR_TYPE_MACSEC_SA ||
+                items[0] == ATTR_TYPE_ACL_COUNTER)
+        {
+            // attribute values are not counters, they can't be aggregated
+
+            SWSS_LOG_WARN("Input value %s is not supported for context aggregation, %s is attribute context",
+                    entry.c_str(),
+                    items[0].c_str());
+
+            return;
+        }
+
+        ContextAggregation aggregation;
+
+        if (!CounterAggregator::parseFunction(items[1], aggregation.function))
+        {
+            SWSS_LOG_WARN("Input value %s is not supported for context aggregation, function must be %s, %s, %s or %s",
+                    entry.c_str(),
+                    AGGREGATION_MAX,
+                    AGGREGATION_MIN,
+                    AGGREGATION_SUM,
+                    AGGREGATION_LAST);
+
+            return;
+        }
+
+        try
+        {
+            aggregation.window = (uint32_t)std::stoul(items[2]);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_WARN("Input value %s is not supported for context aggregation: %s", entry.c_str(), e.what());
+
+            return;
+        }
+
+        contextAggregation[items[0]] = aggregation;
+    }
+
+    m_contextAggregation = contextAggregation;
+
+    for (const auto &kv : m_counterContext)
+    {
+        attachAggregator(kv.first, kv.second);
+    }
+}
+
 void FlexCounter::setStatus(
         _In_ const std::string& status)
 {
@@ -1074,6 +1668,149 @@ void FlexCounter::setStatsMode(
     }
 }
 
+void FlexCounter::setPublishMode(
+        _In_ const std::string& mode)
+{
+    SWSS_LOG_ENTER();
+
+    if (mode == PUBLISH_MODE_ALL)
+    {
+        m_publishChangedOnly = false;
+    }
+    else if (mode == PUBLISH_MODE_CHANGED)
+    {
+        m_publishChangedOnly = true;
+    }
+    else
+    {
+        SWSS_LOG_WARN("Input value %s is not supported for Flex counter publish mode, enter PUBLISH_MODE_ALL or PUBLISH_MODE_CHANGED", mode.c_str());
+
+        return;
+    }
+
+    SWSS_LOG_DEBUG("Set PUBLISH MODE %s for FC %s", mode.c_str(), m_instanceId.c_str());
+}
+
+void FlexCounter::setFullRefreshInterval(
+        _In_ uint32_t fullRefreshInterval)
+{
+    SWSS_LOG_ENTER();
+
+    m_fullRefreshInterval = fullRefreshInterval;
+}
+
+void FlexCounter::setBulkChunkSize(
+        _In_ uint32_t bulkChunkSize)
+{
+    SWSS_LOG_ENTER();
+
+    m_bulkChunkSize = bulkChunkSize;
+}
+
+void FlexCounter::setRateEngine(
+        _In_ const std::string& engine)
+{
+    SWSS_LOG_ENTER();
+
+    if (engine == RATE_ENGINE_NATIVE)
+    {
+        m_nativeRates = true;
+    }
+    else if (engine == RATE_ENGINE_LUA)
+    {
+        m_nativeRates = false;
+    }
+    else
+    {
+        SWSS_LOG_WARN("Input value %s is not supported for Flex counter rate engine, enter RATE_ENGINE_LUA or RATE_ENGINE_NATIVE", engine.c_str());
+
+        return;
+    }
+
+    SWSS_LOG_DEBUG("Set RATE ENGINE %s for FC %s", engine.c_str(), m_instanceId.c_str());
+
+    for (const auto &kv : m_counterContext)
+    {
+        attachRateEngine(kv.first, kv.second);
+    }
+}
+
+void FlexCounter::setRatePlugins(
+        _In_ const std::string& shaList)
+{
+    SWSS_LOG_ENTER();
+
+    auto shaStrings = swss::tokenize(shaList, ',');
+
+    m_ratePlugins = std::set<std::string>(shaStrings.begin(), shaStrings.end());
+
+    SWSS_LOG_DEBUG("Set RATE PLUGIN %s for FC %s", shaList.c_str(), m_instanceId.c_str());
+
+    for (const auto &kv : m_counterContext)
+    {
+        attachRateEngine(kv.first, kv.second);
+    }
+}
+
+void FlexCounter::setRingSize(
+        _In_ uint32_t ringSize)
+{
+    SWSS_LOG_ENTER();
+
+    m_ringSize = ringSize;
+}
+
+void FlexCounter::setRingMaxSeries(
+        _In_ uint32_t ringMaxSeries)
+{
+    SWSS_LOG_ENTER();
+
+    m_ringMaxSeries = ringMaxSeries;
+}
+
+void FlexCounter::updateCounterRing()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_counterRing &&
+            m_counterRing->getCapacity() == m_ringSize &&
+            m_counterRing->getMaxSeries() == m_ringMaxSeries)
+    {
+        return;
+    }
+
+    // previous ring must be removed before new ring with same name is
+    // created, contexts are not polled while configuration is changed
+
+    for (const auto &kv : m_counterContext)
+    {
+        kv.second->counter_ring = nullptr;
+    }
+
+    m_counterRing = nullptr;
+
+    if (m_ringSize == 0 || m_ringMaxSeries == 0)
+    {
+        return;
+    }
+
+    try
+    {
+        m_counterRing = std::make_shared<CounterRingWriter>(m_instanceId, m_ringSize, m_ringMaxSeries);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("FC %s: counter ring is disabled: %s", m_instanceId.c_str(), e.what());
+
+        return;
+    }
+
+    for (const auto &kv : m_counterContext)
+    {
+        kv.second->counter_ring = m_counterRing;
+    }
+}
+
 void FlexCounter::removeDataFromCountersDB(
         _In_ sai_object_id_t vid,
         _In_ const std::string &ratePrefix)
@@ -1105,6 +1842,8 @@ void FlexCounter::removeCounterPlugins()
     }
 
     m_isDiscarded = true;
+
+    applyStagedChanges();
 }
 
 void FlexCounter::addCounterPlugin(
@@ -1116,6 +1855,8 @@ void FlexCounter::addCounterPlugin(
 
     m_isDiscarded = false;
 
+    std::vector<swss::FieldValueTuple> pollConfig;
+
     for (auto& fvt: values)
     {
         auto& field = fvField(fvt);
@@ -1127,13 +1868,31 @@ void FlexCounter::addCounterPlugin(
         {
             setPollInterval(stoi(value));
         }
+        else if (field == POLL_JITTER_FIELD)
+        {
+            setPollJitter(stoi(value));
+        }
+        else if (field == CONTEXT_POLL_INTERVAL_FIELD)
+        {
+            setContextPollInterval(value);
+        }
         else if (field == FLEX_COUNTER_STATUS_FIELD)
         {
             setStatus(value);
         }
-        else if (field == STATS_MODE_FIELD)
+        else if (field == CONTEXT_AGGREGATION_FIELD ||
+                field == STATS_MODE_FIELD ||
+                field == PUBLISH_MODE_FIELD ||
+                field == FULL_REFRESH_INTERVAL_FIELD ||
+                field == BULK_CHUNK_SIZE_FIELD ||
+                field == RATE_ENGINE_FIELD ||
+                field == RATE_PLUGIN_FIELD ||
+                field == RING_SIZE_FIELD ||
+                field == RING_MAX_SERIES_FIELD)
         {
-            setStatsMode(value);
+            // used by poller during collection
+
+            pollConfig.push_back(fvt);
         }
         else if (field == QUEUE_PLUGIN_FIELD)
         {
@@ -1169,8 +1928,65 @@ void FlexCounter::addCounterPlugin(
         }
     }
 
-    // notify thread to start polling
-    notifyPoll();
+    if (pollConfig.size())
+    {
+        m_stagedConfig.push_back(pollConfig);
+    }
+
+    applyStagedChanges();
+
+    updateSchedule(false);
+}
+
+void FlexCounter::applyPollConfig(
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& fvt: values)
+    {
+        auto& field = fvField(fvt);
+        auto& value = fvValue(fvt);
+
+        if (field == CONTEXT_AGGREGATION_FIELD)
+        {
+            setContextAggregation(value);
+        }
+        else if (field == STATS_MODE_FIELD)
+        {
+            setStatsMode(value);
+        }
+        else if (field == PUBLISH_MODE_FIELD)
+        {
+            setPublishMode(value);
+        }
+        else if (field == FULL_REFRESH_INTERVAL_FIELD)
+        {
+            setFullRefreshInterval(stoi(value));
+        }
+        else if (field == BULK_CHUNK_SIZE_FIELD)
+        {
+            setBulkChunkSize(stoi(value));
+        }
+        else if (field == RATE_ENGINE_FIELD)
+        {
+            setRateEngine(value);
+        }
+        else if (field == RATE_PLUGIN_FIELD)
+        {
+            setRatePlugins(value);
+        }
+        else if (field == RING_SIZE_FIELD)
+        {
+            setRingSize(stoi(value));
+        }
+        else if (field == RING_MAX_SERIES_FIELD)
+        {
+            setRingMaxSeries(stoi(value));
+        }
+    }
+
+    updateCounterRing();
 }
 
 bool FlexCounter::isEmpty()
@@ -1331,25 +2147,79 @@ std::shared_ptr<BaseCounterContext> FlexCounter::getCounterContext(
     }
 
     auto ret = m_counterContext.emplace(name, createCounterContext(name));
+
+    attachRateEngine(name, ret.first->second);
+
+    attachAggregator(name, ret.first->second);
+
+    ret.first->second->counter_ring = m_counterRing;
+
+    ret.first->second->supported_counters_cache = m_supportedCountersCache;
+
     return ret.first->second;
 }
 
-void FlexCounter::removeCounterContext(
-        _In_ const std::string &name)
+void FlexCounter::attachRateEngine(
+        _In_ const std::string &name,
+        _In_ std::shared_ptr<BaseCounterContext> context)
 {
     SWSS_LOG_ENTER();
 
-    auto iter = m_counterContext.find(name);
-    if (iter != m_counterContext.end())
+    sai_object_type_t objectType;
+
+    if (name == COUNTER_TYPE_PORT)
     {
-        m_counterContext.erase(iter);
+        objectType = SAI_OBJECT_TYPE_PORT;
+    }
+    else if (name == COUNTER_TYPE_RIF)
+    {
+        objectType = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
     }
     else
     {
-        SWSS_LOG_ERROR("Try to remove non-exist counter context %s", name.c_str());
+        // no native rates for this counter type, Lua plugins are used
+        return;
+    }
+
+    context->rate_plugins = m_ratePlugins;
+
+    if (!m_nativeRates)
+    {
+        context->rate_engine = nullptr;
+    }
+    else if (context->rate_engine == nullptr)
+    {
+        context->rate_engine = RateEngine::create(objectType, m_dbCounters);
     }
 }
 
+void FlexCounter::attachAggregator(
+        _In_ const std::string &name,
+        _In_ std::shared_ptr<BaseCounterContext> context)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_contextAggregation.find(name);
+
+    if (it == m_contextAggregation.end())
+    {
+        context->aggregator = nullptr;
+        return;
+    }
+
+    auto& aggregator = context->aggregator;
+
+    if (aggregator &&
+            aggregator->getFunction() == it->second.function &&
+            aggregator->getWindow() == it->second.window)
+    {
+        // keep current window
+        return;
+    }
+
+    aggregator = std::make_shared<CounterAggregator>(it->second.function, it->second.window);
+}
+
 bool FlexCounter::hasCounterContext(
     _In_ const std::string &name) const
 {
@@ -1357,122 +2227,294 @@ bool FlexCounter::hasCounterContext(
     return m_counterContext.find(name) != m_counterContext.end();
 }
 
-void FlexCounter::collectCounters(
-        _In_ swss::Table &countersTable)
+std::string FlexCounter::getPollJobName(
+        _In_ const std::string &name) const
 {
     SWSS_LOG_ENTER();
 
-    for (const auto &it : m_counterContext)
+    if (m_contextPollInterval.find(name) != m_contextPollInterval.end())
     {
-        it.second->collectData(countersTable);
+        return name;
     }
 
-    countersTable.flush();
+    // contexts polled with group interval share single job
+
+    return GROUP_POLL_JOB;
 }
 
-void FlexCounter::runPlugins(
-        _In_ swss::DBConnector& counters_db)
+void FlexCounter::updateSchedule(
+        _In_ bool pollNow)
 {
     SWSS_LOG_ENTER();
 
-    const std::vector<std::string> argv =
+    std::map<std::string, ContextPollInterval> jobs;
+
+    for (const auto &kv : m_counterContext)
     {
-        std::to_string(counters_db.getDbId()),
-        COUNTERS_TABLE,
-        std::to_string(m_pollInterval)
-    };
+        if (!m_enable)
+        {
+            // disabled group has no jobs
+            break;
+        }
+
+        auto jobName = getPollJobName(kv.first);
 
-    for (const auto &it : m_counterContext)
+        ContextPollInterval interval = { m_pollInterval, m_pollJitter };
+
+        if (jobName != GROUP_POLL_JOB)
+        {
+            interval = m_contextPollInterval.at(jobName);
+        }
+
+        if (interval.pollInterval == 0)
+        {
+            continue;
+        }
+
+        jobs[jobName] = interval;
+    }
+
+    for (auto it = m_contextSchedule.begin(); it != m_contextSchedule.end();)
     {
-        it.second->runPlugin(counters_db, argv);
+        if (jobs.find(it->first) != jobs.end())
+        {
+            it++;
+            continue;
+        }
+
+        // job could be still running, destructor must wait for it
+
+        m_scheduler->removeJob(it->second.jobId, false);
+
+        m_removedJobs.insert(it->second.jobId);
+
+        it = m_contextSchedule.erase(it);
+    }
+
+    for (auto it = m_removedJobs.begin(); it != m_removedJobs.end();)
+    {
+        it = m_scheduler->isJobRunning(*it) ? std::next(it) : m_removedJobs.erase(it);
+    }
+
+    for (const auto &kv : jobs)
+    {
+        const auto& jobName = kv.first;
+        const auto& interval = kv.second;
+
+        auto it = m_contextSchedule.find(jobName);
+
+        if (it == m_contextSchedule.end())
+        {
+            ContextSchedule schedule;
+
+            schedule.jobId = m_scheduler->addJob(
+                    jobName == GROUP_POLL_JOB ? m_instanceId : m_instanceId + ":" + jobName,
+                    interval.pollInterval,
+                    interval.pollJitter,
+                    [this, jobName]() { pollJob(jobName); });
+
+            schedule.pollInterval = interval.pollInterval;
+            schedule.pollJitter = interval.pollJitter;
+
+            m_contextSchedule[jobName] = schedule;
+
+            continue;
+        }
+
+        auto& schedule = it->second;
+
+        if (schedule.pollInterval != interval.pollInterval || schedule.pollJitter != interval.pollJitter)
+        {
+            m_scheduler->updateJob(schedule.jobId, interval.pollInterval, interval.pollJitter);
+        }
+        else if (pollNow)
+        {
+            m_scheduler->triggerJob(schedule.jobId);
+        }
+
+        schedule.pollInterval = interval.pollInterval;
+        schedule.pollJitter = interval.pollJitter;
     }
 }
 
-void FlexCounter::flexCounterThreadRunFunction()
+void FlexCounter::pollJob(
+        _In_ const std::string &jobName)
 {
+    POLL_MUTEX;
+
     SWSS_LOG_ENTER();
 
-    swss::DBConnector db(m_dbCounters, 0);
-    swss::RedisPipeline pipeline(&db);
-    swss::Table countersTable(&pipeline, COUNTERS_TABLE, true);
+    std::vector<std::shared_ptr<BaseCounterContext>> contexts;
+
+    std::vector<std::function<void()>> changes;
+
+    uint32_t pollInterval;
 
-    while (m_runFlexCounterThread)
     {
         MUTEX;
 
-        if (m_enable && !allIdsEmpty() && (m_pollInterval > 0))
+        auto schedule = m_contextSchedule.find(jobName);
+
+        if (!m_enable || schedule == m_contextSchedule.end())
         {
-            auto start = std::chrono::steady_clock::now();
+            return;
+        }
 
-            collectCounters(countersTable);
+        // group configuration changed since last poll
 
-            runPlugins(db);
+        for (auto& config: m_stagedConfig)
+        {
+            applyPollConfig(config);
+        }
 
-            auto finish = std::chrono::steady_clock::now();
+        m_stagedConfig.clear();
 
-            uint32_t delay = static_cast<uint32_t>(
-                    std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count());
+        pollInterval = schedule->second.pollInterval;
 
-            uint32_t correction = delay % m_pollInterval;
-            correction = m_pollInterval - correction;
-            MUTEX_UNLOCK; // explicit unlock
+        for (const auto &kv : m_counterContext)
+        {
+            if (getPollJobName(kv.first) != jobName)
+            {
+                continue;
+            }
 
-            SWSS_LOG_DEBUG("End of flex counter thread FC %s, took %d ms", m_instanceId.c_str(), delay);
+            auto contextChanges = kv.second->takeChanges();
 
-            std::unique_lock<std::mutex> lk(m_mtxSleep);
+            changes.insert(changes.end(), contextChanges.begin(), contextChanges.end());
 
-            m_cvSleep.wait_for(lk, std::chrono::milliseconds(correction));
+            kv.second->polling = true;
 
-            continue;
+            contexts.push_back(kv.second);
         }
+    }
 
-        MUTEX_UNLOCK; // explicit unlock
+    // counters added and removed since last poll
 
-        // nothing to collect, wait until notified
-        waitPoll();
+    for (auto& change: changes)
+    {
+        change();
     }
-}
 
-void FlexCounter::startFlexCounterThread()
-{
-    SWSS_LOG_ENTER();
+    auto start = std::chrono::steady_clock::now();
+
+    // all contexts are collected before any plugin runs, plugins like PFC
+    // watchdog use counters of several contexts from the same poll
+
+    for (auto& context: contexts)
+    {
+        if (context->hasPolledObject())
+        {
+            collectCounters(*context);
+        }
+    }
 
-    m_runFlexCounterThread = true;
+    runPlugins(contexts, pollInterval);
 
-    m_flexCounterThread = std::make_shared<std::thread>(&FlexCounter::flexCounterThreadRunFunction, this);
+    std::map<sai_object_id_t, std::string> removed;
 
-    SWSS_LOG_INFO("Flex Counter thread started");
+    {
+        MUTEX;
+
+        for (auto& context: contexts)
+        {
+            context->polling = false;
+
+            for (auto& kv: context->takeRemovedObjects())
+            {
+                if (removed[kv.first].empty())
+                {
+                    removed[kv.first] = kv.second;
+                }
+            }
+        }
+    }
+
+    if (m_supportedCountersCache)
+    {
+        // supported counters of objects added since last poll
+
+        m_supportedCountersCache->flush();
+    }
+
+    // objects removed during collection could have been written again
+
+    for (auto& kv: removed)
+    {
+        auto vidStr = sai_serialize_object_id(kv.first);
+
+        m_countersTable->del(vidStr);
+
+        if (kv.second.size())
+        {
+            m_ratesTable->del(vidStr);
+            m_ratesTable->del(vidStr + kv.second);
+        }
+    }
+
+    if (removed.size())
+    {
+        m_countersTable->flush();
+    }
+
+    auto finish = std::chrono::steady_clock::now();
+
+    SWSS_LOG_DEBUG("End of flex counter poll FC %s %s, took %d ms",
+            m_instanceId.c_str(),
+            jobName.c_str(),
+            (int)std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count());
 }
 
-void FlexCounter::endFlexCounterThread(void)
+void FlexCounter::collectCounters(
+        _In_ BaseCounterContext &context)
 {
     SWSS_LOG_ENTER();
 
-    MUTEX;
+    auto now = std::chrono::steady_clock::now();
 
-    if (!m_runFlexCounterThread)
+    bool fullRefresh = true;
+
+    if (m_publishChangedOnly && m_fullRefreshInterval)
     {
-        return;
+        fullRefresh = (now - context.last_full_refresh) >= std::chrono::milliseconds(m_fullRefreshInterval);
+    }
+    else if (m_publishChangedOnly)
+    {
+        fullRefresh = false;
     }
 
-    m_runFlexCounterThread = false;
+    if (fullRefresh)
+    {
+        context.last_full_refresh = now;
+    }
 
-    notifyPoll();
+    context.publish_changed_only = m_publishChangedOnly;
+    context.publish_full_refresh = fullRefresh;
 
-    m_cvSleep.notify_all();
+    context.bulk_chunk_size = m_bulkChunkSize;
+    context.bulk_chunk_scheduler = m_scheduler.get();
 
-    if (m_flexCounterThread != nullptr)
-    {
-        auto fcThread = std::move(m_flexCounterThread);
+    context.collectData(*m_countersTable);
 
-        MUTEX_UNLOCK; // NOTE: explicit unlock before join to not cause deadlock
+    m_countersTable->flush();
+}
 
-        SWSS_LOG_INFO("Wait for Flex Counter thread to end");
+void FlexCounter::runPlugins(
+        _In_ const std::vector<std::shared_ptr<BaseCounterContext>>& contexts,
+        _In_ uint32_t pollInterval)
+{
+    SWSS_LOG_ENTER();
 
-        fcThread->join();
-    }
+    const std::vector<std::string> argv =
+    {
+        std::to_string(m_db->getDbId()),
+        COUNTERS_TABLE,
+        std::to_string(pollInterval)
+    };
 
-    SWSS_LOG_INFO("Flex Counter thread ended");
+    for (auto& context: contexts)
+    {
+        context->runPlugin(*m_db, argv);
+    }
 }
 
 void FlexCounter::removeCounter(
@@ -1521,8 +2563,14 @@ void FlexCounter::removeCounter(
     {
         if (hasCounterContext(COUNTER_TYPE_RIF))
         {
-            removeDataFromCountersDB(vid, ":RIF");
-            getCounterContext(COUNTER_TYPE_RIF)->removeObject(vid);
+            auto context = getCounterContext(COUNTER_TYPE_RIF);
+
+            context->removeObject(vid);
+
+            if (!context->stageRatesRemoval(vid, ":RIF"))
+            {
+                removeDataFromCountersDB(vid, ":RIF");
+            }
         }
     }
     else if (objectType == SAI_OBJECT_TYPE_BUFFER_POOL)
@@ -1576,8 +2624,14 @@ void FlexCounter::removeCounter(
     {
         if (hasCounterContext(COUNTER_TYPE_FLOW))
         {
-            getCounterContext(COUNTER_TYPE_FLOW)->removeObject(vid);
-            removeDataFromCountersDB(vid, ":TRAP");
+            auto context = getCounterContext(COUNTER_TYPE_FLOW);
+
+            context->removeObject(vid);
+
+            if (!context->stageRatesRemoval(vid, ":TRAP"))
+            {
+                removeDataFromCountersDB(vid, ":TRAP");
+            }
         }
     }
     else
@@ -1585,6 +2639,8 @@ void FlexCounter::removeCounter(
         SWSS_LOG_ERROR("Object type for removal not supported, %s",
                 sai_serialize_object_type(objectType).c_str());
     }
+
+    applyStagedChanges();
 }
 
 void FlexCounter::addCounter(
@@ -1596,6 +2652,8 @@ void FlexCounter::addCounter(
 
     SWSS_LOG_ENTER();
 
+    bool wasEmpty = allIdsEmpty();
+
     sai_object_type_t objectType = VidManager::objectTypeQuery(vid); // VID and RID will have the same object type
 
     std::vector<std::string> counterIds;
@@ -1749,22 +2807,38 @@ void FlexCounter::addCounter(
                 statsMode);
     }
 
-    // notify thread to start polling
-    notifyPoll();
-}
+    applyStagedChanges();
 
-void FlexCounter::waitPoll()
-{
-    SWSS_LOG_ENTER();
-    std::unique_lock<std::mutex> lk(m_mtxSleep);
-    m_pollCond.wait(lk, [&](){return m_readyToPoll;});
-    m_readyToPoll = false;
+    // start polling right away when first object is added
+
+    updateSchedule(wasEmpty);
 }
 
-void FlexCounter::notifyPoll()
+void FlexCounter::applyStagedChanges()
 {
     SWSS_LOG_ENTER();
-    std::unique_lock<std::mutex> lk(m_mtxSleep);
-    m_readyToPoll = true;
-    m_pollCond.notify_all();
+
+    std::unique_lock<std::mutex> pollLock(m_pollMtx, std::try_to_lock);
+
+    if (!pollLock.owns_lock())
+    {
+        // poll in progress, changes are applied by poller
+
+        return;
+    }
+
+    for (auto& config: m_stagedConfig)
+    {
+        applyPollConfig(config);
+    }
+
+    m_stagedConfig.clear();
+
+    for (const auto &kv : m_counterContext)
+    {
+        for (auto& change: kv.second->takeChanges())
+        {
+            change();
+        }
+    }
 }
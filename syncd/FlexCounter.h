@@ -4,6 +4,12 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "RateEngine.h"
+#include "CounterRingWriter.h"
+#include "CounterAggregator.h"
+#include "SupportedCountersCache.h"
+#include "FlexCounterScheduler.h"
+
 #include "meta/SaiInterface.h"
 
 #include "swss/table.h"
@@ -14,6 +20,19 @@ extern "C" {
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
+#include <chrono>
+#include <functional>
+
+#define PUBLISH_MODE_FIELD              "PUBLISH_MODE"
+#define PUBLISH_MODE_ALL                "PUBLISH_MODE_ALL"
+#define PUBLISH_MODE_CHANGED            "PUBLISH_MODE_CHANGED"
+#define FULL_REFRESH_INTERVAL_FIELD     "FULL_REFRESH_INTERVAL"
+
+#define DEFAULT_FULL_REFRESH_INTERVAL   (60 * 1000)
+
+#define POLL_JITTER_FIELD               "POLL_JITTER"
+#define CONTEXT_POLL_INTERVAL_FIELD     "CONTEXT_POLL_INTERVAL"
+#define BULK_CHUNK_SIZE_FIELD           "BULK_CHUNK_SIZE"
 
 namespace syncd
 {
@@ -24,16 +43,27 @@ namespace syncd
         void addPlugins(
             _In_ const std::vector<std::string>& shaStrings);
 
+        /**
+         * @brief Check if context has plugins, including staged changes.
+         */
         bool hasPlugin() const {return !m_plugins.empty();}
 
-        void removePlugins() {m_plugins.clear();}
+        void removePlugins();
 
+        /**
+         * @brief Add object, change is staged and applied to polled objects
+         * by poller before next collection.
+         */
         virtual void addObject(
                 _In_ sai_object_id_t vid,
                 _In_ sai_object_id_t rid,
                 _In_ const std::vector<std::string> &idStrings,
                 _In_ const std::string &per_object_stats_mode) = 0;
 
+        /**
+         * @brief Remove object, change is staged and applied to polled
+         * objects by poller before next collection.
+         */
         virtual void removeObject(
                 _In_ sai_object_id_t vid) = 0;
 
@@ -44,17 +74,101 @@ namespace syncd
                 _In_ swss::DBConnector& counters_db,
                 _In_ const std::vector<std::string>& argv) = 0;
 
-        virtual bool hasObject() const = 0;
+        /**
+         * @brief Check if context has objects, including staged changes.
+         */
+        bool hasObject() const {return !m_objects.empty();}
+
+        /**
+         * @brief Check if context has objects to poll, used by poller.
+         */
+        virtual bool hasPolledObject() const = 0;
+
+        /**
+         * @brief Take staged changes, to be applied by poller.
+         */
+        std::vector<std::function<void()>> takeChanges();
+
+        /**
+         * @brief Take objects removed while poll was in progress, value is
+         * rate prefix when object rates should be removed as well.
+         */
+        std::map<sai_object_id_t, std::string> takeRemovedObjects();
+
+        /**
+         * @brief Defer removal of object rates after running poll.
+         *
+         * @return False if context is not polled and rates can be removed
+         * right away.
+         */
+        bool stageRatesRemoval(
+                _In_ sai_object_id_t vid,
+                _In_ const std::string &ratePrefix);
+
+    protected:
+        void stageChange(
+                _In_ const std::function<void()>& change);
+
+        void stageRemoval(
+                _In_ sai_object_id_t vid);
+
+        void stagePlugins();
 
     protected:
         std::string m_name;
+        // Staged state is guarded by flex counter mutex, polled state
+        // (derived contexts object maps) is used only by poller.
         std::set<std::string> m_plugins;
+        std::set<std::string> m_polledPlugins;
+        std::set<sai_object_id_t> m_objects;
+        std::vector<std::function<void()>> m_changes;
+        std::map<sai_object_id_t, std::string> m_removedObjects;
 
     public:
         bool always_check_supported_counters = false;
         bool use_sai_stats_capa_query = true;
         bool use_sai_stats_ext = false;
         bool double_confirm_supported_counters = false;
+
+        // When set, only counters which changed since last poll are written
+        // to COUNTERS_DB, last published values are cached per object.
+        bool publish_changed_only = false;
+
+        // Set by flex counter on polls when all counters must be written
+        // regardless of publish mode.
+        bool publish_full_refresh = true;
+
+        // When set and active, rates are computed natively and rates Lua
+        // plugins of this context are not executed.
+        std::shared_ptr<RateEngine> rate_engine;
+
+        // SHAs of rates Lua plugins replaced by rate engine.
+        std::set<std::string> rate_plugins;
+
+        // When set, polled counters are also appended to shared memory
+        // counter ring of the group.
+        std::shared_ptr<CounterRingWriter> counter_ring;
+
+        // When set, polled counters are aggregated and published only at
+        // aggregation window boundary.
+        std::shared_ptr<CounterAggregator> aggregator;
+
+        // When set, supported counters are taken from and stored to
+        // persistent cache, per object when support is always checked.
+        std::shared_ptr<SupportedCountersCache> supported_counters_cache;
+
+        // When set, bulk contexts with more objects than bulk_chunk_size are
+        // collected in chunks running in parallel on scheduler workers. Set
+        // by flex counter on each poll.
+        uint32_t bulk_chunk_size = 0;
+        FlexCounterScheduler* bulk_chunk_scheduler = nullptr;
+
+        // Last poll when all counters were written, used by poller.
+        std::chrono::steady_clock::time_point last_full_refresh;
+
+        // Set by poller while context is collected, guarded by flex counter
+        // mutex.
+        bool polling = false;
     };
     class FlexCounter
     {
@@ -62,10 +176,20 @@ namespace syncd
             FlexCounter(const FlexCounter&) = delete;
 
         public:
+            /**
+             * @brief Flex counter group.
+             *
+             * Counter contexts polled with group poll interval are polled by
+             * single job of the scheduler, contexts with own poll interval
+             * by separate jobs. When scheduler is not provided, flex counter
+             * creates its own scheduler with single worker thread.
+             */
             FlexCounter(
                     _In_ const std::string& instanceId,
                     _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
-                    _In_ const std::string& dbCounters);
+                    _In_ const std::string& dbCounters,
+                    _In_ std::shared_ptr<FlexCounterScheduler> scheduler = nullptr,
+                    _In_ std::shared_ptr<SupportedCountersCache> supportedCountersCache = nullptr);
 
             virtual ~FlexCounter();
 
@@ -92,12 +216,66 @@ namespace syncd
             void setPollInterval(
                     _In_ uint32_t pollInterval);
 
+            void setPollJitter(
+                    _In_ uint32_t pollJitter);
+
+            /**
+             * @brief Set poll interval of individual counter contexts.
+             *
+             * Value is comma separated list of <context name>:<interval>[:<jitter>]
+             * entries, for example "Queue Counter:10000:500,Flow Counter:60000".
+             * Contexts not listed are polled with group poll interval and
+             * jitter.
+             */
+            void setContextPollInterval(
+                    _In_ const std::string& value);
+
+            /**
+             * @brief Set aggregation of individual counter contexts.
+             *
+             * Value is comma separated list of <context name>:<function>:<window>
+             * entries, for example "Queue Counter:max:60000". Function is
+             * one of max, min, sum or last, window is publishing interval in
+             * milliseconds. Counters of listed contexts are sampled with
+             * context poll interval, but only aggregated values are
+             * published once per window. Attribute contexts can't be
+             * aggregated, value listing them is rejected.
+             */
+            void setContextAggregation(
+                    _In_ const std::string& value);
+
             void setStatus(
                     _In_ const std::string& status);
 
             void setStatsMode(
                     _In_ const std::string& mode);
 
+            void setPublishMode(
+                    _In_ const std::string& mode);
+
+            void setFullRefreshInterval(
+                    _In_ uint32_t fullRefreshInterval);
+
+            void setBulkChunkSize(
+                    _In_ uint32_t bulkChunkSize);
+
+            void setRateEngine(
+                    _In_ const std::string& engine);
+
+            void setRatePlugins(
+                    _In_ const std::string& shaList);
+
+            void setRingSize(
+                    _In_ uint32_t ringSize);
+
+            void setRingMaxSeries(
+                    _In_ uint32_t ringMaxSeries);
+
+            void updateCounterRing();
+
+            void applyPollConfig(
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
         private:
             bool allIdsEmpty() const;
 
@@ -115,46 +293,103 @@ namespace syncd
             std::shared_ptr<BaseCounterContext> createCounterContext(
                     _In_ const std::string &name);
 
-            void removeCounterContext(
-                    _In_ const std::string &name);
-
             bool hasCounterContext(
                     _In_ const std::string &name) const;
 
-            void collectCounters(
-                    _In_ swss::Table &countersTable);
+            void attachRateEngine(
+                    _In_ const std::string &name,
+                    _In_ std::shared_ptr<BaseCounterContext> context);
 
-            void runPlugins(
-                    _In_ swss::DBConnector& db);
+            void attachAggregator(
+                    _In_ const std::string &name,
+                    _In_ std::shared_ptr<BaseCounterContext> context);
 
-            void startFlexCounterThread();
+        private:
+            typedef struct _ContextSchedule
+            {
+                FlexCounterScheduler::JobId jobId;
 
-            void endFlexCounterThread();
+                uint32_t pollInterval;
 
-            void flexCounterThreadRunFunction();
+                uint32_t pollJitter;
 
-        private:
-            void waitPoll();
+            } ContextSchedule;
 
-            void notifyPoll();
+            typedef struct _ContextPollInterval
+            {
+                uint32_t pollInterval;
 
-        private:
-            bool m_runFlexCounterThread;
+                uint32_t pollJitter;
 
-            std::shared_ptr<std::thread> m_flexCounterThread;
+            } ContextPollInterval;
 
-            std::mutex m_mtxSleep;
+            typedef struct _ContextAggregation
+            {
+                CounterAggregator::Function function;
 
-            std::condition_variable m_cvSleep;
+                uint32_t window;
 
-            std::mutex m_mtx;
+            } ContextAggregation;
+
+            /**
+             * @brief Add, update or remove scheduler jobs of counter contexts
+             * to match current configuration.
+             *
+             * @param pollNow Poll already scheduled contexts immediately.
+             */
+            void updateSchedule(
+                    _In_ bool pollNow);
+
+            /**
+             * @brief Apply staged counter changes right away, if no poll is in
+             * progress.
+             */
+            void applyStagedChanges();
+
+            /**
+             * @brief Get name of scheduler job polling given context.
+             *
+             * Contexts with own poll interval are polled by job of the same
+             * name, all other contexts by single group job.
+             */
+            std::string getPollJobName(
+                    _In_ const std::string &name) const;
+
+            /**
+             * @brief Scheduler job, applies staged changes, collects counters
+             * of all contexts of the job and then runs their plugins.
+             */
+            void pollJob(
+                    _In_ const std::string &jobName);
+
+            void collectCounters(
+                    _In_ BaseCounterContext &context);
 
-            std::condition_variable m_pollCond;
+            void runPlugins(
+                    _In_ const std::vector<std::shared_ptr<BaseCounterContext>>& contexts,
+                    _In_ uint32_t pollInterval);
 
-            bool m_readyToPoll;
+        private:
+            /**
+             * @brief Guards configuration and staged counter changes, never
+             * held while vendor stats are collected.
+             */
+            std::mutex m_mtx;
+
+            /**
+             * @brief Guards polled state, held by poller for the whole poll
+             * of a job, never waited for by configuration changes.
+             */
+            std::mutex m_pollMtx;
 
             uint32_t m_pollInterval;
 
+            /**
+             * @brief Maximum random delay (in milliseconds) added to each
+             * poll, spreads polls of groups with the same interval.
+             */
+            uint32_t m_pollJitter;
+
             std::string m_instanceId;
 
             sai_stats_mode_t m_statsMode;
@@ -168,5 +403,76 @@ namespace syncd
             bool m_isDiscarded;
 
             std::map<std::string, std::shared_ptr<BaseCounterContext>> m_counterContext;
+
+            bool m_publishChangedOnly;
+
+            /**
+             * @brief Interval (in milliseconds) in which all counters are
+             * written to COUNTERS_DB when only changed counters are published,
+             * zero disables periodic full refresh.
+             */
+            uint32_t m_fullRefreshInterval;
+
+            bool m_nativeRates;
+
+            /**
+             * @brief SHAs of rates Lua plugins, skipped while native rate
+             * engine is active.
+             */
+            std::set<std::string> m_ratePlugins;
+
+            /**
+             * @brief Maximum number of objects in single bulk get stats
+             * call, chunks are collected in parallel, zero disables
+             * chunking.
+             *
+             * Useful only when vendor SAI lock policy allows concurrent
+             * stats calls.
+             */
+            uint32_t m_bulkChunkSize;
+
+            /**
+             * @brief Number of samples kept per series in counter ring, zero
+             * disables counter ring.
+             */
+            uint32_t m_ringSize;
+
+            uint32_t m_ringMaxSeries;
+
+            std::shared_ptr<CounterRingWriter> m_counterRing;
+
+            std::map<std::string, ContextPollInterval> m_contextPollInterval;
+
+            std::map<std::string, ContextAggregation> m_contextAggregation;
+
+            /**
+             * @brief Scheduled poll jobs, key is job name.
+             */
+            std::map<std::string, ContextSchedule> m_contextSchedule;
+
+            /**
+             * @brief Jobs removed by configuration change which could be
+             * still running, destructor waits for them.
+             */
+            std::set<FlexCounterScheduler::JobId> m_removedJobs;
+
+            std::shared_ptr<FlexCounterScheduler> m_scheduler;
+
+            std::shared_ptr<SupportedCountersCache> m_supportedCountersCache;
+
+            std::shared_ptr<swss::DBConnector> m_db;
+
+            std::shared_ptr<swss::RedisPipeline> m_pipeline;
+
+            std::shared_ptr<swss::Table> m_countersTable;
+
+            std::shared_ptr<swss::Table> m_ratesTable;
+
+            /**
+             * @brief Group configuration used by poller during collection,
+             * applied by poller before next poll or right away when no poll
+             * is in progress.
+             */
+            std::vector<std::vector<swss::FieldValueTuple>> m_stagedConfig;
     };
 }
@@ -8,13 +8,15 @@ using namespace syncd;
 
 FlexCounterManager::FlexCounterManager(
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
-        _In_ const std::string& dbCounters):
+        _In_ const std::string& dbCounters,
+        _In_ std::shared_ptr<SupportedCountersCache> supportedCountersCache):
+    m_supportedCountersCache(supportedCountersCache),
     m_vendorSai(vendorSai),
     m_dbCounters(dbCounters)
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    m_scheduler = std::make_shared<FlexCounterScheduler>();
 }
 
 std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
@@ -26,7 +28,7 @@ std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
 
     if (m_flexCounters.count(instanceId) == 0)
     {
-        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorSai, m_dbCounters);
+        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorSai, m_dbCounters, m_scheduler, m_supportedCountersCache);
 
         m_flexCounters[instanceId] = counter;
     }
@@ -10,7 +10,8 @@ namespace syncd
 
             FlexCounterManager(
                     _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
-                    _In_ const std::string& dbCounters);
+                    _In_ const std::string& dbCounters,
+                    _In_ std::shared_ptr<SupportedCountersCache> supportedCountersCache = nullptr);
 
             virtual ~FlexCounterManager() = default;
 
@@ -43,6 +44,17 @@ namespace syncd
 
         private:
 
+                /**
+                 * @brief Scheduler shared by all flex counter groups.
+                 */
+                std::shared_ptr<FlexCounterScheduler> m_scheduler;
+
+                /**
+                 * @brief Supported counters cache shared by all flex counter
+                 * groups, can be null.
+                 */
+                std::shared_ptr<SupportedCountersCache> m_supportedCountersCache;
+
                 std::map<std::string, std::shared_ptr<FlexCounter>> m_flexCounters;
 
                 std::mutex m_mutex;
@@ -0,0 +1,526 @@
+#include "FlexCounterScheduler.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <inttypes.h>
+
+using namespace syncd;
+
+#define MUTEX std::unique_lock<std::mutex> _lock(m_mutex);
+
+FlexCounterScheduler::FlexCounterScheduler(
+        _In_ size_t workers):
+    m_runThread(true),
+    m_nextJobId(INVALID_JOB_ID + 1),
+    m_wheel(WHEEL_SIZE),
+    m_start(std::chrono::steady_clock::now()),
+    m_currentTick(0),
+    m_random(std::random_device()())
+{
+    SWSS_LOG_ENTER();
+
+    if (workers == 0)
+    {
+        SWSS_LOG_THROW("at least one worker thread is required");
+    }
+
+    m_timerThread = std::make_shared<std::thread>(&FlexCounterScheduler::timerThreadFunction, this);
+
+    for (size_t idx = 0; idx < workers; idx++)
+    {
+        m_workerThreads.push_back(std::make_shared<std::thread>(&FlexCounterScheduler::workerThreadFunction, this));
+    }
+
+    SWSS_LOG_NOTICE("flex counter scheduler started with %zu worker threads", workers);
+}
+
+FlexCounterScheduler::~FlexCounterScheduler()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        MUTEX;
+
+        m_runThread = false;
+    }
+
+    m_timerCv.notify_all();
+    m_readyCv.notify_all();
+
+    m_timerThread->join();
+
+    for (auto& thread: m_workerThreads)
+    {
+        thread->join();
+    }
+}
+
+FlexCounterScheduler::JobId FlexCounterScheduler::addJob(
+        _In_ const std::string& name,
+        _In_ uint32_t interval,
+        _In_ uint32_t jitter,
+        _In_ const JobFunction& function)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (interval == 0)
+    {
+        SWSS_LOG_THROW("job %s interval must be positive", name.c_str());
+    }
+
+    auto job = std::make_shared<Job>();
+
+    job->id = m_nextJobId++;
+    job->name = name;
+    job->function = function;
+    job->interval = interval;
+    job->jitter = jitter;
+    job->generation = 0;
+    job->queued = false;
+    job->running = false;
+    job->triggered = false;
+    job->removed = false;
+    job->statistics = {};
+
+    m_jobs[job->id] = job;
+
+    schedule(job, std::chrono::steady_clock::now(), false);
+
+    SWSS_LOG_INFO("job %s added, interval %u ms, jitter %u ms", name.c_str(), interval, jitter);
+
+    return job->id;
+}
+
+void FlexCounterScheduler::updateJob(
+        _In_ JobId id,
+        _In_ uint32_t interval,
+        _In_ uint32_t jitter)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto job = getJob(id);
+
+    if (interval == 0)
+    {
+        SWSS_LOG_THROW("job %s interval must be positive", job->name.c_str());
+    }
+
+    uint32_t previous = job->interval;
+
+    job->interval = interval;
+    job->jitter = jitter;
+
+    if (job->queued || job->running)
+    {
+        // new interval is used when run finishes
+
+        return;
+    }
+
+    // deadline points to next run, move it relative to previous run
+
+    auto deadline = job->deadline - std::chrono::milliseconds(previous) + std::chrono::milliseconds(interval);
+
+    schedule(job, std::max(deadline, std::chrono::steady_clock::now()), true);
+}
+
+void FlexCounterScheduler::triggerJob(
+        _In_ JobId id)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto job = getJob(id);
+
+    if (job->running)
+    {
+        job->triggered = true;
+    }
+    else if (!job->queued)
+    {
+        schedule(job, std::chrono::steady_clock::now(), false);
+    }
+}
+
+void FlexCounterScheduler::removeJob(
+        _In_ JobId id,
+        _In_ bool wait)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto job = getJob(id);
+
+    // wheel entry and ready queue entry are dropped when reached
+
+    job->removed = true;
+    job->generation++;
+
+    m_jobs.erase(id);
+
+    if (wait)
+    {
+        m_doneCv.wait(_lock, [&]{ return !job->running; });
+    }
+    else if (job->running)
+    {
+        m_removedJobs[id] = job;
+    }
+
+    SWSS_LOG_INFO("job %s removed", job->name.c_str());
+}
+
+bool FlexCounterScheduler::isJobRunning(
+        _In_ JobId id)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto it = m_jobs.find(id);
+
+    if (it != m_jobs.end())
+    {
+        return it->second->running;
+    }
+
+    return m_removedJobs.find(id) != m_removedJobs.end();
+}
+
+void FlexCounterScheduler::waitJob(
+        _In_ JobId id)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_doneCv.wait(_lock, [&]{
+            auto it = m_jobs.find(id);
+
+            if (it != m_jobs.end())
+            {
+                return !it->second->running;
+            }
+
+            return m_removedJobs.find(id) == m_removedJobs.end(); });
+}
+
+FlexCounterScheduler::JobStatistics FlexCounterScheduler::getJobStatistics(
+        _In_ JobId id)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return getJob(id)->statistics;
+}
+
+void FlexCounterScheduler::runTasks(
+        _In_ const std::vector<JobFunction>& tasks)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (tasks.empty())
+    {
+        return;
+    }
+
+    auto batch = std::make_shared<TaskBatch>();
+
+    batch->tasks = tasks;
+    batch->next = 0;
+    batch->pending = tasks.size();
+
+    m_batches.push_back(batch);
+
+    m_readyCv.notify_all();
+
+    while (batch->next < batch->tasks.size())
+    {
+        runTask(batch, _lock);
+    }
+
+    m_doneCv.wait(_lock, [&]{ return batch->pending == 0; });
+}
+
+void FlexCounterScheduler::runTask(
+        _In_ std::shared_ptr<TaskBatch> batch,
+        _Inout_ std::unique_lock<std::mutex>& lock)
+{
+    SWSS_LOG_ENTER();
+
+    auto& task = batch->tasks[batch->next++];
+
+    if (batch->next == batch->tasks.size())
+    {
+        // all tasks taken, batch is no longer offered to workers
+
+        m_batches.erase(std::find(m_batches.begin(), m_batches.end(), batch));
+    }
+
+    lock.unlock();
+
+    try
+    {
+        task();
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("task failed: %s", e.what());
+    }
+
+    lock.lock();
+
+    if (--batch->pending == 0)
+    {
+        m_doneCv.notify_all();
+    }
+}
+
+std::shared_ptr<FlexCounterScheduler::Job> FlexCounterScheduler::getJob(
+        _In_ JobId id)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_jobs.find(id);
+
+    if (it == m_jobs.end())
+    {
+        SWSS_LOG_THROW("job %" PRIu64 " does not exist", id);
+    }
+
+    return it->second;
+}
+
+void FlexCounterScheduler::schedule(
+        _In_ std::shared_ptr<Job> job,
+        _In_ TimePoint deadline,
+        _In_ bool useJitter)
+{
+    SWSS_LOG_ENTER();
+
+    job->generation++;
+    job->deadline = deadline;
+
+    auto runAt = deadline;
+
+    if (useJitter && job->jitter)
+    {
+        std::uniform_int_distribution<uint32_t> distribution(0, job->jitter);
+
+        runAt += std::chrono::milliseconds(distribution(m_random));
+    }
+
+    auto tick = std::chrono::milliseconds(TICK_MS);
+
+    // round up, job is never executed before its time
+
+    uint64_t targetTick = (uint64_t)((runAt - m_start + tick - std::chrono::nanoseconds(1)) / tick);
+
+    if (targetTick <= m_currentTick)
+    {
+        enqueue(job);
+
+        return;
+    }
+
+    uint64_t ticks = targetTick - m_currentTick;
+
+    WheelEntry entry;
+
+    entry.job = job;
+    entry.generation = job->generation;
+    entry.rounds = (size_t)((ticks - 1) / WHEEL_SIZE);
+
+    m_wheel[(m_currentTick + ticks) % WHEEL_SIZE].push_back(entry);
+}
+
+void FlexCounterScheduler::enqueue(
+        _In_ std::shared_ptr<Job> job)
+{
+    SWSS_LOG_ENTER();
+
+    job->queued = true;
+
+    m_ready.push_back(job);
+
+    m_readyCv.notify_one();
+}
+
+void FlexCounterScheduler::expireSlot(
+        _In_ size_t slot)
+{
+    SWSS_LOG_ENTER();
+
+    auto& entries = m_wheel[slot];
+
+    for (auto it = entries.begin(); it != entries.end(); )
+    {
+        if (it->generation != it->job->generation)
+        {
+            // job was rescheduled or removed
+
+            it = entries.erase(it);
+        }
+        else if (it->rounds)
+        {
+            it->rounds--;
+
+            it++;
+        }
+        else
+        {
+            enqueue(it->job);
+
+            it = entries.erase(it);
+        }
+    }
+}
+
+void FlexCounterScheduler::finish(
+        _In_ std::shared_ptr<Job> job,
+        _In_ TimePoint start,
+        _In_ TimePoint finish)
+{
+    SWSS_LOG_ENTER();
+
+    job->running = false;
+
+    uint64_t runTime = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count();
+
+    job->statistics.runs++;
+    job->statistics.maxRunTimeMs = std::max(job->statistics.maxRunTimeMs, runTime);
+
+    if (job->removed)
+    {
+        m_removedJobs.erase(job->id);
+
+        return;
+    }
+
+    if (job->triggered)
+    {
+        job->triggered = false;
+
+        schedule(job, finish, false);
+
+        return;
+    }
+
+    auto interval = std::chrono::milliseconds(job->interval);
+
+    auto deadline = job->deadline + interval;
+
+    if (finish > deadline)
+    {
+        // skip missed runs and keep the phase of the job
+
+        auto missed = (finish - job->deadline) / interval;
+
+        deadline = job->deadline + interval * (missed + 1);
+
+        job->statistics.overruns++;
+
+        SWSS_LOG_WARN("job %s overrun: run took %" PRIu64 " ms, interval %u ms, %" PRIu64 " overruns so far",
+                job->name.c_str(),
+                runTime,
+                job->interval,
+                job->statistics.overruns);
+    }
+
+    schedule(job, deadline, true);
+}
+
+void FlexCounterScheduler::timerThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX;
+
+    while (m_runThread)
+    {
+        auto tick = std::chrono::milliseconds(TICK_MS);
+
+        m_timerCv.wait_until(_lock, m_start + tick * (m_currentTick + 1), [&]{ return !m_runThread; });
+
+        auto now = std::chrono::steady_clock::now();
+
+        // catch up with all passed ticks, if thread was delayed
+
+        while (m_runThread && m_start + tick * (m_currentTick + 1) <= now)
+        {
+            m_currentTick++;
+
+            expireSlot(m_currentTick % WHEEL_SIZE);
+        }
+    }
+}
+
+void FlexCounterScheduler::workerThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX;
+
+    while (true)
+    {
+        m_readyCv.wait(_lock, [&]{ return !m_runThread || !m_ready.empty() || !m_batches.empty(); });
+
+        if (!m_runThread)
+        {
+            break;
+        }
+
+        if (!m_batches.empty())
+        {
+            // tasks are blocking job which is already running
+
+            runTask(m_batches.front(), _lock);
+
+            continue;
+        }
+
+        auto job = m_ready.front();
+
+        m_ready.pop_front();
+
+        job->queued = false;
+
+        if (job->removed)
+        {
+            continue;
+        }
+
+        job->running = true;
+
+        auto start = std::chrono::steady_clock::now();
+
+        _lock.unlock();
+
+        try
+        {
+            job->function();
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("job %s failed: %s", job->name.c_str(), e.what());
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        _lock.lock();
+
+        finish(job, start, end);
+
+        m_doneCv.notify_all();
+    }
+}
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Schedules periodic flex counter polls on shared worker pool.
+     *
+     * Jobs are kept on hashed timer wheel with TICK_MS resolution, due jobs
+     * are handed to worker threads, so slow job is only delaying itself.
+     * Job is never executed concurrently with itself, next run is scheduled
+     * when current run finished. When run takes longer than job interval,
+     * overrun is reported and missed runs are skipped.
+     */
+    class FlexCounterScheduler
+    {
+        private:
+
+            FlexCounterScheduler(const FlexCounterScheduler&) = delete;
+            FlexCounterScheduler& operator=(const FlexCounterScheduler&) = delete;
+
+        public:
+
+            typedef uint64_t JobId;
+
+            typedef std::function<void()> JobFunction;
+
+            typedef struct _JobStatistics
+            {
+                uint64_t runs;
+
+                uint64_t overruns;
+
+                uint64_t maxRunTimeMs;
+
+            } JobStatistics;
+
+            static constexpr JobId INVALID_JOB_ID = 0;
+
+            static constexpr uint32_t TICK_MS = 10;
+
+            static constexpr size_t WHEEL_SIZE = 512;
+
+            static constexpr size_t DEFAULT_WORKER_THREADS = 4;
+
+        public:
+
+            FlexCounterScheduler(
+                    _In_ size_t workers = DEFAULT_WORKER_THREADS);
+
+            virtual ~FlexCounterScheduler();
+
+        public:
+
+            /**
+             * @brief Add periodic job, first run is executed immediately.
+             *
+             * @param name Job name used in logs.
+             * @param interval Job interval in milliseconds, must be positive.
+             * @param jitter Maximum random delay (in milliseconds) added to
+             * each run, spreads jobs with the same interval.
+             * @param function Job function.
+             *
+             * @return Job id.
+             */
+            JobId addJob(
+                    _In_ const std::string& name,
+                    _In_ uint32_t interval,
+                    _In_ uint32_t jitter,
+                    _In_ const JobFunction& function);
+
+            /**
+             * @brief Change job interval and jitter, takes effect from next
+             * run.
+             */
+            void updateJob(
+                    _In_ JobId id,
+                    _In_ uint32_t interval,
+                    _In_ uint32_t jitter);
+
+            /**
+             * @brief Run job as soon as possible, if job is running it will
+             * be executed again right after current run.
+             */
+            void triggerJob(
+                    _In_ JobId id);
+
+            /**
+             * @brief Remove job.
+             *
+             * When wait is set, function blocks until current run of the job
+             * finishes, must not be called while holding lock which job
+             * function is acquiring.
+             */
+            void removeJob(
+                    _In_ JobId id,
+                    _In_ bool wait);
+
+            /**
+             * @brief Check whether job is running, including job which was
+             * removed without wait.
+             */
+            bool isJobRunning(
+                    _In_ JobId id);
+
+            /**
+             * @brief Wait until current run of the job finishes, job could
+             * be already removed. Must not be called while holding lock which
+             * job function is acquiring.
+             */
+            void waitJob(
+                    _In_ JobId id);
+
+            JobStatistics getJobStatistics(
+                    _In_ JobId id);
+
+            /**
+             * @brief Run tasks in parallel on worker threads and wait until
+             * all of them finish.
+             *
+             * Calling thread is executing tasks as well, so tasks are done
+             * even if all workers are busy, it is safe to call from job
+             * function. Tasks are preferred by workers over ready jobs.
+             */
+            void runTasks(
+                    _In_ const std::vector<JobFunction>& tasks);
+
+        private:
+
+            typedef std::chrono::steady_clock::time_point TimePoint;
+
+            typedef struct _Job
+            {
+                JobId id;
+
+                std::string name;
+
+                JobFunction function;
+
+                uint32_t interval;
+
+                uint32_t jitter;
+
+                /**
+                 * @brief Planned start of next run, without jitter.
+                 */
+                TimePoint deadline;
+
+                /**
+                 * @brief Incremented on each schedule, wheel entries with
+                 * different generation are stale.
+                 */
+                uint64_t generation;
+
+                bool queued;
+
+                bool running;
+
+                bool triggered;
+
+                bool removed;
+
+                JobStatistics statistics;
+
+            } Job;
+
+            typedef struct _TaskBatch
+            {
+                std::vector<JobFunction> tasks;
+
+                /**
+                 * @brief Index of next task to run.
+                 */
+                size_t next;
+
+                /**
+                 * @brief Tasks not finished yet.
+                 */
+                size_t pending;
+
+            } TaskBatch;
+
+            typedef struct _WheelEntry
+            {
+                std::shared_ptr<Job> job;
+
+                uint64_t generation;
+
+                size_t rounds;
+
+            } WheelEntry;
+
+            void schedule(
+                    _In_ std::shared_ptr<Job> job,
+                    _In_ TimePoint deadline,
+                    _In_ bool useJitter);
+
+            void enqueue(
+                    _In_ std::shared_ptr<Job> job);
+
+            void finish(
+                    _In_ std::shared_ptr<Job> job,
+                    _In_ TimePoint start,
+                    _In_ TimePoint finish);
+
+            void expireSlot(
+                    _In_ size_t slot);
+
+            std::shared_ptr<Job> getJob(
+                    _In_ JobId id);
+
+            /**
+             * @brief Take next task of batch and run it, lock is released
+             * while task is running.
+             */
+            void runTask(
+                    _In_ std::shared_ptr<TaskBatch> batch,
+                    _Inout_ std::unique_lock<std::mutex>& lock);
+
+            void timerThreadFunction();
+
+            void workerThreadFunction();
+
+        private:
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_timerCv;
+
+            std::condition_variable m_readyCv;
+
+            std::condition_variable m_doneCv;
+
+            bool m_runThread;
+
+            JobId m_nextJobId;
+
+            std::map<JobId, std::shared_ptr<Job>> m_jobs;
+
+            /**
+             * @brief Jobs removed without wait while running, kept until
+             * run finishes.
+             */
+            std::map<JobId, std::shared_ptr<Job>> m_removedJobs;
+
+            std::vector<std::list<WheelEntry>> m_wheel;
+
+            TimePoint m_start;
+
+            uint64_t m_currentTick;
+
+            std::deque<std::shared_ptr<Job>> m_ready;
+
+            std::deque<std::shared_ptr<TaskBatch>> m_batches;
+
+            std::mt19937 m_random;
+
+            std::shared_ptr<std::thread> m_timerThread;
+
+            std::vector<std::shared_ptr<std::thread>> m_workerThreads;
+    };
+}
@@ -4,6 +4,13 @@
 #include "swss/logger.h"
 
 #include "meta/sai_serialize.h"
+#include "meta/NotificationFdbEvent.h"
+#include "meta/NotificationNatEvent.h"
+#include "meta/NotificationPortStateChange.h"
+#include "meta/NotificationQueuePfcDeadlock.h"
+#include "meta/NotificationSwitchShutdownRequest.h"
+#include "meta/NotificationSwitchStateChange.h"
+#include "meta/NotificationBfdSessionStateChange.h"
 
 #include <inttypes.h>
 
@@ -128,18 +135,48 @@ void NotificationHandler::updateNotificationsPointers(
     }
 }
 
-// TODO use same Notification class from sairedis lib
-// then this will handle deserialize free
-
 void NotificationHandler::onFdbEvent(
         _In_ uint32_t count,
         _In_ const sai_fdb_event_notification_data_t *data)
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_fdb_event_ntf(count, data);
+    auto timestamp = getCallbackTimestamp();
+
+    auto filter = m_processor->getFdbEventFilter();
+
+    if (!filter)
+    {
+        enqueueNotification(std::make_shared<sairedis::NotificationFdbEvent>(count, data), timestamp);
+        return;
+    }
+
+    // events are filtered before they are deep copied, kept events still
+    // point to vendor data
+
+    std::vector<sai_fdb_event_notification_data_t> events;
+
+    events.reserve(count);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        if (!filter->suppress(data[idx]))
+        {
+            events.push_back(data[idx]);
+        }
+    }
+
+    if (events.empty())
+    {
+        return;
+    }
+
+    if (!enqueueNotification(std::make_shared<sairedis::NotificationFdbEvent>((uint32_t)events.size(), events.data()), timestamp))
+    {
+        // dropped events must not suppress their next occurrence
 
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, s);
+        filter->invalidate();
+    }
 }
 
 void NotificationHandler::onNatEvent(
@@ -148,9 +185,9 @@ void NotificationHandler::onNatEvent(
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_nat_event_ntf(count, data);
+    auto timestamp = getCallbackTimestamp();
 
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, s);
+    enqueueNotification(std::make_shared<sairedis::NotificationNatEvent>(count, data), timestamp);
 }
 
 void NotificationHandler::onPortStateChange(
@@ -159,9 +196,9 @@ void NotificationHandler::onPortStateChange(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_port_oper_status_ntf(count, data);
+    auto timestamp = getCallbackTimestamp();
 
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE, s);
+    enqueueNotification(std::make_shared<sairedis::NotificationPortStateChange>(count, data), timestamp);
 }
 
 void NotificationHandler::onQueuePfcDeadlock(
@@ -170,9 +207,9 @@ void NotificationHandler::onQueuePfcDeadlock(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_queue_deadlock_ntf(count, data);
+    auto timestamp = getCallbackTimestamp();
 
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK, s);
+    enqueueNotification(std::make_shared<sairedis::NotificationQueuePfcDeadlock>(count, data), timestamp);
 }
 
 void NotificationHandler::onSwitchShutdownRequest(
@@ -180,9 +217,9 @@ void NotificationHandler::onSwitchShutdownRequest(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_switch_shutdown_request(switch_id);
+    auto timestamp = getCallbackTimestamp();
 
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST, s);
+    enqueueNotification(std::make_shared<sairedis::NotificationSwitchShutdownRequest>(switch_id), timestamp);
 }
 
 void NotificationHandler::onSwitchStateChange(
@@ -191,9 +228,9 @@ void NotificationHandler::onSwitchStateChange(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_switch_oper_status(switch_id, switch_oper_status);
+    auto timestamp = getCallbackTimestamp();
 
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, s);
+    enqueueNotification(std::make_shared<sairedis::NotificationSwitchStateChange>(switch_id, switch_oper_status), timestamp);
 }
 
 void NotificationHandler::onBfdSessionStateChange(
@@ -202,36 +239,45 @@ void NotificationHandler::onBfdSessionStateChange(
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_bfd_session_state_ntf(count, data);
+    auto timestamp = getCallbackTimestamp();
 
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE, s);
+    enqueueNotification(std::make_shared<sairedis::NotificationBfdSessionStateChange>(count, data), timestamp);
 }
 
-void NotificationHandler::enqueueNotification(
-        _In_ const std::string& op,
-        _In_ const std::string& data,
-        _In_ const std::vector<swss::FieldValueTuple> &entry)
+uint64_t NotificationHandler::getCallbackTimestamp() const
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s %s", op.c_str(), data.c_str());
-
-    swss::KeyOpFieldsValuesTuple item(op, data, entry);
+    // callback is stamped before notification data is copied
 
-    if (m_notificationQueue->enqueue(item))
-    {
-        m_processor->signal();
-    }
+    return m_processor->getTracer() ? NotificationTracer::now() : 0;
 }
 
-void NotificationHandler::enqueueNotification(
-        _In_ const std::string& op,
-        _In_ const std::string& data)
+bool NotificationHandler::enqueueNotification(
+        _In_ std::shared_ptr<sairedis::Notification> notification,
+        _In_ uint64_t timestamp)
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry;
+    if (timestamp)
+    {
+        notification->setTraceTimestamp(sairedis::Notification::TRACE_STAGE_CALLBACK, timestamp);
+    }
 
-    enqueueNotification(op, data, entry);
-}
+    /*
+     * Notification data is deep copied here and it will be serialized on
+     * processor thread, so vendor callback thread is not blocked by
+     * serialization.
+     */
+
+    SWSS_LOG_INFO("%s", notification->getName());
+
+    if (m_notificationQueue->enqueue(notification))
+    {
+        m_processor->signal();
+
+        return true;
+    }
 
+    return false;
+}
@@ -66,14 +66,18 @@ namespace syncd
 
         private:
 
-            void enqueueNotification(
-                    _In_ const std::string& op,
-                    _In_ const std::string& data,
-                    _In_ const std::vector<swss::FieldValueTuple> &entry);
-
-            void enqueueNotification(
-                    _In_ const std::string& op,
-                    _In_ const std::string& data);
+            /**
+             * @brief Get callback timestamp, zero when notifications are not
+             * traced.
+             */
+            uint64_t getCallbackTimestamp() const;
+
+            /**
+             * @return False if notification was dropped by queue.
+             */
+            bool enqueueNotification(
+                    _In_ std::shared_ptr<sairedis::Notification> notification,
+                    _In_ uint64_t timestamp);
 
         private:
 
@@ -5,11 +5,13 @@
 
 #include "meta/sai_serialize.h"
 #include "meta/SaiAttributeList.h"
+#include "meta/NotificationFactory.h"
 
 #include "swss/logger.h"
 #include "swss/notificationproducer.h"
 
 #include <inttypes.h>
+#include <algorithm>
 
 using namespace syncd;
 using namespace saimeta;
@@ -17,7 +19,7 @@ using namespace saimeta;
 NotificationProcessor::NotificationProcessor(
         _In_ std::shared_ptr<NotificationProducerBase> producer,
         _In_ std::shared_ptr<RedisClient> client,
-        _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer):
+        _In_ std::function<void(const std::vector<std::shared_ptr<sairedis::Notification>>&)> synchronizer):
     m_synchronizer(synchronizer),
     m_client(client),
     m_notifications(producer)
@@ -26,7 +28,23 @@ NotificationProcessor::NotificationProcessor(
 
     m_runThread = false;
 
+    m_idle = false;
+
     m_notificationQueue = std::make_shared<NotificationQueue>();
+
+    m_laneStatsTime = std::chrono::steady_clock::now();
+
+    m_sendBatchSize = NOTIFICATION_SEND_BATCH_SIZE;
+
+    m_sendBatchCount = 0;
+
+    m_traceCallbackTime = 0;
+
+    m_sendBatchCallbackTime = 0;
+
+    m_tracePublishTime = std::chrono::steady_clock::now();
+
+    m_fdbEventFilterPublishTime = std::chrono::steady_clock::now();
 }
 
 NotificationProcessor::~NotificationProcessor()
@@ -47,6 +65,13 @@ void NotificationProcessor::sendNotification(
 
     m_notifications->send(op, data, entry);
 
+    if (m_ring)
+    {
+        // already serialized data is shared by all local subscribers
+
+        m_ring->write(op, data);
+    }
+
     SWSS_LOG_DEBUG("notification send successfully");
 }
 
@@ -56,11 +81,116 @@ void NotificationProcessor::sendNotification(
 {
     SWSS_LOG_ENTER();
 
+    flushSendBatch();
+
     std::vector<swss::FieldValueTuple> entry;
 
+    if (m_traceCallbackTime)
+    {
+        entry.emplace_back(REDIS_NOTIFICATION_FIELD_TIMESTAMP, std::to_string(m_traceCallbackTime));
+    }
+
     sendNotification(op, data, entry);
 }
 
+void NotificationProcessor::sendBatchedNotification(
+        _In_ const std::string& op,
+        _In_ const std::string& data,
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_sendBatchSize <= 1)
+    {
+        sendNotification(op, data);
+        return;
+    }
+
+    if (count == 0 || data.size() < 2)
+    {
+        return;
+    }
+
+    if (op != m_sendBatchOp)
+    {
+        flushSendBatch();
+
+        m_sendBatchOp = op;
+    }
+
+    if (m_sendBatchCount == 0)
+    {
+        m_sendBatchTime = std::chrono::steady_clock::now();
+
+        m_sendBatchCallbackTime = m_traceCallbackTime;
+    }
+    else
+    {
+        m_sendBatchData += ",";
+    }
+
+    // data is json array, append its items without brackets
+
+    m_sendBatchData.append(data, 1, data.size() - 2);
+
+    m_sendBatchCount += count;
+
+    if (m_sendBatchCount >= m_sendBatchSize ||
+            std::chrono::steady_clock::now() - m_sendBatchTime >= std::chrono::milliseconds(NOTIFICATION_SEND_BATCH_LATENCY))
+    {
+        flushSendBatch();
+    }
+}
+
+void NotificationProcessor::flushSendBatch()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_sendBatchCount == 0)
+    {
+        return;
+    }
+
+    SWSS_LOG_DEBUG("sending %zu batched %s events", m_sendBatchCount, m_sendBatchOp.c_str());
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    if (m_sendBatchCallbackTime)
+    {
+        entry.emplace_back(REDIS_NOTIFICATION_FIELD_TIMESTAMP, std::to_string(m_sendBatchCallbackTime));
+    }
+
+    sendNotification(m_sendBatchOp, "[" + m_sendBatchData + "]", entry);
+
+    m_sendBatchData.clear();
+
+    m_sendBatchCount = 0;
+
+    m_sendBatchCallbackTime = 0;
+
+    if (m_sendBatchTraced.size())
+    {
+        auto now = NotificationTracer::now();
+
+        for (auto& notification: m_sendBatchTraced)
+        {
+            m_tracer->record(*notification, now);
+        }
+
+        m_sendBatchTraced.clear();
+    }
+}
+
+void NotificationProcessor::setSendBatchSize(
+        _In_ size_t batchSize)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("setting notification send batch size to %zu", batchSize);
+
+    m_sendBatchSize = batchSize;
+}
+
 void NotificationProcessor::process_on_switch_state_change(
         _In_ sai_object_id_t switch_rid,
         _In_ sai_switch_oper_status_t switch_oper_status)
@@ -103,35 +233,11 @@ void NotificationProcessor::redisPutFdbEntryToAsicView(
 
     // NOTE: this fdb entry already contains translated RID to VID
 
-    std::vector<swss::FieldValueTuple> entry;
-
-    entry = SaiAttributeList::serialize_attr_list(
-            SAI_OBJECT_TYPE_FDB_ENTRY,
-            fdb->attr_count,
-            fdb->attr,
-            false);
-
-    sai_object_meta_key_t metaKey;
-
-    metaKey.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
-    metaKey.objectkey.key.fdb_entry = fdb->fdb_entry;
-
-    std::string strFdbEntry = sai_serialize_fdb_entry(fdb->fdb_entry);
-
     if ((fdb->fdb_entry.switch_id == SAI_NULL_OBJECT_ID ||
          fdb->fdb_entry.bv_id == SAI_NULL_OBJECT_ID) &&
         (fdb->event_type != SAI_FDB_EVENT_FLUSHED))
     {
-        SWSS_LOG_WARN("skipped to put int db: %s", strFdbEntry.c_str());
-        return;
-    }
-
-    if (fdb->event_type == SAI_FDB_EVENT_AGED)
-    {
-        SWSS_LOG_DEBUG("remove fdb entry %s for SAI_FDB_EVENT_AGED",
-                sai_serialize_object_meta_key(metaKey).c_str());
-
-        m_client->removeAsicObject(metaKey);
+        SWSS_LOG_WARN("skipped to put int db: %s", sai_serialize_fdb_entry(fdb->fdb_entry).c_str());
         return;
     }
 
@@ -156,19 +262,45 @@ void NotificationProcessor::redisPutFdbEntryToAsicView(
             }
         }
 
+        // flush script operates on entries in database
+
+        flushFdbAsicUpdates();
+
         m_client->processFlushEvent(fdb->fdb_entry.switch_id, port_oid, bv_id, type);
         return;
     }
 
+    sai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
+    metaKey.objectkey.key.fdb_entry = fdb->fdb_entry;
+
+    if (fdb->event_type == SAI_FDB_EVENT_AGED)
+    {
+        auto key = sai_serialize_object_meta_key(metaKey);
+
+        SWSS_LOG_DEBUG("remove fdb entry %s for SAI_FDB_EVENT_AGED", key.c_str());
+
+        auto& update = m_fdbAsicUpdates[key];
+
+        update.remove = true;
+        update.create = false;
+        update.attrs.clear();
+        return;
+    }
+
     if (fdb->event_type == SAI_FDB_EVENT_LEARNED || fdb->event_type == SAI_FDB_EVENT_MOVE)
     {
-        if (fdb->event_type == SAI_FDB_EVENT_MOVE)
-        {
-            SWSS_LOG_DEBUG("remove fdb entry %s for SAI_FDB_EVENT_MOVE",
-                    sai_serialize_object_meta_key(metaKey).c_str());
+        auto key = sai_serialize_object_meta_key(metaKey);
+
+        std::vector<swss::FieldValueTuple> entry;
+
+        entry = SaiAttributeList::serialize_attr_list(
+                SAI_OBJECT_TYPE_FDB_ENTRY,
+                fdb->attr_count,
+                fdb->attr,
+                false);
 
-            m_client->removeAsicObject(metaKey);
-        }
         // currently we need to add type manually since fdb event don't contain type
         sai_attribute_t attr;
 
@@ -195,7 +327,34 @@ void NotificationProcessor::redisPutFdbEntryToAsicView(
 
         entry.emplace_back(strAttrId, strAttrValue);
 
-        m_client->createAsicObject(metaKey, entry);
+        auto& update = m_fdbAsicUpdates[key];
+
+        if (fdb->event_type == SAI_FDB_EVENT_MOVE)
+        {
+            SWSS_LOG_DEBUG("remove fdb entry %s for SAI_FDB_EVENT_MOVE", key.c_str());
+
+            update.remove = true;
+            update.attrs.clear();
+        }
+
+        // learn on existing entry updates its attributes, same as hmset
+
+        for (auto& fv: entry)
+        {
+            auto it = std::find_if(update.attrs.begin(), update.attrs.end(),
+                    [&](const swss::FieldValueTuple& a) { return fvField(a) == fvField(fv); });
+
+            if (it == update.attrs.end())
+            {
+                update.attrs.push_back(std::move(fv));
+            }
+            else
+            {
+                fvValue(*it) = std::move(fvValue(fv));
+            }
+        }
+
+        update.create = true;
         return;
     }
 
@@ -203,6 +362,42 @@ void NotificationProcessor::redisPutFdbEntryToAsicView(
             sai_serialize_fdb_event(fdb->event_type).c_str());
 }
 
+void NotificationProcessor::flushFdbAsicUpdates()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fdbAsicUpdates.empty())
+    {
+        return;
+    }
+
+    std::vector<std::string> removeKeys;
+
+    std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> createHash;
+
+    for (auto& kvp: m_fdbAsicUpdates)
+    {
+        if (kvp.second.remove)
+        {
+            removeKeys.push_back(kvp.first);
+        }
+
+        if (kvp.second.create)
+        {
+            createHash[kvp.first] = std::move(kvp.second.attrs);
+        }
+    }
+
+    SWSS_LOG_INFO("updating %zu fdb entries in ASIC_DB: %zu removes, %zu creates",
+            m_fdbAsicUpdates.size(),
+            removeKeys.size(),
+            createHash.size());
+
+    m_fdbAsicUpdates.clear();
+
+    m_client->updateAsicObjects(removeKeys, createHash);
+}
+
 /**
  * @Brief Check FDB event notification data.
  *
@@ -346,7 +541,7 @@ void NotificationProcessor::process_on_fdb_event(
     {
         std::string s = sai_serialize_fdb_event_ntf(count, data);
 
-        sendNotification(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, s);
+        sendBatchedNotification(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, s, count);
     }
     else
     {
@@ -426,7 +621,7 @@ void NotificationProcessor::process_on_nat_event(
     {
         std::string s = sai_serialize_nat_event_ntf(count, data);
 
-        sendNotification(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, s);
+        sendBatchedNotification(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, s, count);
     }
     else
     {
@@ -549,116 +744,188 @@ void NotificationProcessor::process_on_switch_shutdown_request(
 }
 
 void NotificationProcessor::handle_switch_state_change(
-        _In_ const std::string &data)
+        _In_ std::shared_ptr<sairedis::NotificationSwitchStateChange> ntf)
 {
     SWSS_LOG_ENTER();
 
-    sai_switch_oper_status_t switch_oper_status;
-    sai_object_id_t switch_id;
-
-    sai_deserialize_switch_oper_status(data, switch_id, switch_oper_status);
-
-    process_on_switch_state_change(switch_id, switch_oper_status);
+    process_on_switch_state_change(ntf->getSwitchId(), ntf->getSwitchOperStatus());
 }
 
 void NotificationProcessor::handle_fdb_event(
-        _In_ const std::string &data)
+        _In_ std::shared_ptr<sairedis::NotificationFdbEvent> ntf)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_fdb_event_notification_data_t *fdbevent = NULL;
-
-    sai_deserialize_fdb_event_ntf(data, count, &fdbevent);
-
-    if (contains_fdb_flush_event(count, fdbevent))
+    if (contains_fdb_flush_event(ntf->getCount(), ntf->getData()))
     {
-        SWSS_LOG_NOTICE("got fdb flush event: %s", data.c_str());
+        SWSS_LOG_NOTICE("got fdb flush event: %s", ntf->getSerializedNotification().c_str());
     }
 
-    process_on_fdb_event(count, fdbevent);
-
-    sai_deserialize_free_fdb_event_ntf(count, fdbevent);
+    process_on_fdb_event(ntf->getCount(), ntf->getData());
 }
 
 void NotificationProcessor::handle_nat_event(
-        _In_ const std::string &data)
+        _In_ std::shared_ptr<sairedis::NotificationNatEvent> ntf)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_nat_event_notification_data_t *natevent = NULL;
-
-    sai_deserialize_nat_event_ntf(data, count, &natevent);
+    process_on_nat_event(ntf->getCount(), ntf->getData());
+}
 
-    process_on_nat_event(count, natevent);
+void NotificationProcessor::handle_queue_deadlock(
+        _In_ std::shared_ptr<sairedis::NotificationQueuePfcDeadlock> ntf)
+{
+    SWSS_LOG_ENTER();
 
-    sai_deserialize_free_nat_event_ntf(count, natevent);
+    process_on_queue_deadlock_event(ntf->getCount(), ntf->getData());
 }
 
-void NotificationProcessor::handle_queue_deadlock(
-        _In_ const std::string &data)
+void NotificationProcessor::handle_port_state_change(
+        _In_ std::shared_ptr<sairedis::NotificationPortStateChange> ntf)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_queue_deadlock_notification_data_t *qdeadlockevent = NULL;
+    process_on_port_state_change(ntf->getCount(), ntf->getData());
+}
 
-    sai_deserialize_queue_deadlock_ntf(data, count, &qdeadlockevent);
+void NotificationProcessor::handle_bfd_session_state_change(
+        _In_ std::shared_ptr<sairedis::NotificationBfdSessionStateChange> ntf)
+{
+    SWSS_LOG_ENTER();
 
-    process_on_queue_deadlock_event(count, qdeadlockevent);
+    process_on_bfd_session_state_change(ntf->getCount(), ntf->getData());
+}
 
-    sai_deserialize_free_queue_deadlock_ntf(count, qdeadlockevent);
+void NotificationProcessor::handle_switch_shutdown_request(
+        _In_ std::shared_ptr<sairedis::NotificationSwitchShutdownRequest> ntf)
+{
+    SWSS_LOG_ENTER();
+
+    process_on_switch_shutdown_request(ntf->getSwitchId());
 }
 
-void NotificationProcessor::handle_port_state_change(
-        _In_ const std::string &data)
+void NotificationProcessor::processNotifications(
+        _In_ const std::vector<std::shared_ptr<sairedis::Notification>>& notifications)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_port_oper_status_notification_t *portoperstatus = NULL;
+    m_synchronizer(notifications);
+}
 
-    sai_deserialize_port_oper_status_ntf(data, count, &portoperstatus);
+void NotificationProcessor::syncProcessNotification(
+        _In_ std::shared_ptr<sairedis::Notification> notification)
+{
+    SWSS_LOG_ENTER();
 
-    process_on_port_state_change(count, portoperstatus);
+    dispatchNotification(notification);
 
-    sai_deserialize_free_port_oper_status_ntf(count, portoperstatus);
+    flushFdbAsicUpdates();
 }
 
-void NotificationProcessor::handle_bfd_session_state_change(
-        _In_ const std::string &data)
+void NotificationProcessor::syncProcessNotifications(
+        _In_ const std::vector<std::shared_ptr<sairedis::Notification>>& notifications)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_bfd_session_state_notification_t *bfdsessionstate = NULL;
+    for (auto& notification: notifications)
+    {
+        // single failing notification must not drop rest of the batch
 
-    sai_deserialize_bfd_session_state_ntf(data, count, &bfdsessionstate);
+        try
+        {
+            dispatchNotification(notification);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to process notification %s: %s", notification->getName(), e.what());
+        }
+    }
+
+    flushFdbAsicUpdates();
 
-    process_on_bfd_session_state_change(count, bfdsessionstate);
+    if (notifications.empty() || m_notificationQueue->getQueueSize() == 0)
+    {
+        // queue is drained, don't hold batched events any longer, batch is
+        // flushed here under synchronizer lock, since notification producer
+        // is shared with main thread
 
-    sai_deserialize_free_bfd_session_state_ntf(count, bfdsessionstate);
+        flushSendBatch();
+    }
 }
 
-void NotificationProcessor::handle_switch_shutdown_request(
-        _In_ const std::string &data)
+void NotificationProcessor::dispatchNotification(
+        _In_ std::shared_ptr<sairedis::Notification> notification)
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t switch_id;
+    bool traced = m_tracer && notification->isTraced();
+
+    if (traced)
+    {
+        notification->setTraceTimestamp(sairedis::Notification::TRACE_STAGE_PROCESS, NotificationTracer::now());
+
+        m_traceCallbackTime = NotificationTracer::toSystemTime(
+                notification->getTraceTimestamp(sairedis::Notification::TRACE_STAGE_CALLBACK));
+    }
+
+    switch (notification->getNotificationType())
+    {
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE:
+            handle_switch_state_change(std::dynamic_pointer_cast<sairedis::NotificationSwitchStateChange>(notification));
+            break;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT:
+            handle_fdb_event(std::dynamic_pointer_cast<sairedis::NotificationFdbEvent>(notification));
+            break;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT:
+            handle_nat_event(std::dynamic_pointer_cast<sairedis::NotificationNatEvent>(notification));
+            break;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE:
+            handle_port_state_change(std::dynamic_pointer_cast<sairedis::NotificationPortStateChange>(notification));
+            break;
 
-    sai_deserialize_switch_shutdown_request(data, switch_id);
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST:
+            handle_switch_shutdown_request(std::dynamic_pointer_cast<sairedis::NotificationSwitchShutdownRequest>(notification));
+            break;
 
-    process_on_switch_shutdown_request(switch_id);
+        case SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK:
+            handle_queue_deadlock(std::dynamic_pointer_cast<sairedis::NotificationQueuePfcDeadlock>(notification));
+            break;
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE:
+            handle_bfd_session_state_change(std::dynamic_pointer_cast<sairedis::NotificationBfdSessionStateChange>(notification));
+            break;
+
+        default:
+            SWSS_LOG_ERROR("unknown notification type: %d", notification->getNotificationType());
+            break;
+    }
+
+    if (traced)
+    {
+        traceNotification(notification);
+
+        m_traceCallbackTime = 0;
+    }
 }
 
-void NotificationProcessor::processNotification(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
+void NotificationProcessor::traceNotification(
+        _In_ std::shared_ptr<sairedis::Notification> notification)
 {
     SWSS_LOG_ENTER();
 
-    m_synchronizer(item);
+    auto type = notification->getNotificationType();
+
+    if (m_sendBatchCount &&
+            (type == SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT || type == SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT))
+    {
+        m_sendBatchTraced.push_back(notification);
+        return;
+    }
+
+    m_tracer->record(*notification, NotificationTracer::now());
 }
 
 void NotificationProcessor::syncProcessNotification(
@@ -666,67 +933,177 @@ void NotificationProcessor::syncProcessNotification(
 {
     SWSS_LOG_ENTER();
 
-    std::string notification = kfvKey(item);
-    std::string data = kfvOp(item);
+    std::shared_ptr<sairedis::Notification> notification;
 
-    if (notification == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE)
+    try
     {
-        handle_switch_state_change(data);
+        notification = sairedis::NotificationFactory::deserialize(kfvKey(item), kfvOp(item));
     }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)
+    catch (const std::exception& e)
     {
-        handle_fdb_event(data);
+        SWSS_LOG_ERROR("failed to deserialize notification %s: %s", kfvKey(item).c_str(), e.what());
+
+        return;
     }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT)
+
+    syncProcessNotification(notification);
+}
+
+void NotificationProcessor::ntf_process_function()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<sairedis::Notification>> items;
+
+    while (true)
     {
-        handle_nat_event(data);
+        {
+            std::unique_lock<std::mutex> ulock(m_signalMutex);
+
+            m_idle = true;
+
+            m_cv.wait(ulock, [&]{ return !m_runThread || m_notificationQueue->getQueueSize(); });
+
+            m_idle = false;
+        }
+
+        // this is notifications processing thread context, which is different
+        // from SAI notifications context, we can safe use syncd mutex here,
+        // processing each batch of notifications is under same mutex as
+        // processing main events, counters and reinit
+
+        while (m_notificationQueue->tryDequeueMany(items, NOTIFICATION_PROCESSOR_BATCH_SIZE))
+        {
+            processNotifications(items);
+        }
+
+        if (m_sendBatchCount)
+        {
+            // queued events could be coalesced after last batch was
+            // processed, empty batch will flush pending send batch
+
+            processNotifications({});
+        }
+
+        logLaneStats();
+
+        publishTrace();
+
+        publishFdbEventFilter();
+
+        if (!m_runThread)
+        {
+            break;
+        }
     }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE)
+}
+
+void NotificationProcessor::logLaneStats()
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (now - m_laneStatsTime < std::chrono::seconds(NOTIFICATION_LANE_STATS_INTERVAL))
     {
-        handle_port_state_change(data);
+        return;
     }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST)
+
+    m_laneStatsTime = now;
+
+    for (int lane = 0; lane < NotificationQueue::LANE_COUNT; lane++)
     {
-        handle_switch_shutdown_request(data);
+        auto stats = m_notificationQueue->getLaneStats((NotificationQueue::Lane)lane);
+
+        SWSS_LOG_NOTICE("notification lane %s: depth %zu, max depth %zu, enqueued %zu, dropped %zu, avg latency %" PRIu64 " us, max latency %" PRIu64 " us",
+                NotificationQueue::getLaneName((NotificationQueue::Lane)lane),
+                stats.depth,
+                stats.maxDepth,
+                stats.enqueued,
+                stats.dropped,
+                stats.dequeued ? stats.totalLatency / stats.dequeued : 0,
+                stats.maxLatency);
     }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK)
+}
+
+void NotificationProcessor::publishTrace()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_tracer)
     {
-        handle_queue_deadlock(data);
+        return;
     }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE)
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (now - m_tracePublishTime < std::chrono::seconds(NOTIFICATION_TRACE_PUBLISH_INTERVAL))
     {
-        handle_bfd_session_state_change(data);
+        return;
     }
-    else
+
+    m_tracePublishTime = now;
+
+    m_tracer->publish();
+}
+
+void NotificationProcessor::publishFdbEventFilter()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_fdbEventFilter)
     {
-        SWSS_LOG_ERROR("unknown notification: %s", notification.c_str());
+        return;
     }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (now - m_fdbEventFilterPublishTime < std::chrono::seconds(FDB_EVENT_FILTER_PUBLISH_INTERVAL))
+    {
+        return;
+    }
+
+    m_fdbEventFilterPublishTime = now;
+
+    m_fdbEventFilter->publish();
 }
 
-void NotificationProcessor::ntf_process_function()
+void NotificationProcessor::setTracer(
+        _In_ std::shared_ptr<NotificationTracer> tracer)
 {
     SWSS_LOG_ENTER();
 
-    std::mutex ntf_mutex;
+    m_tracer = tracer;
+}
 
-    std::unique_lock<std::mutex> ulock(ntf_mutex);
+std::shared_ptr<NotificationTracer> NotificationProcessor::getTracer() const
+{
+    SWSS_LOG_ENTER();
 
-    while (m_runThread)
-    {
-        m_cv.wait(ulock);
+    return m_tracer;
+}
 
-        // this is notifications processing thread context, which is different
-        // from SAI notifications context, we can safe use syncd mutex here,
-        // processing each notification is under same mutex as processing main
-        // events, counters and reinit
+void NotificationProcessor::setRing(
+        _In_ std::shared_ptr<NotificationRingWriter> ring)
+{
+    SWSS_LOG_ENTER();
 
-        swss::KeyOpFieldsValuesTuple item;
+    m_ring = ring;
+}
 
-        while (m_notificationQueue->tryDequeue(item))
-        {
-            processNotification(item);
-        }
-    }
+void NotificationProcessor::setFdbEventFilter(
+        _In_ std::shared_ptr<FdbEventFilter> filter)
+{
+    SWSS_LOG_ENTER();
+
+    m_fdbEventFilter = filter;
+}
+
+std::shared_ptr<FdbEventFilter> NotificationProcessor::getFdbEventFilter() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_fdbEventFilter;
 }
 
 void NotificationProcessor::startNotificationsProcessingThread()
@@ -742,9 +1119,13 @@ void NotificationProcessor::stopNotificationsProcessingThread()
 {
     SWSS_LOG_ENTER();
 
-    m_runThread = false;
+    {
+        std::lock_guard<std::mutex> lock(m_signalMutex);
 
-    m_cv.notify_all();
+        m_runThread = false;
+
+        m_cv.notify_all();
+    }
 
     if (m_ntf_process_thread != nullptr)
     {
@@ -758,7 +1139,15 @@ void NotificationProcessor::signal()
 {
     SWSS_LOG_ENTER();
 
-    m_cv.notify_all();
+    // notification was already queued, so if processing thread is not idle,
+    // it will dequeue it before waiting again
+
+    if (m_idle)
+    {
+        std::lock_guard<std::mutex> lock(m_signalMutex);
+
+        m_cv.notify_all();
+    }
 }
 
 std::shared_ptr<NotificationQueue> NotificationProcessor::getQueue() const
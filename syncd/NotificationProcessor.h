@@ -4,6 +4,17 @@
 #include "VirtualOidTranslator.h"
 #include "RedisClient.h"
 #include "NotificationProducerBase.h"
+#include "NotificationTracer.h"
+#include "NotificationRingWriter.h"
+#include "FdbEventFilter.h"
+
+#include "meta/NotificationFdbEvent.h"
+#include "meta/NotificationNatEvent.h"
+#include "meta/NotificationPortStateChange.h"
+#include "meta/NotificationQueuePfcDeadlock.h"
+#include "meta/NotificationSwitchShutdownRequest.h"
+#include "meta/NotificationSwitchStateChange.h"
+#include "meta/NotificationBfdSessionStateChange.h"
 
 #include "swss/notificationproducer.h"
 
@@ -11,6 +22,30 @@
 #include <memory>
 #include <condition_variable>
 #include <functional>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * @brief Interval of notification queue lanes statistics log (in seconds).
+ */
+#define NOTIFICATION_LANE_STATS_INTERVAL (60)
+
+/**
+ * @brief Max number of notifications processed under single syncd lock.
+ */
+#define NOTIFICATION_PROCESSOR_BATCH_SIZE (128)
+
+/**
+ * @brief Max number of FDB or NAT events sent in single notification.
+ */
+#define NOTIFICATION_SEND_BATCH_SIZE (256)
+
+/**
+ * @brief Max time (in milliseconds) events are held in send batch.
+ */
+#define NOTIFICATION_SEND_BATCH_LATENCY (10)
 
 namespace syncd
 {
@@ -21,7 +56,7 @@ namespace syncd
             NotificationProcessor(
                     _In_ std::shared_ptr<NotificationProducerBase> producer,
                     _In_ std::shared_ptr<RedisClient> client,
-                    _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer);
+                    _In_ std::function<void(const std::vector<std::shared_ptr<sairedis::Notification>>&)> synchronizer);
 
             virtual ~NotificationProcessor();
 
@@ -35,19 +70,91 @@ namespace syncd
 
             void stopNotificationsProcessingThread();
 
+            /**
+             * @brief Set max number of events in batched notification, value
+             * 1 disables batching.
+             */
+            void setSendBatchSize(
+                    _In_ size_t batchSize);
+
+            /**
+             * @brief Send pending batched notification.
+             */
+            void flushSendBatch();
+
+            /**
+             * @brief Enable tracing of notifications, null disables tracing.
+             *
+             * Must be set before processing thread is started.
+             */
+            void setTracer(
+                    _In_ std::shared_ptr<NotificationTracer> tracer);
+
+            std::shared_ptr<NotificationTracer> getTracer() const;
+
+            /**
+             * @brief Also write sent notifications to shared memory ring for
+             * local subscribers, null disables ring.
+             *
+             * Must be set before processing thread is started.
+             */
+            void setRing(
+                    _In_ std::shared_ptr<NotificationRingWriter> ring);
+
+            /**
+             * @brief Enable suppression of duplicate FDB events in vendor
+             * callback, null disables filter.
+             *
+             * Must be set before processing thread is started.
+             */
+            void setFdbEventFilter(
+                    _In_ std::shared_ptr<FdbEventFilter> filter);
+
+            std::shared_ptr<FdbEventFilter> getFdbEventFilter() const;
+
         private:
 
             void ntf_process_function();
 
+            void logLaneStats();
+
+            void publishTrace();
+
+            void publishFdbEventFilter();
+
+            /**
+             * @brief Record latencies of processed notification, batched
+             * events are recorded when batch is sent.
+             */
+            void traceNotification(
+                    _In_ std::shared_ptr<sairedis::Notification> notification);
+
             void sendNotification(
                     _In_ const std::string& op,
                     _In_ const std::string& data,
                     _In_ std::vector<swss::FieldValueTuple> entry);
 
+            /**
+             * @brief Send notification, pending batched notification is sent
+             * first to preserve order.
+             */
             void sendNotification(
                     _In_ const std::string& op,
                     _In_ const std::string& data);
 
+            /**
+             * @brief Add events to batched notification.
+             *
+             * Events of consecutive notifications of the same type are
+             * merged into single notification array, which is the same
+             * format as notification with multiple events, so receivers
+             * don't need to be aware of batching.
+             */
+            void sendBatchedNotification(
+                    _In_ const std::string& op,
+                    _In_ const std::string& data,
+                    _In_ uint32_t count);
+
             sai_fdb_entry_type_t getFdbEntryType(
                     _In_ uint32_t count,
                     _In_ const sai_attribute_t *list);
@@ -55,6 +162,11 @@ namespace syncd
             void redisPutFdbEntryToAsicView(
                     _In_ const sai_fdb_event_notification_data_t *fdb);
 
+            void flushFdbAsicUpdates();
+
+            void dispatchNotification(
+                    _In_ std::shared_ptr<sairedis::Notification> notification);
+
             bool check_fdb_event_notification_data(
                     _In_ const sai_fdb_event_notification_data_t& data);
 
@@ -98,31 +210,55 @@ namespace syncd
         private: // handlers
 
             void handle_switch_state_change(
-                    _In_ const std::string &data);
+                    _In_ std::shared_ptr<sairedis::NotificationSwitchStateChange> ntf);
 
             void handle_fdb_event(
-                    _In_ const std::string &data);
+                    _In_ std::shared_ptr<sairedis::NotificationFdbEvent> ntf);
 
             void handle_nat_event(
-                    _In_ const std::string &data);
+                    _In_ std::shared_ptr<sairedis::NotificationNatEvent> ntf);
 
             void handle_queue_deadlock(
-                    _In_ const std::string &data);
+                    _In_ std::shared_ptr<sairedis::NotificationQueuePfcDeadlock> ntf);
 
             void handle_port_state_change(
-                    _In_ const std::string &data);
+                    _In_ std::shared_ptr<sairedis::NotificationPortStateChange> ntf);
 
             void handle_bfd_session_state_change(
-                    _In_ const std::string &data);
+                    _In_ std::shared_ptr<sairedis::NotificationBfdSessionStateChange> ntf);
 
             void handle_switch_shutdown_request(
-                    _In_ const std::string &data);
+                    _In_ std::shared_ptr<sairedis::NotificationSwitchShutdownRequest> ntf);
 
-            void processNotification(
-                    _In_ const swss::KeyOpFieldsValuesTuple& item);
+            void processNotifications(
+                    _In_ const std::vector<std::shared_ptr<sairedis::Notification>>& notifications);
 
         public:
 
+            /**
+             * @brief Process notification received from vendor callback.
+             *
+             * Notification data is translated from RID to VID in place and
+             * serialized when it is sent.
+             */
+            void syncProcessNotification(
+                    _In_ std::shared_ptr<sairedis::Notification> notification);
+
+            /**
+             * @brief Process batch of notifications.
+             *
+             * ASIC_DB updates caused by FDB events are merged per FDB entry
+             * and written in single round trip after whole batch. Batched
+             * events are sent when queue is drained or batch is empty.
+             *
+             * Must be called under synchronizer lock.
+             */
+            void syncProcessNotifications(
+                    _In_ const std::vector<std::shared_ptr<sairedis::Notification>>& notifications);
+
+            /**
+             * @brief Process serialized notification.
+             */
             void syncProcessNotification(
                     _In_ const swss::KeyOpFieldsValuesTuple& item);
 
@@ -141,14 +277,80 @@ namespace syncd
 
             std::condition_variable m_cv;
 
+            std::mutex m_signalMutex;
+
             // determine whether notification thread is running
 
-            bool m_runThread;
+            std::atomic<bool> m_runThread;
+
+            // processing thread is waiting for notifications, when it's not,
+            // it will drain queue before waiting and signal is not needed
 
-            std::function<void(const swss::KeyOpFieldsValuesTuple&)> m_synchronizer;
+            std::atomic<bool> m_idle;
+
+            std::function<void(const std::vector<std::shared_ptr<sairedis::Notification>>&)> m_synchronizer;
 
             std::shared_ptr<RedisClient> m_client;
 
             std::shared_ptr<NotificationProducerBase> m_notifications;
+
+            std::chrono::steady_clock::time_point m_laneStatsTime;
+
+            // batched notification, used only by processing thread
+
+            size_t m_sendBatchSize;
+
+            std::string m_sendBatchOp;
+
+            std::string m_sendBatchData;
+
+            size_t m_sendBatchCount;
+
+            std::chrono::steady_clock::time_point m_sendBatchTime;
+
+            typedef struct _FdbAsicUpdate
+            {
+                /**
+                 * @brief Entry is removed before it's created.
+                 */
+                bool remove;
+
+                bool create;
+
+                std::vector<swss::FieldValueTuple> attrs;
+
+            } FdbAsicUpdate;
+
+            /**
+             * @brief Pending ASIC_DB updates of FDB entries by serialized
+             * meta key, applied after processed batch.
+             */
+            std::unordered_map<std::string, FdbAsicUpdate> m_fdbAsicUpdates;
+
+            std::shared_ptr<NotificationTracer> m_tracer;
+
+            /**
+             * @brief Callback time (nanoseconds since epoch) of currently
+             * processed notification, zero if not traced.
+             */
+            uint64_t m_traceCallbackTime;
+
+            /**
+             * @brief Callback time of first traced event in send batch.
+             */
+            uint64_t m_sendBatchCallbackTime;
+
+            /**
+             * @brief Traced notifications with events in send batch.
+             */
+            std::vector<std::shared_ptr<sairedis::Notification>> m_sendBatchTraced;
+
+            std::chrono::steady_clock::time_point m_tracePublishTime;
+
+            std::shared_ptr<NotificationRingWriter> m_ring;
+
+            std::shared_ptr<FdbEventFilter> m_fdbEventFilter;
+
+            std::chrono::steady_clock::time_point m_fdbEventFilterPublishTime;
     };
 }
@@ -1,5 +1,8 @@
 #include "NotificationQueue.h"
-#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include <algorithm>
 
 #define NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR (1000)
 
@@ -14,11 +17,21 @@ NotificationQueue::NotificationQueue(
     m_thresholdLimit(consecutiveThresholdLimit),
     m_dropCount(0),
     m_lastEventCount(0),
-    m_lastEvent(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)
+    m_lastEvent(SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT),
+    m_fdbFlush({nullptr, 0, false}),
+    m_coalescedCount(0)
 {
     SWSS_LOG_ENTER();
 
-    // empty;
+    m_queueSize = 0;
+    m_controlLaneWeight = 0;
+    m_controlBurst = 0;
+
+    for (auto& lane: m_lanes)
+    {
+        lane.limit = queueLimit;
+        lane.stats = {};
+    }
 }
 
 NotificationQueue::~NotificationQueue()
@@ -29,19 +42,19 @@ NotificationQueue::~NotificationQueue()
 }
 
 bool NotificationQueue::enqueue(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
+        _In_ std::shared_ptr<sairedis::Notification> item)
 {
     MUTEX;
 
     SWSS_LOG_ENTER();
     bool candidateToDrop = false;
-    std::string currentEvent;
+    sai_switch_notification_type_t currentEvent;
 
     /*
-     * If the queue exceeds the limit, then drop all further FDB events This is
-     * a temporary solution to handle high memory usage by syncd and the
-     * notification queue keeps growing. The permanent solution would be to
-     * make this stateful so that only the *latest* event is published.
+     * FDB events are first coalesced with queued events of the same FDB
+     * entry, so only the *latest* state of each entry is published. If the
+     * queue still exceeds the limit, then drop remaining FDB events to handle
+     * high memory usage by syncd when notification queue keeps growing.
      *
      * We have also seen other notification storms that can also cause this queue issue
      * So the new scheme is to keep the last notification event and its consecutive count
@@ -49,8 +62,23 @@ bool NotificationQueue::enqueue(
      * will also be dropped regardless of its event type to protect the device from crashing due to
      * running out of memory
      */
-    auto queueSize = m_queue.size();
-    currentEvent = kfvKey(item);
+    currentEvent = item->getNotificationType();
+
+    std::shared_ptr<sairedis::NotificationFdbEvent> fdb;
+
+    if (currentEvent == SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT)
+    {
+        fdb = std::dynamic_pointer_cast<sairedis::NotificationFdbEvent>(item);
+    }
+
+    if (fdb && coalesceFdbEvent(*fdb))
+    {
+        return true;
+    }
+
+    auto& lane = m_lanes[getLane(currentEvent)];
+
+    auto queueSize = m_queueSize;
     if (currentEvent == m_lastEvent)
     {
         m_lastEventCount++;
@@ -60,13 +88,13 @@ bool NotificationQueue::enqueue(
         m_lastEventCount = 1;
         m_lastEvent = currentEvent;
     }
-    if (queueSize >= m_queueSizeLimit)
+    if (queueSize >= m_queueSizeLimit || lane.queue.size() >= lane.limit)
     {
         /* Too many queued up already check if notification fits condition to e dropped
-         * 1. All FDB events should be dropped at this point.
+         * 1. All FDB events which could not be coalesced should be dropped at this point.
          * 2. All other notification events will start to drop if it reached the consecutive threshold limit
          */
-        if (currentEvent == SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)
+        if (currentEvent == SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT)
         {
             candidateToDrop = true;
         }
@@ -81,41 +109,130 @@ bool NotificationQueue::enqueue(
 
     if (!candidateToDrop)
     {
-        m_queue.push(item);
+        if (fdb)
+        {
+            addFdbPendingEntries(*fdb);
+        }
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (item->isTraced())
+        {
+            item->setTraceTimestamp(sairedis::Notification::TRACE_STAGE_ENQUEUE,
+                    (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
+        }
+
+        lane.queue.push({std::move(item), now});
+
+        m_queueSize++;
+
+        lane.stats.enqueued++;
+        lane.stats.maxDepth = std::max(lane.stats.maxDepth, lane.queue.size());
 
         return true;
     }
 
     m_dropCount++;
 
+    lane.stats.dropped++;
+
     if (!(m_dropCount % NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR))
     {
         SWSS_LOG_NOTICE(
-                "Too many messages in queue (%zu), dropped (%zu), lastEventCount (%zu) Dropping %s !",
+                "Too many messages in queue (%zu), dropped (%zu), coalesced (%zu), lastEventCount (%zu) Dropping %s !",
                 queueSize,
-                m_dropCount, m_lastEventCount, m_lastEvent.c_str());
+                m_dropCount, m_coalescedCount, m_lastEventCount, item->getName());
     }
 
     return false;
 }
 
 bool NotificationQueue::tryDequeue(
-        _Out_ swss::KeyOpFieldsValuesTuple& item)
+        _Out_ std::shared_ptr<sairedis::Notification>& item)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return dequeue(item);
+}
+
+bool NotificationQueue::tryDequeueMany(
+        _Out_ std::vector<std::shared_ptr<sairedis::Notification>>& items,
+        _In_ size_t maxCount)
 {
     MUTEX;
 
     SWSS_LOG_ENTER();
 
-    if (m_queue.empty())
+    items.clear();
+
+    std::shared_ptr<sairedis::Notification> item;
+
+    while (items.size() < maxCount && dequeue(item))
     {
-        return false;
+        items.push_back(std::move(item));
     }
 
-    item = m_queue.front();
+    return !items.empty();
+}
+
+bool NotificationQueue::dequeue(
+        _Out_ std::shared_ptr<sairedis::Notification>& item)
+{
+    SWSS_LOG_ENTER();
+
+    while (m_queueSize)
+    {
+        auto& control = m_lanes[LANE_CONTROL];
+        auto& bulk = m_lanes[LANE_BULK];
 
-    m_queue.pop();
+        bool useBulk = control.queue.empty() ||
+            (m_controlLaneWeight && m_controlBurst >= m_controlLaneWeight && !bulk.queue.empty());
+
+        auto& lane = useBulk ? bulk : control;
+
+        m_controlBurst = useBulk ? 0 : m_controlBurst + 1;
+
+        auto now = std::chrono::steady_clock::now();
+
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                now - lane.queue.front().enqueueTime).count();
+
+        item = std::move(lane.queue.front().notification);
+
+        if (item->isTraced())
+        {
+            item->setTraceTimestamp(sairedis::Notification::TRACE_STAGE_DEQUEUE,
+                    (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
+        }
+
+        lane.queue.pop();
+
+        m_queueSize--;
+
+        lane.stats.dequeued++;
+        lane.stats.totalLatency += latency;
+        lane.stats.maxLatency = std::max(lane.stats.maxLatency, (uint64_t)latency);
+
+        if (item->getNotificationType() == SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT)
+        {
+            auto fdb = std::dynamic_pointer_cast<sairedis::NotificationFdbEvent>(item);
 
-    return true;
+            // notification is now owned by processor, it can't be modified
+
+            if (fdb && !removeFdbPendingEntries(*fdb))
+            {
+                // all entries were cancelled while queued
+
+                continue;
+            }
+        }
+
+        return true;
+    }
+
+    return false;
 }
 
 size_t NotificationQueue::getQueueSize()
@@ -124,5 +241,270 @@ size_t NotificationQueue::getQueueSize()
 
     SWSS_LOG_ENTER();
 
-    return m_queue.size();
+    return m_queueSize;
+}
+
+size_t NotificationQueue::getCoalescedCount()
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return m_coalescedCount;
+}
+
+size_t NotificationQueue::getDropCount()
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return m_dropCount;
+}
+
+void NotificationQueue::setLaneLimit(
+        _In_ Lane lane,
+        _In_ size_t limit)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("setting %s lane limit to %zu", getLaneName(lane), limit);
+
+    m_lanes[lane].limit = limit;
+}
+
+void NotificationQueue::setControlLaneWeight(
+        _In_ size_t weight)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("setting control lane weight to %zu", weight);
+
+    m_controlLaneWeight = weight;
+}
+
+NotificationQueue::LaneStats NotificationQueue::getLaneStats(
+        _In_ Lane lane)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto stats = m_lanes[lane].stats;
+
+    stats.depth = m_lanes[lane].queue.size();
+
+    return stats;
+}
+
+NotificationQueue::Lane NotificationQueue::getLane(
+        _In_ sai_switch_notification_type_t type)
+{
+    SWSS_LOG_ENTER();
+
+    switch (type)
+    {
+        case SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT:
+        case SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT:
+            return LANE_BULK;
+
+        default:
+            return LANE_CONTROL;
+    }
+}
+
+const char* NotificationQueue::getLaneName(
+        _In_ Lane lane)
+{
+    SWSS_LOG_ENTER();
+
+    switch (lane)
+    {
+        case LANE_CONTROL:
+            return "control";
+
+        case LANE_BULK:
+            return "bulk";
+
+        default:
+            SWSS_LOG_THROW("unknown lane: %d", lane);
+    }
+}
+
+bool NotificationQueue::coalesceFdbEvent(
+        _In_ sairedis::NotificationFdbEvent& fdb)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t count = fdb.getCount();
+
+    auto* data = fdb.getData();
+
+    std::vector<bool> coalesced(count, false);
+
+    bool anyCoalesced = false;
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        auto& entry = data[idx];
+
+        if (entry.event_type == SAI_FDB_EVENT_FLUSHED)
+        {
+            auto* flush = m_fdbFlush.notification;
+
+            if (flush && flush != &fdb &&
+                    sai_serialize_fdb_event_ntf(1, &entry) ==
+                    sai_serialize_fdb_event_ntf(1, &flush->getData()[m_fdbFlush.index]))
+            {
+                coalesced[idx] = anyCoalesced = true;
+                continue;
+            }
+
+            // events queued before flush must be processed before it
+
+            m_fdbPending.clear();
+            continue;
+        }
+
+        auto it = m_fdbPending.find(getFdbKey(entry));
+
+        if (it == m_fdbPending.end() || it->second.notification == &fdb)
+        {
+            continue;
+        }
+
+        auto& pending = it->second;
+
+        auto& pendingEntry = pending.notification->getData()[pending.index];
+
+        if (pending.learned && entry.event_type == SAI_FDB_EVENT_AGED)
+        {
+            // entry was learned and aged before orchagent saw it, net effect
+            // is absent entry, so both events are dropped
+
+            auto& cancelled = m_fdbCancelled[pending.notification];
+
+            cancelled.resize(pending.notification->getCount(), false);
+
+            cancelled[pending.index] = true;
+
+            m_fdbPending.erase(it);
+
+            m_coalescedCount++;
+
+            coalesced[idx] = anyCoalesced = true;
+            continue;
+        }
+
+        // keep learn type when entry was moved before orchagent saw it
+
+        auto eventType = (pendingEntry.event_type == SAI_FDB_EVENT_LEARNED && entry.event_type == SAI_FDB_EVENT_MOVE)
+            ? SAI_FDB_EVENT_LEARNED
+            : entry.event_type;
+
+        pending.notification->swapEntry(pending.index, fdb, idx);
+
+        pendingEntry.event_type = eventType;
+
+        coalesced[idx] = anyCoalesced = true;
+    }
+
+    if (!anyCoalesced)
+    {
+        return false;
+    }
+
+    fdb.removeEntries(coalesced);
+
+    uint32_t coalescedCount = count - fdb.getCount();
+
+    m_coalescedCount += coalescedCount;
+
+    SWSS_LOG_INFO("coalesced %u of %u fdb events, total coalesced %zu",
+            coalescedCount,
+            count,
+            m_coalescedCount);
+
+    return fdb.getCount() == 0;
+}
+
+void NotificationQueue::addFdbPendingEntries(
+        _In_ sairedis::NotificationFdbEvent& fdb)
+{
+    SWSS_LOG_ENTER();
+
+    auto* data = fdb.getData();
+
+    m_fdbFlush = {nullptr, 0, false};
+
+    for (uint32_t idx = 0; idx < fdb.getCount(); idx++)
+    {
+        if (data[idx].event_type == SAI_FDB_EVENT_FLUSHED)
+        {
+            // entries queued before flush can't be coalesced any more
+
+            m_fdbPending.clear();
+
+            m_fdbFlush = {&fdb, idx, false};
+        }
+        else
+        {
+            m_fdbPending[getFdbKey(data[idx])] = {&fdb, idx, data[idx].event_type == SAI_FDB_EVENT_LEARNED};
+
+            m_fdbFlush = {nullptr, 0, false};
+        }
+    }
+}
+
+bool NotificationQueue::removeFdbPendingEntries(
+        _In_ sairedis::NotificationFdbEvent& fdb)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fdbFlush.notification == &fdb)
+    {
+        m_fdbFlush = {nullptr, 0, false};
+    }
+
+    auto* data = fdb.getData();
+
+    for (uint32_t idx = 0; idx < fdb.getCount(); idx++)
+    {
+        auto it = m_fdbPending.find(getFdbKey(data[idx]));
+
+        if (it != m_fdbPending.end() && it->second.notification == &fdb)
+        {
+            m_fdbPending.erase(it);
+        }
+    }
+
+    auto cancelled = m_fdbCancelled.find(&fdb);
+
+    if (cancelled != m_fdbCancelled.end())
+    {
+        fdb.removeEntries(cancelled->second);
+
+        m_fdbCancelled.erase(cancelled);
+    }
+
+    return fdb.getCount() != 0;
+}
+
+sai_object_meta_key_t NotificationQueue::getFdbKey(
+        _In_ const sai_fdb_event_notification_data_t& data)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_meta_key_t key;
+
+    memset(&key, 0, sizeof(key));
+
+    key.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
+    key.objectkey.key.fdb_entry = data.fdb_entry;
+
+    return key;
 }
@@ -5,10 +5,18 @@ extern "C" {
 #include<saimetadata.h>
 }
 
+#include "meta/Notification.h"
+#include "meta/NotificationFdbEvent.h"
+#include "meta/MetaKeyHasher.h"
+
 #include "swss/table.h"
 
 #include <queue>
 #include <mutex>
+#include <memory>
+#include <unordered_map>
+#include <chrono>
+#include <vector>
 
 /**
  * @brief Default notification queue size limit.
@@ -30,8 +38,67 @@ extern "C" {
 
 namespace syncd
 {
+    /**
+     * @brief Queue of notifications received from vendor callbacks.
+     *
+     * Notifications are queued with their data deep copied, serialization
+     * happens on processor thread when notification is sent.
+     *
+     * FDB events are coalesced per FDB entry (switch, bv_id, mac) while they
+     * are waiting in queue, only net effect of learn, move and age sequence
+     * is kept in place of first queued event, and entry learned and aged
+     * before it was dequeued is dropped. Flush event is a barrier, events
+     * queued before flush are not coalesced with events after it, and flush
+     * identical to last queued flush is dropped as redundant.
+     *
+     * Notifications are queued in lanes by their class, so storm of FDB
+     * events can't delay link and session state changes. Control lane is
+     * dequeued with strict priority, unless control lane weight is set, then
+     * one bulk notification is dequeued after weight control notifications.
+     * Order of notifications is preserved only within lane.
+     */
     class NotificationQueue
     {
+        public:
+
+            typedef enum _Lane
+            {
+                /**
+                 * @brief Switch, port, BFD session state and queue deadlock.
+                 */
+                LANE_CONTROL,
+
+                /**
+                 * @brief FDB and NAT events.
+                 */
+                LANE_BULK,
+
+                LANE_COUNT,
+
+            } Lane;
+
+            typedef struct _LaneStats
+            {
+                size_t depth;
+
+                size_t maxDepth;
+
+                size_t enqueued;
+
+                size_t dequeued;
+
+                size_t dropped;
+
+                /**
+                 * @brief Time spent in queue by dequeued notifications (in
+                 * microseconds).
+                 */
+                uint64_t totalLatency;
+
+                uint64_t maxLatency;
+
+            } LaneStats;
+
         public:
 
             NotificationQueue(
@@ -43,18 +110,141 @@ namespace syncd
         public:
 
             bool enqueue(
-                    _In_ const swss::KeyOpFieldsValuesTuple& msg);
+                    _In_ std::shared_ptr<sairedis::Notification> notification);
 
             bool tryDequeue(
-                    _Out_ swss::KeyOpFieldsValuesTuple& msg);
+                    _Out_ std::shared_ptr<sairedis::Notification>& notification);
+
+            /**
+             * @brief Dequeue up to maxCount notifications under single lock.
+             *
+             * Notifications are dequeued in the same order as by tryDequeue.
+             *
+             * @return True if at least one notification was dequeued.
+             */
+            bool tryDequeueMany(
+                    _Out_ std::vector<std::shared_ptr<sairedis::Notification>>& notifications,
+                    _In_ size_t maxCount);
 
             size_t getQueueSize();
 
+            /**
+             * @brief Get number of FDB events merged into already queued
+             * events.
+             */
+            size_t getCoalescedCount();
+
+            size_t getDropCount();
+
+            /**
+             * @brief Set lane limit, by default lanes are limited only by
+             * queue limit.
+             */
+            void setLaneLimit(
+                    _In_ Lane lane,
+                    _In_ size_t limit);
+
+            /**
+             * @brief Set number of control notifications dequeued before one
+             * waiting bulk notification, zero means strict priority.
+             */
+            void setControlLaneWeight(
+                    _In_ size_t weight);
+
+            LaneStats getLaneStats(
+                    _In_ Lane lane);
+
+        public:
+
+            static Lane getLane(
+                    _In_ sai_switch_notification_type_t type);
+
+            static const char* getLaneName(
+                    _In_ Lane lane);
+
+        private:
+
+            typedef struct _QueueItem
+            {
+                std::shared_ptr<sairedis::Notification> notification;
+
+                std::chrono::steady_clock::time_point enqueueTime;
+
+            } QueueItem;
+
+            typedef struct _LaneQueue
+            {
+                std::queue<QueueItem> queue;
+
+                size_t limit;
+
+                LaneStats stats;
+
+            } LaneQueue;
+
+            typedef struct _FdbPendingEntry
+            {
+                sairedis::NotificationFdbEvent* notification;
+
+                uint32_t index;
+
+                /**
+                 * @brief First queued event of entry was LEARNED, entry was
+                 * not known to orchagent when it was queued.
+                 */
+                bool learned;
+
+            } FdbPendingEntry;
+
+            /**
+             * @brief Dequeue next notification, caller must hold mutex.
+             *
+             * @return False if queue is empty.
+             */
+            bool dequeue(
+                    _Out_ std::shared_ptr<sairedis::Notification>& notification);
+
+            /**
+             * @brief Coalesce FDB entries with entries already in queue.
+             *
+             * Coalesced entries are removed from notification.
+             *
+             * @return True if all entries were coalesced and notification
+             * should not be queued.
+             */
+            bool coalesceFdbEvent(
+                    _In_ sairedis::NotificationFdbEvent& fdb);
+
+            void addFdbPendingEntries(
+                    _In_ sairedis::NotificationFdbEvent& fdb);
+
+            /**
+             * @brief Forget pending entries of dequeued notification and
+             * remove its cancelled entries.
+             *
+             * @return False if all entries were cancelled and notification
+             * should be dropped.
+             */
+            bool removeFdbPendingEntries(
+                    _In_ sairedis::NotificationFdbEvent& fdb);
+
+            static sai_object_meta_key_t getFdbKey(
+                    _In_ const sai_fdb_event_notification_data_t& data);
+
         private:
 
             std::mutex m_mutex;
 
-            std::queue<swss::KeyOpFieldsValuesTuple> m_queue;
+            LaneQueue m_lanes[LANE_COUNT];
+
+            /**
+             * @brief Number of notifications in all lanes.
+             */
+            size_t m_queueSize;
+
+            size_t m_controlLaneWeight;
+
+            size_t m_controlBurst;
 
             size_t m_queueSizeLimit;
 
@@ -64,6 +254,21 @@ namespace syncd
 
             size_t m_lastEventCount;
 
-            std::string m_lastEvent;
+            sai_switch_notification_type_t m_lastEvent;
+
+            std::unordered_map<sai_object_meta_key_t, FdbPendingEntry, saimeta::MetaKeyHasher, saimeta::MetaKeyHasher> m_fdbPending;
+
+            /**
+             * @brief Last queued flush, valid until other FDB event is queued.
+             */
+            FdbPendingEntry m_fdbFlush;
+
+            /**
+             * @brief Entries of queued notifications cancelled by later
+             * events, removed on dequeue.
+             */
+            std::unordered_map<sairedis::NotificationFdbEvent*, std::vector<bool>> m_fdbCancelled;
+
+            size_t m_coalescedCount;
     };
 }
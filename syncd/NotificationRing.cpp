@@ -0,0 +1,60 @@
+#include "NotificationRing.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+static_assert(sizeof(NotificationRingRecord) == NOTIFICATION_RING_ALIGNMENT, "record header must be aligned");
+static_assert(sizeof(NotificationRingHeader) % NOTIFICATION_RING_ALIGNMENT == 0, "header must be aligned");
+
+std::string NotificationRing::getShmName(
+        _In_ uint32_t globalContext)
+{
+    SWSS_LOG_ENTER();
+
+    return NOTIFICATION_RING_SHM_PREFIX + std::to_string(globalContext);
+}
+
+size_t NotificationRing::getShmSize(
+        _In_ uint64_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    return sizeof(NotificationRingHeader) + (size_t)capacity;
+}
+
+uint64_t NotificationRing::align(
+        _In_ uint64_t size)
+{
+    SWSS_LOG_ENTER();
+
+    return (size + NOTIFICATION_RING_ALIGNMENT - 1) / NOTIFICATION_RING_ALIGNMENT * NOTIFICATION_RING_ALIGNMENT;
+}
+
+uint64_t NotificationRing::getRecordSize(
+        _In_ size_t nameSize,
+        _In_ size_t dataSize)
+{
+    SWSS_LOG_ENTER();
+
+    return align(sizeof(NotificationRingRecord) + (uint64_t)nameSize + (uint64_t)dataSize);
+}
+
+uint64_t NotificationRing::getMaxRecordSize(
+        _In_ uint64_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    // record and padding before it are always less than capacity, so
+    // writing record will not overwrite itself
+
+    return capacity / 2;
+}
+
+uint8_t* NotificationRing::getRecords(
+        _In_ void* base)
+{
+    SWSS_LOG_ENTER();
+
+    return reinterpret_cast<uint8_t*>(base) + sizeof(NotificationRingHeader);
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <string>
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define NOTIFICATION_RING_MAGIC         0x474e524e
+#define NOTIFICATION_RING_VERSION       1
+#define NOTIFICATION_RING_ALIGNMENT     32
+#define NOTIFICATION_RING_SHM_PREFIX    "/sairedis_notification_ring_"
+
+namespace syncd
+{
+    /*
+     * Shared memory layout of notification ring:
+     *
+     * NotificationRingHeader
+     * capacity bytes of records
+     *
+     * Record is NotificationRingRecord followed by notification name and
+     * serialized notification data, padded to NOTIFICATION_RING_ALIGNMENT.
+     * Records never wrap, when record does not fit at the end of ring,
+     * writer fills the rest with padding record and starts at ring begin.
+     *
+     * Positions are byte offsets since ring creation, they only grow and
+     * record at position P is at offset P % capacity.
+     *
+     * Single writer (notification processor) appends records, readers are
+     * lock free and each one keeps its own position. Before overwriting
+     * old records writer advances reserve position, so reader which copied
+     * record at position P detects it was overwritten when reserve position
+     * is more than capacity ahead of P.
+     */
+
+    typedef struct _NotificationRingRecord
+    {
+        /**
+         * @brief Record size including header and padding.
+         */
+        uint32_t size;
+
+        /**
+         * @brief Size of notification name, zero for padding record.
+         */
+        uint32_t nameSize;
+
+        uint32_t dataSize;
+
+        uint32_t reserved;
+
+        /**
+         * @brief Notification sequence number, starts from 1.
+         */
+        uint64_t sequence;
+
+        /**
+         * @brief Send time, nanoseconds since epoch.
+         */
+        uint64_t timestamp;
+
+    } NotificationRingRecord;
+
+    typedef struct _NotificationRingHeader
+    {
+        /**
+         * @brief Written last by writer, ring is valid when set, cleared
+         * when writer is destroyed.
+         */
+        std::atomic<uint32_t> magic;
+
+        uint32_t version;
+
+        /**
+         * @brief Size of records area in bytes.
+         */
+        uint64_t capacity;
+
+        /**
+         * @brief End position of record being written.
+         */
+        std::atomic<uint64_t> reservePosition;
+
+        /**
+         * @brief End position of last complete record.
+         */
+        std::atomic<uint64_t> writePosition;
+
+        /**
+         * @brief Sequence number of last complete record.
+         */
+        std::atomic<uint64_t> sequence;
+
+        /**
+         * @brief Number of notifications too large to fit into ring.
+         */
+        std::atomic<uint64_t> dropped;
+
+        uint64_t reserved[2];
+
+    } NotificationRingHeader;
+
+    class NotificationRing
+    {
+        private:
+
+            NotificationRing() = delete;
+
+        public:
+
+            /**
+             * @brief Shared memory name of notification ring of global
+             * context.
+             */
+            static std::string getShmName(
+                    _In_ uint32_t globalContext);
+
+            static size_t getShmSize(
+                    _In_ uint64_t capacity);
+
+            /**
+             * @brief Round size up to NOTIFICATION_RING_ALIGNMENT.
+             */
+            static uint64_t align(
+                    _In_ uint64_t size);
+
+            /**
+             * @brief Size of record with given name and data sizes,
+             * including padding.
+             */
+            static uint64_t getRecordSize(
+                    _In_ size_t nameSize,
+                    _In_ size_t dataSize);
+
+            /**
+             * @brief Max record size, larger notifications are dropped.
+             */
+            static uint64_t getMaxRecordSize(
+                    _In_ uint64_t capacity);
+
+            static uint8_t* getRecords(
+                    _In_ void* base);
+    };
+}
@@ -0,0 +1,231 @@
+#include "NotificationRingReader.h"
+
+#include "meta/NotificationFactory.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <inttypes.h>
+
+using namespace syncd;
+
+NotificationRingReader::NotificationRingReader(
+        _In_ uint32_t globalContext):
+    m_shmName(NotificationRing::getShmName(globalContext)),
+    m_size(0),
+    m_base(nullptr),
+    m_header(nullptr),
+    m_records(nullptr),
+    m_capacity(0),
+    m_position(0),
+    m_sequence(0),
+    m_lost(0)
+{
+    SWSS_LOG_ENTER();
+
+    int fd = shm_open(m_shmName.c_str(), O_RDONLY, 0);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_THROW("failed to open notification ring %s: %s", m_shmName.c_str(), strerror(errno));
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(NotificationRingHeader))
+    {
+        close(fd);
+
+        SWSS_LOG_THROW("notification ring %s is not valid", m_shmName.c_str());
+    }
+
+    m_size = (size_t)st.st_size;
+
+    m_base = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (m_base == MAP_FAILED)
+    {
+        SWSS_LOG_THROW("failed to map notification ring %s: %s", m_shmName.c_str(), strerror(errno));
+    }
+
+    m_header = reinterpret_cast<const NotificationRingHeader*>(m_base);
+
+    if (m_header->magic.load(std::memory_order_acquire) != NOTIFICATION_RING_MAGIC ||
+            m_header->version != NOTIFICATION_RING_VERSION ||
+            m_header->capacity == 0 ||
+            m_header->capacity % NOTIFICATION_RING_ALIGNMENT ||
+            m_size < NotificationRing::getShmSize(m_header->capacity))
+    {
+        munmap(m_base, m_size);
+
+        SWSS_LOG_THROW("notification ring %s is not valid or not initialized", m_shmName.c_str());
+    }
+
+    m_records = NotificationRing::getRecords(m_base);
+
+    m_capacity = m_header->capacity;
+
+    // sequence is stored before write position, so it's not older than
+    // sequence of record before write position
+
+    m_position = m_header->writePosition.load(std::memory_order_acquire);
+
+    m_sequence = m_header->sequence.load(std::memory_order_relaxed);
+}
+
+NotificationRingReader::~NotificationRingReader()
+{
+    SWSS_LOG_ENTER();
+
+    munmap(m_base, m_size);
+}
+
+void NotificationRingReader::resync()
+{
+    SWSS_LOG_ENTER();
+
+    // skipped notifications are counted as lost when next record is read
+
+    m_position = m_header->writePosition.load(std::memory_order_acquire);
+}
+
+bool NotificationRingReader::read(
+        _Out_ Record& record)
+{
+    SWSS_LOG_ENTER();
+
+    while (true)
+    {
+        uint64_t write = m_header->writePosition.load(std::memory_order_acquire);
+
+        if (m_position == write)
+        {
+            return false;
+        }
+
+        if (write - m_position > m_capacity)
+        {
+            resync();
+            continue;
+        }
+
+        uint64_t offset = m_position % m_capacity;
+
+        NotificationRingRecord header;
+
+        memcpy(&header, m_records + offset, sizeof(header));
+
+        // record could be overwritten while copied, so it's validated
+        // before its size is used
+
+        bool valid = header.size >= sizeof(header) &&
+            header.size % NOTIFICATION_RING_ALIGNMENT == 0 &&
+            header.size <= m_capacity - offset &&
+            sizeof(header) + (uint64_t)header.nameSize + (uint64_t)header.dataSize <= header.size;
+
+        if (valid && header.nameSize)
+        {
+            auto ptr = reinterpret_cast<const char*>(m_records + offset + sizeof(header));
+
+            record.name.assign(ptr, header.nameSize);
+            record.data.assign(ptr + header.nameSize, header.dataSize);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (m_header->reservePosition.load(std::memory_order_relaxed) - m_position > m_capacity)
+        {
+            // writer overwrote record while it was copied
+
+            resync();
+            continue;
+        }
+
+        if (!valid)
+        {
+            SWSS_LOG_ERROR("notification ring %s record at %" PRIu64 " is not valid, skipping to newest record",
+                    m_shmName.c_str(), m_position);
+
+            resync();
+            continue;
+        }
+
+        m_position += header.size;
+
+        if (header.nameSize == 0)
+        {
+            // padding till ring end
+
+            continue;
+        }
+
+        if (header.sequence > m_sequence + 1)
+        {
+            m_lost += header.sequence - m_sequence - 1;
+        }
+
+        m_sequence = header.sequence;
+
+        record.sequence = header.sequence;
+        record.timestamp = header.timestamp;
+
+        return true;
+    }
+}
+
+std::shared_ptr<sairedis::Notification> NotificationRingReader::readNotification()
+{
+    SWSS_LOG_ENTER();
+
+    Record record;
+
+    while (read(record))
+    {
+        try
+        {
+            return sairedis::NotificationFactory::deserialize(record.name, record.data);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to deserialize notification %s: %s", record.name.c_str(), e.what());
+        }
+    }
+
+    return nullptr;
+}
+
+uint64_t NotificationRingReader::getLostCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_lost;
+}
+
+uint64_t NotificationRingReader::getDroppedCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_header->dropped.load(std::memory_order_relaxed);
+}
+
+uint64_t NotificationRingReader::getCapacity() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_capacity;
+}
+
+bool NotificationRingReader::isClosed() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_header->magic.load(std::memory_order_acquire) != NOTIFICATION_RING_MAGIC;
+}
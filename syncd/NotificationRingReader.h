@@ -0,0 +1,132 @@
+#pragma once
+
+#include "NotificationRing.h"
+
+#include "meta/Notification.h"
+
+#include <memory>
+#include <string>
+
+namespace syncd
+{
+    /**
+     * @brief Lock free subscriber of shared memory notification ring.
+     *
+     * Each reader keeps its own position and never blocks the writer or
+     * other readers. Reader which is overrun by writer skips to newest
+     * record and counts lost notifications.
+     *
+     * Reader polls the ring, read returns nothing when there is no new
+     * notification.
+     */
+    class NotificationRingReader
+    {
+        private:
+
+            NotificationRingReader(const NotificationRingReader&) = delete;
+            NotificationRingReader& operator=(const NotificationRingReader&) = delete;
+
+        public:
+
+            typedef struct _Record
+            {
+                uint64_t sequence;
+
+                /**
+                 * @brief Send time, nanoseconds since epoch.
+                 */
+                uint64_t timestamp;
+
+                std::string name;
+
+                /**
+                 * @brief Serialized notification, the same as sent to redis
+                 * clients.
+                 */
+                std::string data;
+
+            } Record;
+
+        public:
+
+            /**
+             * @brief Open notification ring of global context.
+             *
+             * Throws when ring does not exist or is not valid. Reader starts
+             * at the newest record, only notifications written after open
+             * are read.
+             */
+            NotificationRingReader(
+                    _In_ uint32_t globalContext);
+
+            virtual ~NotificationRingReader();
+
+        public:
+
+            /**
+             * @brief Read next serialized notification.
+             *
+             * @return False if there is no new notification.
+             */
+            bool read(
+                    _Out_ Record& record);
+
+            /**
+             * @brief Read and deserialize next notification.
+             *
+             * @return Notification or nullptr if there is no new
+             * notification.
+             */
+            std::shared_ptr<sairedis::Notification> readNotification();
+
+            /**
+             * @brief Number of notifications overwritten before they were
+             * read.
+             */
+            uint64_t getLostCount() const;
+
+            /**
+             * @brief Number of notifications writer dropped since they were
+             * too large to fit into ring.
+             */
+            uint64_t getDroppedCount() const;
+
+            uint64_t getCapacity() const;
+
+            /**
+             * @brief Ring was closed by writer, subscriber should open new
+             * reader when syncd is restarted.
+             */
+            bool isClosed() const;
+
+        private:
+
+            /**
+             * @brief Skip all records, continue with newest one.
+             */
+            void resync();
+
+        private:
+
+            std::string m_shmName;
+
+            size_t m_size;
+
+            void* m_base;
+
+            const NotificationRingHeader* m_header;
+
+            const uint8_t* m_records;
+
+            uint64_t m_capacity;
+
+            uint64_t m_position;
+
+            /**
+             * @brief Sequence of last read notification.
+             */
+            uint64_t m_sequence;
+
+            uint64_t m_lost;
+    };
+}
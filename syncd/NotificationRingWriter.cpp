@@ -0,0 +1,191 @@
+#include "NotificationRingWriter.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <inttypes.h>
+
+using namespace syncd;
+
+NotificationRingWriter::NotificationRingWriter(
+        _In_ uint32_t globalContext,
+        _In_ uint64_t capacity):
+    m_shmName(NotificationRing::getShmName(globalContext)),
+    m_capacity(NotificationRing::align(capacity)),
+    m_size(NotificationRing::getShmSize(m_capacity)),
+    m_base(nullptr),
+    m_header(nullptr),
+    m_records(nullptr),
+    m_position(0),
+    m_sequence(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (NotificationRing::getMaxRecordSize(m_capacity) < NotificationRing::getRecordSize(1, 1))
+    {
+        SWSS_LOG_THROW("notification ring %s capacity %" PRIu64 " is too small", m_shmName.c_str(), capacity);
+    }
+
+    if (m_capacity > UINT32_MAX)
+    {
+        SWSS_LOG_THROW("notification ring %s capacity %" PRIu64 " is too large", m_shmName.c_str(), capacity);
+    }
+
+    // previous instance could leave stale ring
+
+    shm_unlink(m_shmName.c_str());
+
+    int fd = shm_open(m_shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_THROW("failed to create notification ring %s: %s", m_shmName.c_str(), strerror(errno));
+    }
+
+    if (ftruncate(fd, (off_t)m_size) != 0)
+    {
+        int err = errno;
+
+        close(fd);
+        shm_unlink(m_shmName.c_str());
+
+        SWSS_LOG_THROW("failed to resize notification ring %s to %zu bytes: %s", m_shmName.c_str(), m_size, strerror(err));
+    }
+
+    m_base = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (m_base == MAP_FAILED)
+    {
+        int err = errno;
+
+        shm_unlink(m_shmName.c_str());
+
+        SWSS_LOG_THROW("failed to map notification ring %s: %s", m_shmName.c_str(), strerror(err));
+    }
+
+    // memory is zeroed by ftruncate, ring is empty
+
+    m_header = reinterpret_cast<NotificationRingHeader*>(m_base);
+
+    m_records = NotificationRing::getRecords(m_base);
+
+    m_header->version = NOTIFICATION_RING_VERSION;
+    m_header->capacity = m_capacity;
+    m_header->reservePosition.store(0, std::memory_order_relaxed);
+    m_header->writePosition.store(0, std::memory_order_relaxed);
+    m_header->sequence.store(0, std::memory_order_relaxed);
+    m_header->dropped.store(0, std::memory_order_relaxed);
+    m_header->magic.store(NOTIFICATION_RING_MAGIC, std::memory_order_release);
+
+    SWSS_LOG_NOTICE("notification ring %s created, %zu bytes", m_shmName.c_str(), m_size);
+}
+
+NotificationRingWriter::~NotificationRingWriter()
+{
+    SWSS_LOG_ENTER();
+
+    // readers which still have ring mapped will see it closed
+
+    m_header->magic.store(0, std::memory_order_release);
+
+    munmap(m_base, m_size);
+
+    shm_unlink(m_shmName.c_str());
+
+    SWSS_LOG_NOTICE("notification ring %s removed", m_shmName.c_str());
+}
+
+uint64_t NotificationRingWriter::getCapacity() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_capacity;
+}
+
+uint64_t NotificationRingWriter::getSequence() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_sequence;
+}
+
+bool NotificationRingWriter::write(
+        _In_ const std::string& name,
+        _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint64_t size = NotificationRing::getRecordSize(name.size(), data.size());
+
+    if (name.empty() || size > NotificationRing::getMaxRecordSize(m_capacity))
+    {
+        m_header->dropped.fetch_add(1, std::memory_order_relaxed);
+
+        SWSS_LOG_WARN("notification %s of %zu bytes dropped, ring %s capacity is %" PRIu64,
+                name.c_str(), data.size(), m_shmName.c_str(), m_capacity);
+
+        return false;
+    }
+
+    uint64_t offset = m_position % m_capacity;
+
+    uint64_t padding = (m_capacity - offset < size) ? m_capacity - offset : 0;
+
+    // readers must see new reserve position before old records are
+    // overwritten
+
+    m_header->reservePosition.store(m_position + padding + size, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (padding)
+    {
+        NotificationRingRecord pad;
+
+        memset(&pad, 0, sizeof(pad));
+
+        pad.size = (uint32_t)padding;
+
+        memcpy(m_records + offset, &pad, sizeof(pad));
+
+        offset = 0;
+    }
+
+    NotificationRingRecord record;
+
+    memset(&record, 0, sizeof(record));
+
+    record.size = (uint32_t)size;
+    record.nameSize = (uint32_t)name.size();
+    record.dataSize = (uint32_t)data.size();
+    record.sequence = ++m_sequence;
+    record.timestamp = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+    uint8_t* ptr = m_records + offset;
+
+    memcpy(ptr, &record, sizeof(record));
+    memcpy(ptr + sizeof(record), name.data(), name.size());
+    memcpy(ptr + sizeof(record) + name.size(), data.data(), data.size());
+
+    m_position += padding + size;
+
+    m_header->sequence.store(m_sequence, std::memory_order_relaxed);
+
+    m_header->writePosition.store(m_position, std::memory_order_release);
+
+    return true;
+}
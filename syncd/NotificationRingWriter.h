@@ -0,0 +1,76 @@
+#pragma once
+
+#include "NotificationRing.h"
+
+#include <mutex>
+#include <string>
+
+namespace syncd
+{
+    /**
+     * @brief Writes notifications to shared memory notification ring.
+     *
+     * Notification is serialized once and written to ring, any number of
+     * local subscribers read it with NotificationRingReader without going
+     * through redis. Slow subscribers are overrun, writer never waits for
+     * readers.
+     */
+    class NotificationRingWriter
+    {
+        private:
+
+            NotificationRingWriter(const NotificationRingWriter&) = delete;
+            NotificationRingWriter& operator=(const NotificationRingWriter&) = delete;
+
+        public:
+
+            /**
+             * @brief Create shared memory notification ring of global
+             * context.
+             *
+             * @param globalContext Global context of syncd.
+             * @param capacity Size of records area in bytes, rounded up to
+             * record alignment.
+             */
+            NotificationRingWriter(
+                    _In_ uint32_t globalContext,
+                    _In_ uint64_t capacity);
+
+            virtual ~NotificationRingWriter();
+
+        public:
+
+            /**
+             * @brief Write serialized notification.
+             *
+             * @return False if notification is too large to fit into ring.
+             */
+            bool write(
+                    _In_ const std::string& name,
+                    _In_ const std::string& data);
+
+            uint64_t getCapacity() const;
+
+            uint64_t getSequence() const;
+
+        private:
+
+            std::string m_shmName;
+
+            uint64_t m_capacity;
+
+            size_t m_size;
+
+            void* m_base;
+
+            NotificationRingHeader* m_header;
+
+            uint8_t* m_records;
+
+            uint64_t m_position;
+
+            uint64_t m_sequence;
+
+            mutable std::mutex m_mutex;
+    };
+}
@@ -0,0 +1,196 @@
+#include "NotificationTracer.h"
+
+#include "swss/logger.h"
+
+#include <chrono>
+
+using namespace syncd;
+using namespace sairediscommon;
+
+NotificationTracer::NotificationTracer(
+        _In_ std::shared_ptr<swss::DBConnector> dbState)
+{
+    SWSS_LOG_ENTER();
+
+    if (dbState)
+    {
+        m_table = std::make_shared<swss::Table>(dbState.get(), NOTIFICATION_LATENCY_TABLE);
+    }
+}
+
+uint64_t NotificationTracer::now()
+{
+    SWSS_LOG_ENTER();
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t NotificationTracer::toSystemTime(
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t steadyNow = now();
+
+    uint64_t systemNow = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+    return systemNow - (steadyNow - timestamp);
+}
+
+const char* NotificationTracer::getIntervalName(
+        _In_ Interval interval)
+{
+    SWSS_LOG_ENTER();
+
+    switch (interval)
+    {
+        case INTERVAL_ENQUEUE:
+            return "enqueue";
+
+        case INTERVAL_QUEUE:
+            return "queue";
+
+        case INTERVAL_LOCK:
+            return "lock";
+
+        case INTERVAL_PROCESS:
+            return "process";
+
+        case INTERVAL_TOTAL:
+            return "total";
+
+        default:
+            return "unknown";
+    }
+}
+
+void NotificationTracer::record(
+        _In_ const sairedis::Notification& notification,
+        _In_ uint64_t sendTimestamp)
+{
+    SWSS_LOG_ENTER();
+
+    if (!notification.isTraced())
+    {
+        return;
+    }
+
+    uint64_t stamps[] = {
+        notification.getTraceTimestamp(sairedis::Notification::TRACE_STAGE_CALLBACK),
+        notification.getTraceTimestamp(sairedis::Notification::TRACE_STAGE_ENQUEUE),
+        notification.getTraceTimestamp(sairedis::Notification::TRACE_STAGE_DEQUEUE),
+        notification.getTraceTimestamp(sairedis::Notification::TRACE_STAGE_PROCESS),
+        sendTimestamp,
+    };
+
+    auto type = notification.getNotificationType();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& histograms = m_histograms[type];
+
+    if (m_names.find(type) == m_names.end())
+    {
+        m_names[type] = notification.getName();
+    }
+
+    // interval N is between stage N and stage N + 1
+
+    for (int interval = INTERVAL_ENQUEUE; interval < INTERVAL_TOTAL; interval++)
+    {
+        uint64_t start = stamps[interval];
+        uint64_t end = stamps[interval + 1];
+
+        if (start && end >= start)
+        {
+            histograms[interval].record((end - start) / 1000);
+        }
+    }
+
+    if (sendTimestamp >= stamps[0])
+    {
+        histograms[INTERVAL_TOTAL].record((sendTimestamp - stamps[0]) / 1000);
+    }
+}
+
+LatencyHistogram NotificationTracer::getHistogram(
+        _In_ sai_switch_notification_type_t type,
+        _In_ Interval interval) const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_histograms.find(type);
+
+    if (it == m_histograms.end())
+    {
+        return LatencyHistogram();
+    }
+
+    return it->second.at(interval);
+}
+
+std::vector<std::string> NotificationTracer::dump() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<std::string> lines;
+
+    for (auto& kvp: m_histograms)
+    {
+        for (int interval = 0; interval < INTERVAL_COUNT; interval++)
+        {
+            lines.push_back(m_names.at(kvp.first) + " " +
+                    getIntervalName((Interval)interval) + " us: " +
+                    kvp.second[interval].toString());
+        }
+    }
+
+    return lines;
+}
+
+void NotificationTracer::publish()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_table)
+    {
+        return;
+    }
+
+    std::map<std::string, Histograms> histograms;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto& kvp: m_histograms)
+        {
+            histograms[m_names.at(kvp.first)] = kvp.second;
+        }
+    }
+
+    for (auto& kvp: histograms)
+    {
+        std::vector<swss::FieldValueTuple> values;
+
+        for (int interval = 0; interval < INTERVAL_COUNT; interval++)
+        {
+            auto& h = kvp.second[interval];
+
+            std::string prefix = getIntervalName((Interval)interval);
+
+            values.emplace_back(prefix + "_count", std::to_string(h.getCount()));
+            values.emplace_back(prefix + "_avg_us", std::to_string(h.getAverage()));
+            values.emplace_back(prefix + "_p50_us", std::to_string(h.getPercentile(50)));
+            values.emplace_back(prefix + "_p99_us", std::to_string(h.getPercentile(99)));
+            values.emplace_back(prefix + "_max_us", std::to_string(h.getMax()));
+        }
+
+        m_table->set(kvp.first, values);
+    }
+}
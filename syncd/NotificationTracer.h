@@ -0,0 +1,146 @@
+#pragma once
+
+#include "meta/Notification.h"
+#include "meta/LatencyHistogram.h"
+
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief STATE_DB table with notification latencies, key is notification
+ * name.
+ */
+#define NOTIFICATION_LATENCY_TABLE "NOTIFICATION_LATENCY"
+
+/**
+ * @brief Interval of publishing notification latencies to STATE_DB (in
+ * seconds).
+ */
+#define NOTIFICATION_TRACE_PUBLISH_INTERVAL (10)
+
+namespace syncd
+{
+    /**
+     * @brief Collects latencies of traced notifications.
+     *
+     * Notification is stamped at each stage, from vendor callback through
+     * notification queue to processor, and latencies are recorded per
+     * notification type when notification is sent to clients.
+     */
+    class NotificationTracer
+    {
+        private:
+
+            NotificationTracer(const NotificationTracer&) = delete;
+            NotificationTracer& operator=(const NotificationTracer&) = delete;
+
+        public:
+
+            typedef enum _Interval
+            {
+                /**
+                 * @brief From vendor callback to enqueue, notification copy.
+                 */
+                INTERVAL_ENQUEUE,
+
+                /**
+                 * @brief Queue residency.
+                 */
+                INTERVAL_QUEUE,
+
+                /**
+                 * @brief From dequeue to processing, waiting for syncd lock
+                 * and previous notifications in batch.
+                 */
+                INTERVAL_LOCK,
+
+                /**
+                 * @brief From processing to send, translation and
+                 * serialization, including time held in send batch.
+                 */
+                INTERVAL_PROCESS,
+
+                /**
+                 * @brief From vendor callback to send.
+                 */
+                INTERVAL_TOTAL,
+
+                INTERVAL_COUNT,
+
+            } Interval;
+
+        public:
+
+            /**
+             * @param dbState STATE_DB connector, latencies are not published
+             * when null.
+             */
+            NotificationTracer(
+                    _In_ std::shared_ptr<swss::DBConnector> dbState);
+
+            virtual ~NotificationTracer() = default;
+
+        public:
+
+            /**
+             * @brief Current timestamp used by traces, nanoseconds of steady
+             * clock.
+             */
+            static uint64_t now();
+
+            /**
+             * @brief Convert trace timestamp to nanoseconds since epoch.
+             */
+            static uint64_t toSystemTime(
+                    _In_ uint64_t timestamp);
+
+            static const char* getIntervalName(
+                    _In_ Interval interval);
+
+            /**
+             * @brief Record latencies of traced notification which was sent
+             * at given timestamp, not traced notifications are ignored.
+             */
+            void record(
+                    _In_ const sairedis::Notification& notification,
+                    _In_ uint64_t sendTimestamp);
+
+            /**
+             * @brief Get latency histogram (in microseconds) of notification
+             * type.
+             */
+            sairediscommon::LatencyHistogram getHistogram(
+                    _In_ sai_switch_notification_type_t type,
+                    _In_ Interval interval) const;
+
+            /**
+             * @brief Get summary of all histograms, one line per notification
+             * type and interval.
+             */
+            std::vector<std::string> dump() const;
+
+            /**
+             * @brief Write summary of latencies to STATE_DB.
+             */
+            void publish();
+
+        private:
+
+            typedef std::array<sairediscommon::LatencyHistogram, INTERVAL_COUNT> Histograms;
+
+            mutable std::mutex m_mutex;
+
+            std::map<sai_switch_notification_type_t, Histograms> m_histograms;
+
+            std::map<sai_switch_notification_type_t, std::string> m_names;
+
+            std::shared_ptr<swss::Table> m_table;
+    };
+}
@@ -0,0 +1,283 @@
+#include "RateEngine.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/schema.h"
+
+#include <algorithm>
+
+using namespace syncd;
+
+RateEngine::RateEngine(
+        _In_ const std::string& name,
+        _In_ const sai_enum_metadata_t* statEnum,
+        _In_ const std::vector<RateField>& fields,
+        _In_ const std::string& dbCounters):
+    m_name(name),
+    m_fields(fields),
+    m_alpha(0),
+    m_active(false),
+    m_configRead(false)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& field: m_fields)
+    {
+        std::vector<size_t> inputs;
+
+        for (auto stat: field.stats)
+        {
+            auto it = std::find(m_inputStats.begin(), m_inputStats.end(), stat);
+
+            if (it == m_inputStats.end())
+            {
+                m_inputStats.push_back(stat);
+
+                m_lastFieldNames.push_back(sai_serialize_enum(stat, statEnum) + "_last");
+
+                it = m_inputStats.end() - 1;
+            }
+
+            inputs.push_back(std::distance(m_inputStats.begin(), it));
+        }
+
+        m_fieldInputs.push_back(inputs);
+    }
+
+    m_db = std::make_shared<swss::DBConnector>(dbCounters, 0);
+    m_pipeline = std::make_shared<swss::RedisPipeline>(m_db.get());
+    m_ratesTable = std::make_shared<swss::Table>(m_pipeline.get(), RATES_TABLE, true);
+}
+
+std::shared_ptr<RateEngine> RateEngine::create(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& dbCounters)
+{
+    SWSS_LOG_ENTER();
+
+    // same rates as port_rates.lua and rif_rates.lua plugins
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_PORT:
+
+            return std::make_shared<RateEngine>("PORT", &sai_metadata_enum_sai_port_stat_t, std::vector<RateField>{
+                    { "RX_BPS", { SAI_PORT_STAT_IF_IN_OCTETS } },
+                    { "RX_PPS", { SAI_PORT_STAT_IF_IN_UCAST_PKTS, SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS } },
+                    { "TX_BPS", { SAI_PORT_STAT_IF_OUT_OCTETS } },
+                    { "TX_PPS", { SAI_PORT_STAT_IF_OUT_UCAST_PKTS, SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS } },
+                    }, dbCounters);
+
+        case SAI_OBJECT_TYPE_ROUTER_INTERFACE:
+
+            return std::make_shared<RateEngine>("RIF", &sai_metadata_enum_sai_router_interface_stat_t, std::vector<RateField>{
+                    { "RX_BPS", { SAI_ROUTER_INTERFACE_STAT_IN_OCTETS } },
+                    { "RX_PPS", { SAI_ROUTER_INTERFACE_STAT_IN_PACKETS } },
+                    { "TX_BPS", { SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS } },
+                    { "TX_PPS", { SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS } },
+                    }, dbCounters);
+
+        default:
+            return nullptr;
+    }
+}
+
+bool RateEngine::refresh()
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (m_configRead && (now - m_lastConfigRefresh) < std::chrono::seconds(CONFIG_REFRESH_INTERVAL))
+    {
+        return m_active;
+    }
+
+    m_configRead = true;
+    m_lastConfigRefresh = now;
+
+    std::string alpha;
+
+    if (!m_ratesTable->hget(m_name, m_name + "_ALPHA", alpha))
+    {
+        if (m_active)
+        {
+            SWSS_LOG_NOTICE("%s rates alpha is not configured, native rates disabled", m_name.c_str());
+        }
+
+        m_active = false;
+
+        return m_active;
+    }
+
+    try
+    {
+        m_alpha = std::stod(alpha);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("invalid %s rates alpha '%s': %s", m_name.c_str(), alpha.c_str(), e.what());
+
+        m_active = false;
+
+        return m_active;
+    }
+
+    if (!m_active)
+    {
+        SWSS_LOG_NOTICE("%s rates computed natively, alpha %f", m_name.c_str(), m_alpha);
+    }
+
+    m_active = true;
+
+    return m_active;
+}
+
+bool RateEngine::isActive() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_active;
+}
+
+void RateEngine::buildIndex(
+        _Inout_ ObjectState& state,
+        _In_ uint32_t count,
+        _In_ const sai_stat_id_t* statIds)
+{
+    SWSS_LOG_ENTER();
+
+    state.statIds.assign(statIds, statIds + count);
+    state.index.assign(m_inputStats.size(), -1);
+
+    for (size_t i = 0; i < m_inputStats.size(); i++)
+    {
+        auto it = std::find(state.statIds.begin(), state.statIds.end(), m_inputStats[i]);
+
+        if (it != state.statIds.end())
+        {
+            state.index[i] = (int)std::distance(state.statIds.begin(), it);
+        }
+    }
+
+    state.last.assign(m_inputStats.size(), 0);
+    state.rates.assign(m_fields.size(), 0);
+    state.state = INIT_STATE_NONE;
+}
+
+void RateEngine::update(
+        _In_ sai_object_id_t vid,
+        _In_ uint32_t count,
+        _In_ const sai_stat_id_t* statIds,
+        _In_ const uint64_t* stats)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_active)
+    {
+        return;
+    }
+
+    auto& state = m_objects[vid];
+
+    if (state.statIds.size() != count || !std::equal(state.statIds.begin(), state.statIds.end(), statIds))
+    {
+        buildIndex(state, count, statIds);
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    std::string strVid = sai_serialize_object_id(vid);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    if (state.state != INIT_STATE_NONE)
+    {
+        double delta = std::chrono::duration<double>(now - state.lastTime).count();
+
+        for (size_t f = 0; f < m_fields.size(); f++)
+        {
+            bool available = true;
+
+            double diff = 0;
+
+            for (size_t input: m_fieldInputs[f])
+            {
+                int idx = state.index[input];
+
+                if (idx < 0)
+                {
+                    available = false;
+                    break;
+                }
+
+                diff += (double)stats[idx] - (double)state.last[input];
+            }
+
+            if (!available || delta <= 0)
+            {
+                continue;
+            }
+
+            double rate = diff / delta;
+
+            if (state.state == INIT_STATE_DONE)
+            {
+                rate = m_alpha * rate + (1.0 - m_alpha) * state.rates[f];
+            }
+
+            state.rates[f] = rate;
+
+            values.emplace_back(m_fields[f].name, std::to_string(rate));
+        }
+
+        if (state.state == INIT_STATE_COUNTERS_LAST)
+        {
+            // initial rates are not smoothed
+
+            state.state = INIT_STATE_DONE;
+
+            m_ratesTable->hset(strVid + ":" + m_name, "INIT_DONE", "DONE");
+        }
+    }
+    else
+    {
+        state.state = INIT_STATE_COUNTERS_LAST;
+
+        m_ratesTable->hset(strVid + ":" + m_name, "INIT_DONE", "COUNTERS_LAST");
+    }
+
+    for (size_t i = 0; i < m_inputStats.size(); i++)
+    {
+        int idx = state.index[i];
+
+        if (idx < 0)
+        {
+            continue;
+        }
+
+        state.last[i] = stats[idx];
+
+        values.emplace_back(m_lastFieldNames[i], std::to_string(stats[idx]));
+    }
+
+    state.lastTime = now;
+
+    m_ratesTable->set(strVid, values);
+}
+
+void RateEngine::removeObject(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    m_objects.erase(vid);
+}
+
+void RateEngine::flush()
+{
+    SWSS_LOG_ENTER();
+
+    m_ratesTable->flush();
+}
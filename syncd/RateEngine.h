@@ -0,0 +1,198 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/table.h"
+#include "swss/dbconnector.h"
+#include "swss/redispipeline.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define RATE_ENGINE_FIELD               "RATE_ENGINE"
+#define RATE_ENGINE_LUA                 "RATE_ENGINE_LUA"
+#define RATE_ENGINE_NATIVE              "RATE_ENGINE_NATIVE"
+
+/**
+ * @brief Comma separated SHAs of rates Lua plugins replaced by native rate
+ * engine, other plugins of the group are still executed.
+ */
+#define RATE_PLUGIN_FIELD               "RATE_PLUGIN"
+
+namespace syncd
+{
+    /**
+     * @brief Computes counter rates in process.
+     *
+     * Native replacement of rates Lua plugins (port and router interface
+     * rates). Rates are computed from values just collected by flex
+     * counter, so COUNTERS_DB is not read back. Results are written to
+     * RATES table in the same format as Lua plugins are using:
+     *
+     * - RATES:<vid> rate fields and <stat>_last fields
+     * - RATES:<vid>:<name> INIT_DONE state
+     *
+     * Rates are smoothed with alpha taken from RATES:<name> <name>_ALPHA
+     * field which is configured by orchagent. Until alpha is configured
+     * engine is not active and Lua plugins should be used.
+     *
+     * While engine is active, only plugins listed in RATE_PLUGIN group field
+     * are skipped, plugins computing other values (like PFC watchdog) are
+     * still executed.
+     */
+    class RateEngine
+    {
+        private:
+
+            RateEngine(const RateEngine&) = delete;
+            RateEngine& operator=(const RateEngine&) = delete;
+
+        public:
+
+            /**
+             * @brief Rate field, computed from sum of deltas of stats.
+             */
+            typedef struct _RateField
+            {
+                std::string name;
+
+                std::vector<sai_stat_id_t> stats;
+
+            } RateField;
+
+            /**
+             * @brief How often alpha is read from RATES table (in seconds).
+             */
+            static constexpr int CONFIG_REFRESH_INTERVAL = 10;
+
+        public:
+
+            RateEngine(
+                    _In_ const std::string& name,
+                    _In_ const sai_enum_metadata_t* statEnum,
+                    _In_ const std::vector<RateField>& fields,
+                    _In_ const std::string& dbCounters);
+
+            virtual ~RateEngine() = default;
+
+        public:
+
+            /**
+             * @brief Create rate engine for given object type.
+             *
+             * @return Rate engine or nullptr if object type rates are not
+             * supported natively.
+             */
+            static std::shared_ptr<RateEngine> create(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& dbCounters);
+
+        public:
+
+            /**
+             * @brief Refresh configuration, should be called once per poll
+             * before any update.
+             *
+             * @return True if engine is active (alpha is configured).
+             */
+            bool refresh();
+
+            bool isActive() const;
+
+            /**
+             * @brief Update rates of object from just collected stats.
+             */
+            void update(
+                    _In_ sai_object_id_t vid,
+                    _In_ uint32_t count,
+                    _In_ const sai_stat_id_t* statIds,
+                    _In_ const uint64_t* stats);
+
+            void removeObject(
+                    _In_ sai_object_id_t vid);
+
+            /**
+             * @brief Write buffered rates to database.
+             */
+            void flush();
+
+        private:
+
+            typedef enum _InitState
+            {
+                INIT_STATE_NONE,
+
+                INIT_STATE_COUNTERS_LAST,
+
+                INIT_STATE_DONE,
+
+            } InitState;
+
+            typedef struct _ObjectState
+            {
+                /**
+                 * @brief Stat ids for which index was built.
+                 */
+                std::vector<sai_stat_id_t> statIds;
+
+                /**
+                 * @brief Index of each input stat in stat ids, -1 if object
+                 * is not polling that stat.
+                 */
+                std::vector<int> index;
+
+                std::vector<uint64_t> last;
+
+                std::vector<double> rates;
+
+                std::chrono::steady_clock::time_point lastTime;
+
+                InitState state;
+
+            } ObjectState;
+
+            void buildIndex(
+                    _Inout_ ObjectState& state,
+                    _In_ uint32_t count,
+                    _In_ const sai_stat_id_t* statIds);
+
+        private:
+
+            std::string m_name;
+
+            std::vector<RateField> m_fields;
+
+            /**
+             * @brief Unique stats used by all rate fields.
+             */
+            std::vector<sai_stat_id_t> m_inputStats;
+
+            std::vector<std::string> m_lastFieldNames;
+
+            /**
+             * @brief For each rate field indexes to input stats.
+             */
+            std::vector<std::vector<size_t>> m_fieldInputs;
+
+            std::unordered_map<sai_object_id_t, ObjectState> m_objects;
+
+            double m_alpha;
+
+            bool m_active;
+
+            std::chrono::steady_clock::time_point m_lastConfigRefresh;
+
+            bool m_configRead;
+
+            std::shared_ptr<swss::DBConnector> m_db;
+
+            std::shared_ptr<swss::RedisPipeline> m_pipeline;
+
+            std::shared_ptr<swss::Table> m_ratesTable;
+    };
+}
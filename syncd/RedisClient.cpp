@@ -37,6 +37,126 @@ RedisClient::~RedisClient()
     // empty
 }
 
+void RedisClient::setAsicStateWriteBehind(
+        _In_ bool enable)
+{
+    SWSS_LOG_ENTER();
+
+    if (enable)
+    {
+        if (!m_asicStatePipeline)
+        {
+            SWSS_LOG_NOTICE("enabling ASIC_STATE write behind");
+
+            m_asicStatePipeline = std::make_shared<swss::RedisPipeline>(m_dbAsic.get());
+        }
+
+        return;
+    }
+
+    if (m_asicStatePipeline)
+    {
+        SWSS_LOG_NOTICE("disabling ASIC_STATE write behind");
+
+        m_asicStatePipeline->flush();
+
+        m_asicStatePipeline = nullptr;
+    }
+}
+
+void RedisClient::flushAsicState() const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_asicStatePipeline)
+    {
+        m_asicStatePipeline->flush();
+    }
+}
+
+void RedisClient::asicStateHset(
+        _In_ const std::string& key,
+        _In_ const std::string& field,
+        _In_ const std::string& value) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_asicStatePipeline)
+    {
+        swss::RedisCommand command;
+
+        command.formatHSET(key, field, value);
+
+        m_asicStatePipeline->push(command, REDIS_REPLY_INTEGER);
+
+        return;
+    }
+
+    m_dbAsic->hset(key, field, value);
+}
+
+void RedisClient::asicStateHmset(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_asicStatePipeline)
+    {
+        swss::RedisCommand command;
+
+        command.formatHMSET(key, values.begin(), values.end());
+
+        m_asicStatePipeline->push(command, REDIS_REPLY_STATUS);
+
+        return;
+    }
+
+    for (const auto& e: values)
+    {
+        m_dbAsic->hset(key, fvField(e), fvValue(e));
+    }
+}
+
+void RedisClient::asicStateDel(
+        _In_ const std::string& key) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_asicStatePipeline)
+    {
+        swss::RedisCommand command;
+
+        command.formatDEL(key);
+
+        m_asicStatePipeline->push(command, REDIS_REPLY_INTEGER);
+
+        return;
+    }
+
+    m_dbAsic->del(key);
+}
+
+void RedisClient::asicStateHdel(
+        _In_ const std::string& key,
+        _In_ const std::string& field) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_asicStatePipeline)
+    {
+        swss::RedisCommand command;
+
+        command.formatHDEL(key, field);
+
+        m_asicStatePipeline->push(command, REDIS_REPLY_INTEGER);
+
+        return;
+    }
+
+    m_dbAsic->hdel(key, field);
+}
+
 std::string RedisClient::getRedisLanesKey(
         _In_ sai_object_id_t switchVid) const
 {
@@ -135,6 +255,8 @@ std::unordered_map<sai_object_id_t, sai_object_id_t> RedisClient::getObjectMap(
 {
     SWSS_LOG_ENTER();
 
+    flushAsicState();
+
     auto hash = m_dbAsic->hgetall(key);
 
     std::unordered_map<sai_object_id_t, sai_object_id_t> map;
@@ -228,7 +350,7 @@ void RedisClient::setDummyAsicStateObject(
 
     std::string strKey = ASIC_STATE_TABLE + (":" + strObjectType + ":" + strVid);
 
-    m_dbAsic->hset(strKey, "NULL", "NULL");
+    asicStateHset(strKey, "NULL", "NULL");
 }
 
 std::string RedisClient::getRedisColdVidsKey(
@@ -341,6 +463,8 @@ std::set<sai_object_id_t> RedisClient::getColdVids(
 
     auto key = getRedisColdVidsKey(switchVid);
 
+    flushAsicState();
+
     auto hash = m_dbAsic->hgetall(key);
 
     /*
@@ -401,6 +525,8 @@ size_t RedisClient::getAsicObjectsSize(
     // go N times on every switch and it can be slow, we need to find better
     // way to do this
 
+    flushAsicState();
+
     auto keys = m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 
     size_t count = 0;
@@ -467,7 +593,7 @@ void RedisClient::removeAsicObject(
 
     SWSS_LOG_INFO("removing ASIC DB key: %s", key.c_str());
 
-    m_dbAsic->del(key);
+    asicStateDel(key);
 }
 
 void RedisClient::removeAsicObject(
@@ -475,9 +601,16 @@ void RedisClient::removeAsicObject(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
+    std::string strMetaKey = sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->del(key);
+    if (m_fdbIndex && metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        m_fdbIndex->removeEntry(strMetaKey);
+    }
+
+    std::string key = (ASIC_STATE_TABLE ":") + strMetaKey;
+
+    asicStateDel(key);
 }
 
 void RedisClient::removeTempAsicObject(
@@ -487,7 +620,7 @@ void RedisClient::removeTempAsicObject(
 
     std::string key = (TEMP_PREFIX ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->del(key);
+    asicStateDel(key);
 }
 
 void RedisClient::removeAsicObjects(
@@ -501,6 +634,21 @@ void RedisClient::removeAsicObjects(
     for (const auto& key: keys)
     {
          prefixKeys.push_back((ASIC_STATE_TABLE ":") + key);
+
+         if (m_fdbIndex)
+         {
+             m_fdbIndex->removeEntry(key);
+         }
+    }
+
+    if (m_asicStatePipeline)
+    {
+        for (const auto& key: prefixKeys)
+        {
+            asicStateDel(key);
+        }
+
+        return;
     }
 
     m_dbAsic->del(prefixKeys);
@@ -519,6 +667,16 @@ void RedisClient::removeTempAsicObjects(
          prefixKeys.push_back((TEMP_PREFIX ASIC_STATE_TABLE ":") + key);
     }
 
+    if (m_asicStatePipeline)
+    {
+        for (const auto& key: prefixKeys)
+        {
+            asicStateDel(key);
+        }
+
+        return;
+    }
+
     m_dbAsic->del(prefixKeys);
 }
 
@@ -529,9 +687,16 @@ void RedisClient::setAsicObject(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
+    std::string strMetaKey = sai_serialize_object_meta_key(metaKey);
+
+    if (m_fdbIndex && metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        m_fdbIndex->setEntryAttribute(strMetaKey, attr, value);
+    }
+
+    std::string key = (ASIC_STATE_TABLE ":") + strMetaKey;
 
-    m_dbAsic->hset(key, attr, value);
+    asicStateHset(key, attr, value);
 }
 
 void RedisClient::setTempAsicObject(
@@ -543,7 +708,7 @@ void RedisClient::setTempAsicObject(
 
     std::string key = (TEMP_PREFIX ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->hset(key, attr, value);
+    asicStateHset(key, attr, value);
 }
 
 void RedisClient::createAsicObject(
@@ -552,18 +717,22 @@ void RedisClient::createAsicObject(
 {
     SWSS_LOG_ENTER();
 
-    std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
+    std::string strMetaKey = sai_serialize_object_meta_key(metaKey);
 
-    if (attrs.size() == 0)
+    if (m_fdbIndex && metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
     {
-        m_dbAsic->hset(key, "NULL", "NULL");
-        return;
+        m_fdbIndex->setEntry(strMetaKey, attrs);
     }
 
-    for (const auto& e: attrs)
+    std::string key = (ASIC_STATE_TABLE ":") + strMetaKey;
+
+    if (attrs.size() == 0)
     {
-        m_dbAsic->hset(key, fvField(e), fvValue(e));
+        asicStateHset(key, "NULL", "NULL");
+        return;
     }
+
+    asicStateHmset(key, attrs);
 }
 
 void RedisClient::createTempAsicObject(
@@ -576,14 +745,11 @@ void RedisClient::createTempAsicObject(
 
     if (attrs.size() == 0)
     {
-        m_dbAsic->hset(key, "NULL", "NULL");
+        asicStateHset(key, "NULL", "NULL");
         return;
     }
 
-    for (const auto& e: attrs)
-    {
-        m_dbAsic->hset(key, fvField(e), fvValue(e));
-    }
+    asicStateHmset(key, attrs);
 }
 
 void RedisClient::createAsicObjects(
@@ -598,12 +764,27 @@ void RedisClient::createAsicObjects(
     {
         hash[(ASIC_STATE_TABLE ":") + kvp.first] = kvp.second;
 
+        if (m_fdbIndex)
+        {
+            m_fdbIndex->setEntry(kvp.first, kvp.second);
+        }
+
         if (kvp.second.size() == 0)
         {
             hash[(ASIC_STATE_TABLE ":") + kvp.first].emplace_back(std::make_pair<std::string, std::string>("NULL", "NULL"));
         }
     }
 
+    if (m_asicStatePipeline)
+    {
+        for (const auto& kvp: hash)
+        {
+            asicStateHmset(kvp.first, kvp.second);
+        }
+
+        return;
+    }
+
     m_dbAsic->hmset(hash);
 }
 
@@ -625,14 +806,83 @@ void RedisClient::createTempAsicObjects(
         }
     }
 
+    if (m_asicStatePipeline)
+    {
+        for (const auto& kvp: hash)
+        {
+            asicStateHmset(kvp.first, kvp.second);
+        }
+
+        return;
+    }
+
     m_dbAsic->hmset(hash);
 }
 
+void RedisClient::updateAsicObjects(
+        _In_ const std::vector<std::string>& removeKeys,
+        _In_ const std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>& multiHash)
+{
+    SWSS_LOG_ENTER();
+
+    auto pipeline = m_asicStatePipeline;
+
+    if (!pipeline)
+    {
+        pipeline = std::make_shared<swss::RedisPipeline>(m_dbAsic.get());
+    }
+
+    for (const auto& key: removeKeys)
+    {
+        if (m_fdbIndex)
+        {
+            m_fdbIndex->removeEntry(key);
+        }
+
+        swss::RedisCommand command;
+
+        command.formatDEL((ASIC_STATE_TABLE ":") + key);
+
+        pipeline->push(command, REDIS_REPLY_INTEGER);
+    }
+
+    for (const auto& kvp: multiHash)
+    {
+        swss::RedisCommand command;
+
+        std::string key = (ASIC_STATE_TABLE ":") + kvp.first;
+
+        if (m_fdbIndex)
+        {
+            m_fdbIndex->setEntry(kvp.first, kvp.second);
+        }
+
+        if (kvp.second.size() == 0)
+        {
+            command.formatHSET(key, "NULL", "NULL");
+
+            pipeline->push(command, REDIS_REPLY_INTEGER);
+            continue;
+        }
+
+        command.formatHMSET(key, kvp.second.begin(), kvp.second.end());
+
+        pipeline->push(command, REDIS_REPLY_STATUS);
+    }
+
+    if (pipeline != m_asicStatePipeline)
+    {
+        pipeline->flush();
+    }
+}
+
 void RedisClient::setVidAndRidMap(
         _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& map)
 {
     SWSS_LOG_ENTER();
 
+    flushAsicState();
+
     m_dbAsic->del(VIDTORID);
     m_dbAsic->del(RIDTOVID);
 
@@ -650,6 +900,8 @@ std::vector<std::string> RedisClient::getAsicStateKeys() const
 {
     SWSS_LOG_ENTER();
 
+    flushAsicState();
+
     return m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 }
 
@@ -657,6 +909,8 @@ std::vector<std::string> RedisClient::getAsicStateSwitchesKeys() const
 {
     SWSS_LOG_ENTER();
 
+    flushAsicState();
+
     return m_dbAsic->keys(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_SWITCH:*");
 }
 
@@ -677,6 +931,8 @@ std::unordered_map<std::string, std::string> RedisClient::getAttributesFromAsicK
 {
     SWSS_LOG_ENTER();
 
+    flushAsicState();
+
     std::unordered_map<std::string, std::string> map;
     m_dbAsic->hgetall(key, std::inserter(map, map.end()));
     return map;
@@ -700,8 +956,8 @@ void RedisClient::removeVidAndRid(
     auto strVid = sai_serialize_object_id(vid);
     auto strRid = sai_serialize_object_id(rid);
 
-    m_dbAsic->hdel(VIDTORID, strVid);
-    m_dbAsic->hdel(RIDTOVID, strRid);
+    asicStateHdel(VIDTORID, strVid);
+    asicStateHdel(RIDTOVID, strRid);
 }
 
 void RedisClient::insertVidAndRid(
@@ -713,8 +969,8 @@ void RedisClient::insertVidAndRid(
     auto strVid = sai_serialize_object_id(vid);
     auto strRid = sai_serialize_object_id(rid);
 
-    m_dbAsic->hset(VIDTORID, strVid, strRid);
-    m_dbAsic->hset(RIDTOVID, strRid, strVid);
+    asicStateHset(VIDTORID, strVid, strRid);
+    asicStateHset(RIDTOVID, strRid, strVid);
 }
 
 sai_object_id_t RedisClient::getVidForRid(
@@ -724,6 +980,8 @@ sai_object_id_t RedisClient::getVidForRid(
 
     auto strRid = sai_serialize_object_id(rid);
 
+    flushAsicState();
+
     auto pvid = m_dbAsic->hget(RIDTOVID, strRid);
 
     if (pvid == nullptr)
@@ -748,6 +1006,8 @@ sai_object_id_t RedisClient::getRidForVid(
 
     auto strVid = sai_serialize_object_id(vid);
 
+    flushAsicState();
+
     auto prid = m_dbAsic->hget(VIDTORID, strVid);
 
     if (prid == nullptr)
@@ -769,6 +1029,13 @@ void RedisClient::removeAsicStateTable()
 {
     SWSS_LOG_ENTER();
 
+    flushAsicState();
+
+    if (m_fdbIndex)
+    {
+        m_fdbIndex->clear();
+    }
+
     const auto &asicStateKeys = m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 
     for (const auto &key: asicStateKeys)
@@ -781,6 +1048,8 @@ void RedisClient::removeTempAsicStateTable()
 {
     SWSS_LOG_ENTER();
 
+    flushAsicState();
+
     const auto &tempAsicStateKeys = m_dbAsic->keys(TEMP_PREFIX ASIC_STATE_TABLE ":*");
 
     for (const auto &key: tempAsicStateKeys)
@@ -810,6 +1079,8 @@ std::map<sai_object_id_t, swss::TableDump> RedisClient::getAsicView(
 
     SWSS_LOG_TIMER("get asic view from %s", tableName.c_str());
 
+    flushAsicState();
+
     swss::Table table(m_dbAsic.get(), tableName);
 
     swss::TableDump dump;
@@ -841,6 +1112,47 @@ std::map<sai_object_id_t, swss::TableDump> RedisClient::getAsicView(
 }
 
 
+void RedisClient::setFdbIndex(
+        _In_ bool enable)
+{
+    SWSS_LOG_ENTER();
+
+    if (!enable)
+    {
+        m_fdbIndex = nullptr;
+        return;
+    }
+
+    if (m_fdbIndex)
+    {
+        return;
+    }
+
+    flushAsicState();
+
+    auto fdbIndex = std::make_shared<FdbIndex>();
+
+    // single keyspace scan when index is enabled, later index is maintained
+    // by writes of this client
+
+    const std::string prefix = ASIC_STATE_TABLE ":";
+
+    const auto& keys = m_dbAsic->keys(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_FDB_ENTRY:*");
+
+    for (const auto& key: keys)
+    {
+        std::vector<swss::FieldValueTuple> values;
+
+        m_dbAsic->hgetall(key, std::back_inserter(values));
+
+        fdbIndex->setEntry(key.substr(prefix.size()), values);
+    }
+
+    SWSS_LOG_NOTICE("enabling fdb index, loaded %zu fdb entries", fdbIndex->size());
+
+    m_fdbIndex = fdbIndex;
+}
+
 void RedisClient::processFlushEvent(
         _In_ sai_object_id_t switchVid,
         _In_ sai_object_id_t portVid,
@@ -851,6 +1163,21 @@ void RedisClient::processFlushEvent(
 
     // TODO this must be per switch if we will have multiple switches, needs to be filtered by switch ID also
 
+    if (m_fdbIndex)
+    {
+        auto keys = m_fdbIndex->flush(portVid, bvId, type);
+
+        SWSS_LOG_NOTICE("received a flush port fdb event, portVid = %s, bvId = %s, removing %zu entries",
+                sai_serialize_object_id(portVid).c_str(),
+                sai_serialize_object_id(bvId).c_str(),
+                keys.size());
+
+        updateAsicObjects(keys, {});
+        return;
+    }
+
+    flushAsicState(); // lua script operates on ASIC_STATE
+
     /*
        [{ "fdb_entry":"{ \"bridge_id\":\"oid:0x23000000000000\", \"mac\":\"00:00:00:00:00:00\", \"switch_id\":\"oid:0x21000000000000\"}", "fdb_event":"SAI_FDB_EVENT_FLUSHED", "list":[
        {"id":"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID","value":"oid:0x3a0000000009cf"},
@@ -4,7 +4,10 @@ extern "C" {
 #include "saimetadata.h"
 }
 
+#include "FdbIndex.h"
+
 #include "swss/table.h"
+#include "swss/redispipeline.h"
 
 #include <string>
 #include <unordered_map>
@@ -25,6 +28,31 @@ namespace syncd
 
         public:
 
+            /**
+             * @brief Enable or disable write behind of ASIC_STATE modifications.
+             *
+             * When enabled, create, remove and set operations on ASIC_STATE
+             * and temporary ASIC_STATE tables, and VIDTORID and RIDTOVID map
+             * updates are accumulated in the same redis pipeline instead of
+             * waiting for each reply, so object and its VID/RID mapping are
+             * always flushed together. Pipeline is flushed when it's full,
+             * when flushAsicState() is called, and before any operation which
+             * reads or scans ASIC_STATE or VID/RID maps. Order of operations
+             * is preserved.
+             *
+             * Disabling write behind flushes pending operations.
+             */
+            void setAsicStateWriteBehind(
+                    _In_ bool enable);
+
+            /**
+             * @brief Flush pending ASIC_STATE modifications to database.
+             *
+             * Serves as barrier, after this call all modifications made so
+             * far are visible in database.
+             */
+            void flushAsicState() const;
+
             void clearLaneMap(
                     _In_ sai_object_id_t switchVid) const;
 
@@ -105,6 +133,17 @@ namespace syncd
             void createTempAsicObjects(
                     _In_ const std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>& multiHash);
 
+            /**
+             * @brief Remove and create ASIC_STATE objects in single round trip.
+             *
+             * All removes are applied before creates, so object present in
+             * both is recreated with given attributes. If write behind is
+             * disabled, temporary pipeline is used and flushed.
+             */
+            void updateAsicObjects(
+                    _In_ const std::vector<std::string>& removeKeys,
+                    _In_ const std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>& multiHash);
+
             void setVidAndRidMap(
                     _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& map);
 
@@ -152,6 +191,18 @@ namespace syncd
                     _In_ const std::string& attr,
                     _In_ const std::string& value);
 
+            /**
+             * @brief Enable in memory index of FDB entries.
+             *
+             * Index can be enabled only when syncd is the only writer of
+             * ASIC_STATE (synchronous mode), since it's maintained from
+             * writes made by this client. When enabled, index is loaded
+             * from database and FDB flush removes exact set of keys
+             * instead of running flush script over whole keyspace.
+             */
+            void setFdbIndex(
+                    _In_ bool enable);
+
             void processFlushEvent(
                     _In_ sai_object_id_t switchVid,
                     _In_ sai_object_id_t portVid,
@@ -175,11 +226,39 @@ namespace syncd
             std::unordered_map<sai_object_id_t, sai_object_id_t> getObjectMap(
                     _In_ const std::string& key) const;
 
+            void asicStateHset(
+                    _In_ const std::string& key,
+                    _In_ const std::string& field,
+                    _In_ const std::string& value) const;
+
+            void asicStateHmset(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values) const;
+
+            void asicStateDel(
+                    _In_ const std::string& key) const;
+
+            void asicStateHdel(
+                    _In_ const std::string& key,
+                    _In_ const std::string& field) const;
+
         private:
 
             std::shared_ptr<swss::DBConnector> m_dbAsic;
 
+            /**
+             * @brief Pipeline used for ASIC_STATE write behind, null when
+             * write behind is disabled.
+             */
+            std::shared_ptr<swss::RedisPipeline> m_asicStatePipeline;
+
             std::string m_fdbFlushSha;
 
+            /**
+             * @brief Index of FDB entries in ASIC_STATE, null when disabled
+             * and flush is processed by lua script.
+             */
+            std::shared_ptr<FdbIndex> m_fdbIndex;
+
     };
 }
@@ -0,0 +1,323 @@
+#include "config.h"
+
+#include "SupportedCountersCache.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/json.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+using json = nlohmann::json;
+
+using namespace syncd;
+
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
+static void loadKeys(
+        _In_ const json& j,
+        _Inout_ std::map<std::string, std::map<std::string, bool>>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto it = j.begin(); it != j.end(); it++)
+    {
+        auto& counters = keys[it.key()];
+
+        for (auto itt = it.value().begin(); itt != it.value().end(); itt++)
+        {
+            counters[itt.key()] = itt.value();
+        }
+    }
+}
+
+static json dumpKeys(
+        _In_ const std::map<std::string, std::map<std::string, bool>>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    json j = json::object();
+
+    for (auto& key: keys)
+    {
+        json counters = json::object();
+
+        for (auto& counter: key.second)
+        {
+            counters[counter.first] = counter.second;
+        }
+
+        j[key.first] = counters;
+    }
+
+    return j;
+}
+
+SupportedCountersCache::SupportedCountersCache(
+        _In_ const std::string& file,
+        _In_ const std::string& platformId,
+        _In_ bool warmStart):
+    m_file(file),
+    m_platformId(platformId),
+    m_warmStart(warmStart),
+    m_dirty(false)
+{
+    SWSS_LOG_ENTER();
+
+    load();
+}
+
+SupportedCountersCache::~SupportedCountersCache()
+{
+    SWSS_LOG_ENTER();
+
+    flush();
+}
+
+void SupportedCountersCache::load()
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream ifs(m_file);
+
+    if (!ifs.good())
+    {
+        SWSS_LOG_NOTICE("supported counters cache %s not found, starting empty", m_file.c_str());
+
+        return;
+    }
+
+    try
+    {
+        json j;
+        ifs >> j;
+
+        const std::string& platformId = j["platform_id"];
+
+        if (platformId != m_platformId)
+        {
+            SWSS_LOG_NOTICE("supported counters cache %s was written by different platform (%s), ignoring",
+                    m_file.c_str(),
+                    platformId.c_str());
+
+            m_dirty = true;
+
+            return;
+        }
+
+        loadKeys(j["counters"], m_counters);
+
+        if (j.find("objects") == j.end())
+        {
+            // written without per object entries
+        }
+        else if (m_warmStart)
+        {
+            loadKeys(j["objects"], m_objects);
+        }
+        else if (j["objects"].size())
+        {
+            // objects are created again with new VIDs
+
+            SWSS_LOG_NOTICE("not warm start, dropping per object entries of supported counters cache %s", m_file.c_str());
+
+            m_dirty = true;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to load supported counters cache %s: %s, ignoring", m_file.c_str(), e.what());
+
+        m_counters.clear();
+        m_objects.clear();
+
+        m_dirty = true;
+
+        return;
+    }
+
+    SWSS_LOG_NOTICE("loaded supported counters cache %s, %zu keys, %zu object keys", m_file.c_str(), m_counters.size(), m_objects.size());
+}
+
+bool SupportedCountersCache::getSupported(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ const std::string& statName,
+        _Out_ bool& supported) const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto& keys = (objectId == SAI_NULL_OBJECT_ID) ? m_counters : m_objects;
+
+    auto it = keys.find(getKey(objectType, objectId, statsMode));
+
+    if (it == keys.end())
+    {
+        return false;
+    }
+
+    auto counter = it->second.find(statName);
+
+    if (counter == it->second.end())
+    {
+        return false;
+    }
+
+    supported = counter->second;
+
+    return true;
+}
+
+void SupportedCountersCache::setSupported(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ sai_stats_mode_t statsMode,
+        _In_ const std::string& statName,
+        _In_ bool supported)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto& keys = (objectId == SAI_NULL_OBJECT_ID) ? m_counters : m_objects;
+
+    auto& counters = keys[getKey(objectType, objectId, statsMode)];
+
+    auto it = counters.find(statName);
+
+    if (it != counters.end() && it->second == supported)
+    {
+        return;
+    }
+
+    counters[statName] = supported;
+
+    m_dirty = true;
+}
+
+void SupportedCountersCache::removeObject(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    for (auto statsMode: { SAI_STATS_MODE_READ, SAI_STATS_MODE_READ_AND_CLEAR })
+    {
+        if (m_objects.erase(getKey(objectType, objectId, statsMode)))
+        {
+            m_dirty = true;
+        }
+    }
+}
+
+void SupportedCountersCache::flush()
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (!m_dirty)
+    {
+        return;
+    }
+
+    json j;
+
+    j["platform_id"] = m_platformId;
+    j["counters"] = dumpKeys(m_counters);
+    j["objects"] = dumpKeys(m_objects);
+
+    // write to temporary file first, so interrupted write will not leave
+    // corrupted cache
+
+    std::string tmp = m_file + ".tmp";
+
+    std::ofstream ofs(tmp);
+
+    ofs << j.dump(4) << std::endl;
+
+    ofs.close();
+
+    if (!ofs.good() || rename(tmp.c_str(), m_file.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to write supported counters cache %s: %s", m_file.c_str(), strerror(errno));
+
+        remove(tmp.c_str());
+
+        return;
+    }
+
+    m_dirty = false;
+
+    SWSS_LOG_INFO("supported counters cache %s written", m_file.c_str());
+}
+
+const std::string& SupportedCountersCache::getPlatformId() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_platformId;
+}
+
+std::string SupportedCountersCache::makePlatformId(
+        _In_ const std::string& hwSku,
+        _In_ const std::map<std::string, std::string>& profileMap)
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    // profile alone does not identify SKU, SKUs could share the same
+    // profile while having different ports
+
+    ss << "HWSKU=" << hwSku;
+    ss << " SAI_API_VERSION=" << SAI_API_VERSION;
+
+#ifdef HAVE_SAI_QUERY_API_VERSION
+    sai_api_version_t version{};
+
+    if (sai_query_api_version(&version) == SAI_STATUS_SUCCESS)
+    {
+        ss << " SAI_VENDOR_VERSION=" << version;
+    }
+#endif
+
+    for (auto& kv: profileMap)
+    {
+        if (kv.first == SAI_KEY_BOOT_TYPE)
+        {
+            continue;
+        }
+
+        ss << " " << kv.first << "=" << kv.second;
+    }
+
+    return ss.str();
+}
+
+std::string SupportedCountersCache::getKey(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ sai_stats_mode_t statsMode)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = sai_serialize_object_type(objectType) + ":" + std::to_string(statsMode);
+
+    if (objectId != SAI_NULL_OBJECT_ID)
+    {
+        key += ":" + sai_serialize_object_id(objectId);
+    }
+
+    return key;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace syncd
+{
+    /**
+     * @brief Persistent cache of supported counters.
+     *
+     * Flex counter discovers supported counters by capability query or by
+     * probing each counter with get stats, which is slow on platforms
+     * without capability query. Results are cached per object type and
+     * stats mode in a file, which is reused on next start if it was written
+     * by the same HW SKU, SAI version and SAI profile.
+     *
+     * Object types which support may differ per object (like ports or
+     * queues of different type) are cached per object VID. VIDs are never
+     * reused while syncd is running and they are preserved only across warm
+     * start, so per object entries are dropped on any other start, and
+     * entry is removed when object is removed from flex counter.
+     */
+    class SupportedCountersCache
+    {
+        private:
+
+            SupportedCountersCache(const SupportedCountersCache&) = delete;
+            SupportedCountersCache& operator=(const SupportedCountersCache&) = delete;
+
+        public:
+
+            /**
+             * @brief Load cache from file.
+             *
+             * Missing, corrupted or file written by different platform is
+             * ignored and cache starts empty.
+             *
+             * @param file Cache file.
+             * @param platformId Identifies HW SKU, SAI version and profile.
+             * @param warmStart Per object entries are loaded only on warm
+             * start.
+             */
+            SupportedCountersCache(
+                    _In_ const std::string& file,
+                    _In_ const std::string& platformId,
+                    _In_ bool warmStart = false);
+
+            /**
+             * @brief Write modified cache to file.
+             */
+            virtual ~SupportedCountersCache();
+
+        public:
+
+            /**
+             * @brief Get cached support of counter.
+             *
+             * @param objectId Object VID when support is cached per object,
+             * otherwise SAI_NULL_OBJECT_ID.
+             *
+             * @return False if counter was not discovered yet.
+             */
+            bool getSupported(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ const std::string& statName,
+                    _Out_ bool& supported) const;
+
+            void setSupported(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ sai_stats_mode_t statsMode,
+                    _In_ const std::string& statName,
+                    _In_ bool supported);
+
+            /**
+             * @brief Remove per object entries of object, in all stats
+             * modes.
+             */
+            void removeObject(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId);
+
+            /**
+             * @brief Write cache to file if it was modified.
+             */
+            void flush();
+
+            const std::string& getPlatformId() const;
+
+        public:
+
+            /**
+             * @brief Create platform id from HW SKU, SAI versions and SAI
+             * profile.
+             *
+             * Boot type is not part of id, so cache is reused across cold
+             * and warm starts.
+             */
+            static std::string makePlatformId(
+                    _In_ const std::string& hwSku,
+                    _In_ const std::map<std::string, std::string>& profileMap);
+
+        private:
+
+            void load();
+
+            static std::string getKey(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ sai_stats_mode_t statsMode);
+
+        private:
+
+            std::string m_file;
+
+            std::string m_platformId;
+
+            bool m_warmStart;
+
+            /**
+             * @brief Counter support by object type and stats mode key.
+             */
+            std::map<std::string, std::map<std::string, bool>> m_counters;
+
+            /**
+             * @brief Counter support by object type, stats mode and object
+             * key.
+             */
+            std::map<std::string, std::map<std::string, bool>> m_objects;
+
+            bool m_dirty;
+
+            mutable std::mutex m_mutex;
+    };
+}
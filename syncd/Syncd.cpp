@@ -12,6 +12,10 @@
 #include "RedisNotificationProducer.h"
 #include "ZeroMQNotificationProducer.h"
 #include "WatchdogScope.h"
+#include "EventDecoder.h"
+#include "NotificationTracer.h"
+#include "NotificationRingWriter.h"
+#include "FdbEventFilter.h"
 
 #include "sairediscommon.h"
 
@@ -105,8 +109,6 @@ Syncd::Syncd(
         m_enableSyncMode = true;
     }
 
-    m_manager = std::make_shared<FlexCounterManager>(m_vendorSai, m_contextConfig->m_dbCounters);
-
     loadProfileMap();
 
     m_profileIter = m_profileMap.begin();
@@ -144,9 +146,33 @@ Syncd::Syncd(
 
     m_client = std::make_shared<RedisClient>(m_dbAsic);
 
-    m_processor = std::make_shared<NotificationProcessor>(m_notifications, m_client, std::bind(&Syncd::syncProcessNotification, this, _1));
+    m_processor = std::make_shared<NotificationProcessor>(m_notifications, m_client, std::bind(&Syncd::syncProcessNotifications, this, _1));
     m_handler = std::make_shared<NotificationHandler>(m_processor);
 
+    std::shared_ptr<swss::DBConnector> dbState;
+
+    if (m_commandLineOptions->m_enableNotificationTrace || m_commandLineOptions->m_fdbEventDedupWindow)
+    {
+        dbState = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbState, 0);
+    }
+
+    if (m_commandLineOptions->m_enableNotificationTrace)
+    {
+        m_processor->setTracer(std::make_shared<NotificationTracer>(dbState));
+    }
+
+    if (m_commandLineOptions->m_fdbEventDedupWindow)
+    {
+        m_processor->setFdbEventFilter(std::make_shared<FdbEventFilter>(m_commandLineOptions->m_fdbEventDedupWindow, dbState));
+    }
+
+    if (m_commandLineOptions->m_notificationRingSize)
+    {
+        m_processor->setRing(std::make_shared<NotificationRingWriter>(
+                    m_commandLineOptions->m_globalContext,
+                    (uint64_t)m_commandLineOptions->m_notificationRingSize * 1024));
+    }
+
     m_sn.onFdbEvent = std::bind(&NotificationHandler::onFdbEvent, m_handler.get(), _1, _2);
     m_sn.onNatEvent = std::bind(&NotificationHandler::onNatEvent, m_handler.get(), _1, _2);
     m_sn.onPortStateChange = std::bind(&NotificationHandler::onPortStateChange, m_handler.get(), _1, _2);
@@ -182,6 +208,20 @@ Syncd::Syncd(
 
     performStartupLogic();
 
+    std::shared_ptr<SupportedCountersCache> supportedCountersCache;
+
+    if (m_commandLineOptions->m_supportedCountersCache.size())
+    {
+        // per object entries are valid only when objects are preserved
+
+        supportedCountersCache = std::make_shared<SupportedCountersCache>(
+                m_commandLineOptions->m_supportedCountersCache,
+                SupportedCountersCache::makePlatformId(m_commandLineOptions->m_hwSku, m_profileMap),
+                m_commandLineOptions->m_startType == SAI_START_TYPE_WARM_BOOT);
+    }
+
+    m_manager = std::make_shared<FlexCounterManager>(m_vendorSai, m_contextConfig->m_dbCounters, supportedCountersCache);
+
     m_smt.profileGetValue = std::bind(&Syncd::profileGetValue, this, _1, _2);
     m_smt.profileGetNextValue = std::bind(&Syncd::profileGetNextValue, this, _1, _2, _3);
 
@@ -199,6 +239,11 @@ Syncd::Syncd(
 
     m_breakConfig = BreakConfigParser::parseBreakConfig(m_commandLineOptions->m_breakConfig);
 
+    if (m_commandLineOptions->m_eventPipelineThreads)
+    {
+        m_eventDecoder = std::make_shared<EventDecoder>(m_commandLineOptions->m_eventPipelineThreads);
+    }
+
     SWSS_LOG_NOTICE("syncd started");
 }
 
@@ -297,6 +342,13 @@ void Syncd::processEvent(
 
     do
     {
+        if (m_eventDecoder)
+        {
+            processEventBatch(consumer);
+
+            continue;
+        }
+
         swss::KeyOpFieldsValuesTuple kco;
 
         /*
@@ -310,6 +362,83 @@ void Syncd::processEvent(
         processSingleEvent(kco);
     }
     while (!consumer.empty());
+
+    // drained batch, push pending ASIC_STATE modifications to database
+
+    m_client->flushAsicState();
+}
+
+void Syncd::processEventBatch(
+        _In_ sairedis::SelectableChannel& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<DecodedEvent>> batch;
+
+    do
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        consumer.pop(kco, isInitViewMode());
+
+        auto event = std::make_shared<DecodedEvent>(kco);
+
+        m_eventDecoder->decode(event);
+
+        batch.push_back(event);
+
+        /*
+         * Notify syncd can change init view mode, which is used when popping
+         * next events, so it must be executed before any next pop.
+         */
+
+        if (kfvOp(kco) == REDIS_ASIC_STATE_COMMAND_NOTIFY)
+        {
+            break;
+        }
+    }
+    while (!consumer.empty() && batch.size() < EventDecoder::MAX_BATCH_SIZE);
+
+    // events are decoded in parallel, but executed in order they arrived
+
+    for (auto& event: batch)
+    {
+        m_eventDecoder->wait(*event);
+
+        processDecodedEvent(*event);
+    }
+}
+
+sai_status_t Syncd::processDecodedEvent(
+        _In_ DecodedEvent& event)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& kco = event.m_kco;
+
+    if (event.m_api == SAI_COMMON_API_MAX)
+    {
+        return processSingleEvent(kco);
+    }
+
+    auto& key = kfvKey(kco);
+    auto& op = kfvOp(kco);
+
+    SWSS_LOG_INFO("key: %s op: %s", key.c_str(), op.c_str());
+
+    WatchdogScope ws(m_timerWatchdog, op + ":" + key, &kco);
+
+    if (EventDecoder::isBulkApi(event.m_api))
+    {
+        return processDecodedBulkQuadEvent(
+                event.m_api,
+                event.m_objectType,
+                event.m_objectIds,
+                event.m_attributes,
+                event.m_strAttributes);
+    }
+
+    return processDecodedQuadEvent(event.m_api, kco, event.m_metaKey, *event.m_list);
 }
 
 sai_status_t Syncd::processSingleEvent(
@@ -591,6 +720,8 @@ sai_status_t Syncd::processFdbFlush(
 
     m_translator->translateVidToRid(SAI_OBJECT_TYPE_FDB_FLUSH, attr_count, attr_list);
 
+    invalidateFdbEventFilter();
+
     sai_status_t status = m_vendorSai->flushFdbEntries(switchRid, attr_count, attr_list);
 
     m_selectableChannel->set(sai_serialize_status(status), {} , REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
@@ -638,6 +769,18 @@ sai_status_t Syncd::processFdbFlush(
     return status;
 }
 
+void Syncd::invalidateFdbEventFilter()
+{
+    SWSS_LOG_ENTER();
+
+    auto filter = m_processor->getFdbEventFilter();
+
+    if (filter)
+    {
+        filter->invalidate();
+    }
+}
+
 sai_status_t Syncd::processClearStatsEvent(
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
@@ -771,60 +914,32 @@ sai_status_t Syncd::processBulkQuadEvent(
 {
     SWSS_LOG_ENTER();
 
-    const std::string& key = kfvKey(kco); // objectType:count
-
-    std::string strObjectType = key.substr(0, key.find(":"));
-
     sai_object_type_t objectType;
-    sai_deserialize_object_type(strObjectType, objectType);
 
-    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+    std::vector<std::string> objectIds;
 
     std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
 
-    // field = objectId
-    // value = attrid=attrvalue|...
-
-    std::vector<std::string> objectIds;
-
     std::vector<std::shared_ptr<SaiAttributeList>> attributes;
 
-    for (const auto &fvt: values)
-    {
-        std::string strObjectId = fvField(fvt);
-        std::string joined = fvValue(fvt);
-
-        // decode values
-
-        auto v = swss::tokenize(joined, '|');
-
-        objectIds.push_back(strObjectId);
-
-        std::vector<swss::FieldValueTuple> entries; // attributes per object id
-
-        for (size_t i = 0; i < v.size(); ++i)
-        {
-            const std::string item = v.at(i);
-
-            auto start = item.find_first_of("=");
+    EventDecoder::prepareBulkEvent(kco, objectType, objectIds, strAttributes, attributes);
 
-            auto field = item.substr(0, start);
-            auto value = item.substr(start + 1);
+    EventDecoder::decodeBulkEvent(kco, objectType, 0, objectIds.size(), objectIds, strAttributes, attributes);
 
-            entries.emplace_back(field, value);
-        }
-
-        strAttributes.push_back(entries);
-
-        // since now we converted this to proper list, we can extract attributes
-
-        auto list = std::make_shared<SaiAttributeList>(objectType, entries, false);
+    return processDecodedBulkQuadEvent(api, objectType, objectIds, attributes, strAttributes);
+}
 
-        attributes.push_back(list);
-    }
+sai_status_t Syncd::processDecodedBulkQuadEvent(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<std::string>& objectIds,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
+        _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes)
+{
+    SWSS_LOG_ENTER();
 
     SWSS_LOG_INFO("bulk %s executing with %zu items",
-            strObjectType.c_str(),
+            sai_serialize_object_type(objectType).c_str(),
             objectIds.size());
 
     if (isInitViewMode())
@@ -832,6 +947,11 @@ sai_status_t Syncd::processBulkQuadEvent(
         return processBulkQuadEventInInitViewMode(objectType, objectIds, api, attributes, strAttributes);
     }
 
+    if (objectType == SAI_OBJECT_TYPE_FDB_ENTRY && api != SAI_COMMON_API_BULK_GET)
+    {
+        invalidateFdbEventFilter();
+    }
+
     if (api != SAI_COMMON_API_BULK_GET)
     {
         // translate attributes for all objects
@@ -2704,19 +2824,26 @@ sai_status_t Syncd::processQuadEvent(
 {
     SWSS_LOG_ENTER();
 
+    sai_object_meta_key_t metaKey;
+
+    auto list = EventDecoder::decodeQuadEvent(kco, metaKey);
+
+    return processDecodedQuadEvent(api, kco, metaKey, *list);
+}
+
+sai_status_t Syncd::processDecodedQuadEvent(
+        _In_ sai_common_api_t api,
+        _In_ const swss::KeyOpFieldsValuesTuple &kco,
+        _In_ sai_object_meta_key_t metaKey,
+        _Inout_ SaiAttributeList& list)
+{
+    SWSS_LOG_ENTER();
+
     const std::string& key = kfvKey(kco);
     const std::string& op = kfvOp(kco);
 
     const std::string& strObjectId = key.substr(key.find(":") + 1);
 
-    sai_object_meta_key_t metaKey;
-    sai_deserialize_object_meta_key(key, metaKey);
-
-    if (!sai_metadata_is_object_type_valid(metaKey.objecttype))
-    {
-        SWSS_LOG_THROW("invalid object type %s", key.c_str());
-    }
-
     auto& values = kfvFieldsValues(kco);
 
     for (auto& v: values)
@@ -2724,8 +2851,6 @@ sai_status_t Syncd::processQuadEvent(
         SWSS_LOG_DEBUG("attr: %s: %s", fvField(v).c_str(), fvValue(v).c_str());
     }
 
-    SaiAttributeList list(metaKey.objecttype, values, false);
-
     /*
      * Attribute list can't be const since we will use it to translate VID to
      * RID in place.
@@ -2763,6 +2888,11 @@ sai_status_t Syncd::processQuadEvent(
         return status;
     }
 
+    if (metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY && api != SAI_COMMON_API_GET)
+    {
+        invalidateFdbEventFilter();
+    }
+
     if (api != SAI_COMMON_API_GET)
     {
         /*
@@ -3595,6 +3725,13 @@ sai_status_t Syncd::processNotifySyncd(
 {
     SWSS_LOG_ENTER();
 
+    /*
+     * Barrier for ASIC_STATE write behind, init view and apply view operate
+     * on database content, so all previous modifications must be there.
+     */
+
+    m_client->flushAsicState();
+
     auto& key = kfvKey(kco);
     sai_status_t status = SAI_STATUS_SUCCESS;
 
@@ -3612,6 +3749,24 @@ sai_status_t Syncd::processNotifySyncd(
     if (redisNotifySyncd == SAI_REDIS_NOTIFY_SYNCD_INVOKE_DUMP)
     {
         SWSS_LOG_NOTICE("Invoking SAI failure dump");
+
+        auto tracer = m_processor->getTracer();
+
+        if (tracer)
+        {
+            for (auto& line: tracer->dump())
+            {
+                SWSS_LOG_NOTICE("notification latency: %s", line.c_str());
+            }
+        }
+
+        auto filter = m_processor->getFdbEventFilter();
+
+        if (filter)
+        {
+            SWSS_LOG_NOTICE("fdb event filter: %s", filter->dump().c_str());
+        }
+
         std::string ret_str;
         int ret = swss::exec(SAI_FAILURE_DUMP_SCRIPT, ret_str);
         if (ret != 0)
@@ -3936,7 +4091,8 @@ sai_status_t Syncd::applyView()
             auto current = std::make_shared<AsicView>(currentMap.at(switchVid));
             auto temp = std::make_shared<AsicView>(temporaryMap.at(switchVid));
 
-            auto cl = std::make_shared<ComparisonLogic>(m_vendorSai, sw, m_handler, m_initViewRemovedVidSet, current, temp, m_breakConfig);
+            auto cl = std::make_shared<ComparisonLogic>(m_vendorSai, sw, m_handler, m_initViewRemovedVidSet, current, temp, m_breakConfig,
+                    !m_commandLineOptions->m_disableViewFingerprints);
 
             cl->compareViews();
 
@@ -4809,14 +4965,16 @@ sai_status_t Syncd::setUninitDataPlaneOnRemovalOnAllSwitches()
     return result;
 }
 
-void Syncd::syncProcessNotification(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
+void Syncd::syncProcessNotifications(
+        _In_ const std::vector<std::shared_ptr<sairedis::Notification>>& items)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
     SWSS_LOG_ENTER();
 
-    m_processor->syncProcessNotification(item);
+    m_processor->syncProcessNotifications(items);
+
+    m_client->flushAsicState();
 }
 
 bool Syncd::isVeryFirstRun()
@@ -4868,6 +5026,16 @@ void Syncd::run()
     {
         onSyncdStart(m_commandLineOptions->m_startType == SAI_START_TYPE_WARM_BOOT);
 
+        // in synchronous mode database is modified by syncd, so we can
+        // pipeline ASIC_STATE modifications and flush them per batch
+
+        m_client->setAsicStateWriteBehind(m_enableSyncMode);
+
+        // FDB entries can be tracked in memory only when syncd is the only
+        // writer of ASIC_STATE
+
+        m_client->setFdbIndex(m_enableSyncMode);
+
         // create notifications processing thread after we create_switch to
         // make sure, we have switch_id translated to VID before we start
         // processing possible quick fdb notifications, and pointer for
@@ -5025,6 +5193,12 @@ void Syncd::run()
         }
     }
 
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_client->setAsicStateWriteBehind(false);
+    }
+
     WatchdogScope ws(m_timerWatchdog, "shutting down syncd");
 
     if (shutdownType == SYNCD_RESTART_TYPE_WARM)
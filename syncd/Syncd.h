@@ -18,6 +18,7 @@
 #include "NotificationProducerBase.h"
 #include "TimerWatchdog.h"
 #include "MdioIpcServer.h"
+#include "EventDecoder.h"
 
 #include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
@@ -125,6 +126,16 @@ namespace syncd
             sai_status_t processSingleEvent(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            /**
+             * @brief Pop batch of events, decode them on event decoder
+             * threads and execute them in order.
+             */
+            void processEventBatch(
+                    _In_ sairedis::SelectableChannel& consumer);
+
+            sai_status_t processDecodedEvent(
+                    _In_ DecodedEvent& event);
+
             sai_status_t processAttrCapabilityQuery(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
@@ -137,6 +148,13 @@ namespace syncd
             sai_status_t processFdbFlush(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            /**
+             * @brief Invalidate FDB event filter before FDB entries are
+             * changed by application, since changed entries can be learned
+             * again and their next event must not be suppressed.
+             */
+            void invalidateFdbEventFilter();
+
             sai_status_t processClearStatsEvent(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
@@ -147,10 +165,23 @@ namespace syncd
                     _In_ sai_common_api_t api,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            sai_status_t processDecodedQuadEvent(
+                    _In_ sai_common_api_t api,
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco,
+                    _In_ sai_object_meta_key_t metaKey,
+                    _Inout_ saimeta::SaiAttributeList& list);
+
             sai_status_t processBulkQuadEvent(
                     _In_ sai_common_api_t api,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            sai_status_t processDecodedBulkQuadEvent(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<std::string>& objectIds,
+                    _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
+                    _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
+
             sai_status_t processBulkOid(
                     _In_ sai_object_type_t objectType,
                     _In_ const std::vector<std::string> &object_ids,
@@ -279,8 +310,8 @@ namespace syncd
                     _In_ uint32_t attr_count,
                     _In_ sai_attribute_t *attr_list);
 
-            void syncProcessNotification(
-                    _In_ const swss::KeyOpFieldsValuesTuple& item);
+            void syncProcessNotifications(
+                    _In_ const std::vector<std::shared_ptr<sairedis::Notification>>& items);
 
         private:
 
@@ -496,6 +527,12 @@ namespace syncd
 
             TimerWatchdog m_timerWatchdog;
 
+            /**
+             * @brief Decodes events ahead of execution, null when event
+             * pipeline is disabled.
+             */
+            std::shared_ptr<EventDecoder> m_eventDecoder;
+
             std::set<sai_object_id_t> m_createdInInitView;
     };
 }
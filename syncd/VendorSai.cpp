@@ -10,14 +10,24 @@
 
 using namespace syncd;
 
-#define MUTEX() std::lock_guard<std::mutex> _lock(m_apimutex)
+#define MUTEX(apiClass) auto _lock = m_apiLock.lock(apiClass)
 
 #define VENDOR_CHECK_API_INITIALIZED()                                       \
     if (!m_apiInitialized) {                                                \
         SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);     \
         return SAI_STATUS_FAILURE; }
 
-VendorSai::VendorSai()
+VendorSai::VendorSai():
+    VendorSai(SAI_API_LOCK_POLICY_GLOBAL)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+VendorSai::VendorSai(
+        _In_ sai_api_lock_policy_t apiLockPolicy):
+    m_apiLock(apiLockPolicy)
 {
     SWSS_LOG_ENTER();
 
@@ -42,7 +52,7 @@ sai_status_t VendorSai::initialize(
         _In_ uint64_t flags,
         _In_ const sai_service_method_table_t *service_method_table)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_INIT);
     SWSS_LOG_ENTER();
 
     if (m_apiInitialized)
@@ -133,7 +143,7 @@ sai_status_t VendorSai::create(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -179,7 +189,7 @@ sai_status_t VendorSai::remove(
         _In_ sai_object_type_t objectType,
         _In_ sai_object_id_t objectId)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -219,7 +229,7 @@ sai_status_t VendorSai::set(
         _In_ sai_object_id_t objectId,
         _In_ const sai_attribute_t *attr)
 {
-    std::unique_lock<std::mutex> _lock(m_apimutex);
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -267,7 +277,7 @@ sai_status_t VendorSai::get(
         _In_ uint32_t attr_count,
         _Inout_ sai_attribute_t *attr_list)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_READ);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -310,7 +320,7 @@ sai_status_t VendorSai::create(                                             \
         _In_ uint32_t attr_count,                                           \
         _In_ const sai_attribute_t *attr_list)                              \
 {                                                                           \
-    MUTEX();                                                                \
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);                                       \
     SWSS_LOG_ENTER();                                                       \
     VENDOR_CHECK_API_INITIALIZED();                                         \
     auto info = sai_metadata_get_object_type_info(                          \
@@ -326,7 +336,7 @@ SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_CREATE_ENTRY);
 sai_status_t VendorSai::remove(                                             \
         _In_ const sai_ ## ot ## _t* entry)                                 \
 {                                                                           \
-    MUTEX();                                                                \
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);                                       \
     SWSS_LOG_ENTER();                                                       \
     VENDOR_CHECK_API_INITIALIZED();                                         \
     auto info = sai_metadata_get_object_type_info(                          \
@@ -343,7 +353,7 @@ sai_status_t VendorSai::set(                                                \
         _In_ const sai_ ## ot ## _t* entry,                                 \
         _In_ const sai_attribute_t *attr)                                   \
 {                                                                           \
-    MUTEX();                                                                \
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);                                       \
     SWSS_LOG_ENTER();                                                       \
     VENDOR_CHECK_API_INITIALIZED();                                         \
     auto info = sai_metadata_get_object_type_info(                          \
@@ -361,7 +371,7 @@ sai_status_t VendorSai::get(                                                \
         _In_ uint32_t attr_count,                                           \
         _Inout_ sai_attribute_t *attr_list)                                 \
 {                                                                           \
-    MUTEX();                                                                \
+    MUTEX(SAI_API_LOCK_CLASS_READ);                                         \
     SWSS_LOG_ENTER();                                                       \
     VENDOR_CHECK_API_INITIALIZED();                                         \
     auto info = sai_metadata_get_object_type_info(                          \
@@ -382,7 +392,7 @@ sai_status_t VendorSai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_STATS);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -473,7 +483,7 @@ sai_status_t VendorSai::queryStatsCapability(
         _In_ sai_object_type_t objectType,
         _Inout_ sai_stat_capability_list_t *stats_capability)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_READ);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -491,7 +501,7 @@ sai_status_t VendorSai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_STATS);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -578,7 +588,7 @@ sai_status_t VendorSai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const sai_stat_id_t *counter_ids)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_CLEAR_STATS);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -668,7 +678,7 @@ sai_status_t VendorSai::bulkGetStats(
         _Inout_ sai_status_t *object_statuses,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_STATS);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -698,7 +708,7 @@ sai_status_t VendorSai::bulkClearStats(
         _In_ sai_stats_mode_t mode,
         _Inout_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_CLEAR_STATS);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -729,7 +739,7 @@ sai_status_t VendorSai::bulkCreate(
         _Out_ sai_object_id_t *object_id,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -811,7 +821,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -885,7 +895,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -904,7 +914,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -931,7 +941,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -958,7 +968,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -985,7 +995,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1012,7 +1022,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1039,7 +1049,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1066,7 +1076,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1093,7 +1103,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1120,7 +1130,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1147,7 +1157,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1174,7 +1184,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1201,7 +1211,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1228,7 +1238,7 @@ sai_status_t VendorSai::bulkCreate(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1255,7 +1265,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1279,7 +1289,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1302,7 +1312,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1325,7 +1335,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1348,7 +1358,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1371,7 +1381,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1394,7 +1404,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1417,7 +1427,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1440,7 +1450,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1463,7 +1473,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1486,7 +1496,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1509,7 +1519,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1532,7 +1542,7 @@ sai_status_t VendorSai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1558,7 +1568,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1583,7 +1593,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1608,7 +1618,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1633,7 +1643,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1658,7 +1668,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1683,7 +1693,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1708,7 +1718,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1722,7 +1732,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1736,7 +1746,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1750,7 +1760,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1764,7 +1774,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1778,7 +1788,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1792,7 +1802,7 @@ sai_status_t VendorSai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1806,7 +1816,7 @@ sai_status_t VendorSai::flushFdbEntries(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1820,7 +1830,7 @@ sai_status_t VendorSai::switchMdioRead(
         _In_ uint32_t number_of_registers,
         _Out_ uint32_t *reg_val)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_READ);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1834,7 +1844,7 @@ sai_status_t VendorSai::switchMdioWrite(
         _In_ uint32_t number_of_registers,
         _In_ const uint32_t *reg_val)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1848,7 +1858,7 @@ sai_status_t VendorSai::switchMdioCl22Read(
         _In_ uint32_t number_of_registers,
         _Out_ uint32_t *reg_val)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_READ);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1866,7 +1876,7 @@ sai_status_t VendorSai::switchMdioCl22Write(
         _In_ uint32_t number_of_registers,
         _In_ const uint32_t *reg_val)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_MODIFY);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1886,7 +1896,7 @@ sai_status_t VendorSai::objectTypeGetAvailability(
         _In_ const sai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_READ);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1904,7 +1914,7 @@ sai_status_t VendorSai::queryAttributeCapability(
         _In_ sai_attr_id_t attrId,
         _Out_ sai_attr_capability_t *capability)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_READ);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -1921,7 +1931,7 @@ sai_status_t VendorSai::queryAattributeEnumValuesCapability(
         _In_ sai_attr_id_t attrId,
         _Inout_ sai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
+    MUTEX(SAI_API_LOCK_CLASS_READ);
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
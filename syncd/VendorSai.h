@@ -4,6 +4,8 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "VendorSaiLock.h"
+
 #include "meta/SaiInterface.h"
 
 #include <string>
@@ -20,6 +22,9 @@ namespace syncd
 
             VendorSai();
 
+            VendorSai(
+                    _In_ sai_api_lock_policy_t apiLockPolicy);
+
             virtual ~VendorSai();
 
         public:
@@ -205,7 +210,11 @@ namespace syncd
 
             bool m_apiInitialized;
 
-            std::mutex m_apimutex;
+            /**
+             * @brief Lock serializing vendor SAI calls according to
+             * configured policy.
+             */
+            VendorSaiLock m_apiLock;
 
             sai_service_method_table_t m_service_method_table;
 
@@ -0,0 +1,243 @@
+#include "VendorSaiLock.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+#include <chrono>
+
+using namespace syncd;
+
+VendorSaiLock::VendorSaiLock(
+        _In_ sai_api_lock_policy_t policy,
+        _In_ uint64_t logInterval):
+    m_policy(policy),
+    m_logInterval(logInterval)
+{
+    SWSS_LOG_ENTER();
+
+    if (policy >= SAI_API_LOCK_POLICY_UNKNOWN)
+    {
+        SWSS_LOG_THROW("invalid api lock policy: %d", policy);
+    }
+
+    for (int idx = 0; idx < SAI_API_LOCK_CLASS_COUNT; idx++)
+    {
+        m_calls[idx] = 0;
+        m_totalWaitNs[idx] = 0;
+        m_maxWaitNs[idx] = 0;
+    }
+
+    SWSS_LOG_NOTICE("vendor SAI api lock policy: %s", policyToString(policy).c_str());
+}
+
+VendorSaiLock::Guard VendorSaiLock::lock(
+        _In_ sai_api_lock_class_t apiClass)
+{
+    SWSS_LOG_ENTER();
+
+    Guard guard;
+
+    auto start = std::chrono::steady_clock::now();
+
+    if (apiClass == SAI_API_LOCK_CLASS_INIT)
+    {
+        // always the same order, other classes take only single lock
+
+        guard.m_apiLock = std::unique_lock<std::mutex>(m_apiMutex);
+        guard.m_statsLock = std::unique_lock<std::mutex>(m_statsMutex);
+        guard.m_exclusiveLock = std::unique_lock<std::shared_timed_mutex>(m_rwMutex);
+    }
+    else
+    {
+        const bool isStats = (apiClass == SAI_API_LOCK_CLASS_STATS || apiClass == SAI_API_LOCK_CLASS_CLEAR_STATS);
+
+        switch (m_policy)
+        {
+            case SAI_API_LOCK_POLICY_GLOBAL:
+
+                guard.m_apiLock = std::unique_lock<std::mutex>(m_apiMutex);
+                break;
+
+            case SAI_API_LOCK_POLICY_STATS:
+
+                if (isStats)
+                    guard.m_statsLock = std::unique_lock<std::mutex>(m_statsMutex);
+                else
+                    guard.m_apiLock = std::unique_lock<std::mutex>(m_apiMutex);
+
+                break;
+
+            case SAI_API_LOCK_POLICY_RW:
+
+                if (apiClass == SAI_API_LOCK_CLASS_READ || apiClass == SAI_API_LOCK_CLASS_STATS)
+                    guard.m_sharedLock = std::shared_lock<std::shared_timed_mutex>(m_rwMutex);
+                else
+                    guard.m_exclusiveLock = std::unique_lock<std::shared_timed_mutex>(m_rwMutex);
+
+                break;
+
+            case SAI_API_LOCK_POLICY_NONE:
+
+                break;
+
+            default:
+
+                SWSS_LOG_THROW("unknown api lock policy: %d", m_policy);
+        }
+    }
+
+    auto waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    recordWait(apiClass, (uint64_t)waitNs);
+
+    return guard;
+}
+
+void VendorSaiLock::Guard::unlock()
+{
+    SWSS_LOG_ENTER();
+
+    // reverse order of acquire
+
+    if (m_sharedLock.owns_lock())
+        m_sharedLock.unlock();
+
+    if (m_exclusiveLock.owns_lock())
+        m_exclusiveLock.unlock();
+
+    if (m_statsLock.owns_lock())
+        m_statsLock.unlock();
+
+    if (m_apiLock.owns_lock())
+        m_apiLock.unlock();
+}
+
+void VendorSaiLock::recordWait(
+        _In_ sai_api_lock_class_t apiClass,
+        _In_ uint64_t waitNs)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t calls = ++m_calls[apiClass];
+
+    uint64_t total = (m_totalWaitNs[apiClass] += waitNs);
+
+    uint64_t max = m_maxWaitNs[apiClass];
+
+    while (waitNs > max && !m_maxWaitNs[apiClass].compare_exchange_weak(max, waitNs))
+    {
+        // max is updated by compare_exchange_weak on failure
+    }
+
+    if (m_logInterval && (calls % m_logInterval) == 0)
+    {
+        SWSS_LOG_NOTICE("%s api lock wait: calls %" PRIu64 ", avg %" PRIu64 " ns, max %" PRIu64 " ns",
+                apiClassToString(apiClass).c_str(),
+                calls,
+                total / calls,
+                (uint64_t)m_maxWaitNs[apiClass]);
+    }
+}
+
+sai_api_lock_policy_t VendorSaiLock::getPolicy() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_policy;
+}
+
+VendorSaiLock::WaitStatistics VendorSaiLock::getWaitStatistics(
+        _In_ sai_api_lock_class_t apiClass) const
+{
+    SWSS_LOG_ENTER();
+
+    if (apiClass >= SAI_API_LOCK_CLASS_COUNT)
+    {
+        SWSS_LOG_THROW("invalid api lock class: %d", apiClass);
+    }
+
+    WaitStatistics stats;
+
+    stats.calls = m_calls[apiClass];
+    stats.totalWaitNs = m_totalWaitNs[apiClass];
+    stats.maxWaitNs = m_maxWaitNs[apiClass];
+
+    return stats;
+}
+
+sai_api_lock_policy_t VendorSaiLock::policyStringToPolicy(
+        _In_ const std::string& policy)
+{
+    SWSS_LOG_ENTER();
+
+    if (policy == STRING_SAI_API_LOCK_POLICY_GLOBAL)
+        return SAI_API_LOCK_POLICY_GLOBAL;
+
+    if (policy == STRING_SAI_API_LOCK_POLICY_STATS)
+        return SAI_API_LOCK_POLICY_STATS;
+
+    if (policy == STRING_SAI_API_LOCK_POLICY_RW)
+        return SAI_API_LOCK_POLICY_RW;
+
+    if (policy == STRING_SAI_API_LOCK_POLICY_NONE)
+        return SAI_API_LOCK_POLICY_NONE;
+
+    SWSS_LOG_WARN("unknown api lock policy: '%s'", policy.c_str());
+
+    return SAI_API_LOCK_POLICY_UNKNOWN;
+}
+
+std::string VendorSaiLock::policyToString(
+        _In_ sai_api_lock_policy_t policy)
+{
+    SWSS_LOG_ENTER();
+
+    switch (policy)
+    {
+        case SAI_API_LOCK_POLICY_GLOBAL:
+            return STRING_SAI_API_LOCK_POLICY_GLOBAL;
+
+        case SAI_API_LOCK_POLICY_STATS:
+            return STRING_SAI_API_LOCK_POLICY_STATS;
+
+        case SAI_API_LOCK_POLICY_RW:
+            return STRING_SAI_API_LOCK_POLICY_RW;
+
+        case SAI_API_LOCK_POLICY_NONE:
+            return STRING_SAI_API_LOCK_POLICY_NONE;
+
+        default:
+
+            SWSS_LOG_WARN("unknown api lock policy '%d'", policy);
+
+            return STRING_SAI_API_LOCK_POLICY_UNKNOWN;
+    }
+}
+
+std::string VendorSaiLock::apiClassToString(
+        _In_ sai_api_lock_class_t apiClass)
+{
+    SWSS_LOG_ENTER();
+
+    switch (apiClass)
+    {
+        case SAI_API_LOCK_CLASS_INIT:
+            return "init";
+
+        case SAI_API_LOCK_CLASS_MODIFY:
+            return "modify";
+
+        case SAI_API_LOCK_CLASS_READ:
+            return "read";
+
+        case SAI_API_LOCK_CLASS_STATS:
+            return "stats";
+
+        case SAI_API_LOCK_CLASS_CLEAR_STATS:
+            return "clear stats";
+
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+#define STRING_SAI_API_LOCK_POLICY_GLOBAL       "global"
+#define STRING_SAI_API_LOCK_POLICY_STATS        "stats"
+#define STRING_SAI_API_LOCK_POLICY_RW           "rw"
+#define STRING_SAI_API_LOCK_POLICY_NONE         "none"
+#define STRING_SAI_API_LOCK_POLICY_UNKNOWN      "unknown"
+
+namespace syncd
+{
+    typedef enum _sai_api_lock_policy_t
+    {
+        /**
+         * @brief Single lock serializing all vendor SAI calls.
+         */
+        SAI_API_LOCK_POLICY_GLOBAL = 0,
+
+        /**
+         * @brief Stats APIs are serialized by separate lock, so counter
+         * polling is not blocking switch programming.
+         */
+        SAI_API_LOCK_POLICY_STATS = 1,
+
+        /**
+         * @brief Get, query and stats APIs take shared lock, APIs modifying
+         * switch state take exclusive lock.
+         */
+        SAI_API_LOCK_POLICY_RW = 2,
+
+        /**
+         * @brief No locking, for vendors declaring thread safe SAI. Calls
+         * are still counted in wait statistics, with zero wait time.
+         */
+        SAI_API_LOCK_POLICY_NONE = 3,
+
+        /**
+         * Set at last, just for error purpose.
+         */
+        SAI_API_LOCK_POLICY_UNKNOWN
+
+    } sai_api_lock_policy_t;
+
+    typedef enum _sai_api_lock_class_t
+    {
+        /**
+         * @brief Initialize, always exclusive to all other APIs regardless
+         * of the policy.
+         */
+        SAI_API_LOCK_CLASS_INIT = 0,
+
+        /**
+         * @brief Create, remove, set, bulk and other APIs modifying switch.
+         */
+        SAI_API_LOCK_CLASS_MODIFY,
+
+        /**
+         * @brief Get and query APIs.
+         */
+        SAI_API_LOCK_CLASS_READ,
+
+        /**
+         * @brief Get stats APIs.
+         */
+        SAI_API_LOCK_CLASS_STATS,
+
+        /**
+         * @brief Clear stats APIs.
+         */
+        SAI_API_LOCK_CLASS_CLEAR_STATS,
+
+        SAI_API_LOCK_CLASS_COUNT
+
+    } sai_api_lock_class_t;
+
+    /**
+     * @brief Vendor SAI API lock.
+     *
+     * Selects lock taken for given API class based on configured policy and
+     * measures time spent waiting for the lock per API class.
+     */
+    class VendorSaiLock
+    {
+        private:
+
+            VendorSaiLock(const VendorSaiLock&) = delete;
+            VendorSaiLock& operator=(const VendorSaiLock&) = delete;
+
+        public:
+
+            static constexpr uint64_t DEFAULT_LOG_INTERVAL = 100000;
+
+            /**
+             * @brief Holds locks acquired for single API call.
+             */
+            class Guard
+            {
+                private:
+
+                    Guard(const Guard&) = delete;
+                    Guard& operator=(const Guard&) = delete;
+
+                public:
+
+                    Guard() = default;
+
+                    Guard(Guard&&) = default;
+
+                public:
+
+                    /**
+                     * @brief Release all locks before guard goes out of
+                     * scope, like before vendor API which can block.
+                     */
+                    void unlock();
+
+                private:
+
+                    friend class VendorSaiLock;
+
+                    std::unique_lock<std::mutex> m_apiLock;
+
+                    std::unique_lock<std::mutex> m_statsLock;
+
+                    std::unique_lock<std::shared_timed_mutex> m_exclusiveLock;
+
+                    std::shared_lock<std::shared_timed_mutex> m_sharedLock;
+            };
+
+            typedef struct _WaitStatistics
+            {
+                uint64_t calls;
+
+                uint64_t totalWaitNs;
+
+                uint64_t maxWaitNs;
+
+            } WaitStatistics;
+
+        public:
+
+            VendorSaiLock(
+                    _In_ sai_api_lock_policy_t policy,
+                    _In_ uint64_t logInterval = DEFAULT_LOG_INTERVAL);
+
+            virtual ~VendorSaiLock() = default;
+
+        public:
+
+            Guard lock(
+                    _In_ sai_api_lock_class_t apiClass);
+
+            sai_api_lock_policy_t getPolicy() const;
+
+            WaitStatistics getWaitStatistics(
+                    _In_ sai_api_lock_class_t apiClass) const;
+
+        public:
+
+            static sai_api_lock_policy_t policyStringToPolicy(
+                    _In_ const std::string& policy);
+
+            static std::string policyToString(
+                    _In_ sai_api_lock_policy_t policy);
+
+            static std::string apiClassToString(
+                    _In_ sai_api_lock_class_t apiClass);
+
+        private:
+
+            void recordWait(
+                    _In_ sai_api_lock_class_t apiClass,
+                    _In_ uint64_t waitNs);
+
+        private:
+
+            sai_api_lock_policy_t m_policy;
+
+            uint64_t m_logInterval;
+
+            std::mutex m_apiMutex;
+
+            std::mutex m_statsMutex;
+
+            std::shared_timed_mutex m_rwMutex;
+
+            std::atomic<uint64_t> m_calls[SAI_API_LOCK_CLASS_COUNT];
+
+            std::atomic<uint64_t> m_totalWaitNs[SAI_API_LOCK_CLASS_COUNT];
+
+            std::atomic<uint64_t> m_maxWaitNs[SAI_API_LOCK_CLASS_COUNT];
+    };
+}
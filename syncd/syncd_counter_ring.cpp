@@ -0,0 +1,185 @@
+#include "CounterRingReader.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include <iostream>
+
+using namespace syncd;
+
+struct CmdOptions
+{
+    std::string group;
+
+    std::string objectId;
+
+    std::string statName;
+
+    uint32_t samples;
+
+    uint32_t watchInterval;
+};
+
+void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: syncd_counter_ring -g group [-o oid] [-s stat] [-n samples] [-w interval] [-h]" << std::endl;
+    std::cout << "    -g --group" << std::endl;
+    std::cout << "        Flex counter group with counter ring enabled" << std::endl;
+    std::cout << "    -o --oid" << std::endl;
+    std::cout << "        Print only series of given object, e.g. oid:0x1000000000001" << std::endl;
+    std::cout << "    -s --stat" << std::endl;
+    std::cout << "        Print only series of given stat, e.g. SAI_PORT_STAT_IF_IN_OCTETS" << std::endl;
+    std::cout << "    -n --samples" << std::endl;
+    std::cout << "        Number of newest samples printed per series, 0 prints all, default 1" << std::endl;
+    std::cout << "    -w --watch" << std::endl;
+    std::cout << "        Print samples again every interval milliseconds" << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
+CmdOptions handleCmdLine(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    CmdOptions options;
+
+    options.samples = 1;
+    options.watchInterval = 0;
+
+    const char* const optstring = "g:o:s:n:w:h";
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "group",          required_argument, 0, 'g' },
+            { "oid",            required_argument, 0, 'o' },
+            { "stat",           required_argument, 0, 's' },
+            { "samples",        required_argument, 0, 'n' },
+            { "watch",          required_argument, 0, 'w' },
+            { "help",           no_argument,       0, 'h' },
+            { 0,                0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'g':
+                options.group = optarg;
+                break;
+
+            case 'o':
+                options.objectId = optarg;
+                break;
+
+            case 's':
+                options.statName = optarg;
+                break;
+
+            case 'n':
+                options.samples = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'w':
+                options.watchInterval = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            case '?':
+                SWSS_LOG_WARN("unknown option %c", optopt);
+                printUsage();
+                exit(EXIT_FAILURE);
+
+            default:
+                SWSS_LOG_ERROR("getopt_long failure");
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (options.group.empty())
+    {
+        std::cerr << "group must be specified" << std::endl;
+        printUsage();
+        exit(EXIT_FAILURE);
+    }
+
+    return options;
+}
+
+void printSamples(
+        _In_ const CounterRingReader& reader,
+        _In_ const CmdOptions& options)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& series: reader.readAll(options.samples))
+    {
+        auto oid = sai_serialize_object_id(series.objectId);
+
+        if (options.objectId.size() && options.objectId != oid)
+        {
+            continue;
+        }
+
+        if (options.statName.size() && options.statName != series.statName)
+        {
+            continue;
+        }
+
+        for (auto& sample: series.samples)
+        {
+            std::cout << oid << " " << series.statName << " " << sample.timestamp << " " << sample.value << std::endl;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    auto options = handleCmdLine(argc, argv);
+
+    try
+    {
+        CounterRingReader reader(options.group);
+
+        while (true)
+        {
+            printSamples(reader, options);
+
+            if (options.watchInterval == 0)
+            {
+                break;
+            }
+
+            usleep(options.watchInterval * 1000);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -64,7 +64,7 @@ int syncd_main(int argc, char **argv)
 
 #endif // SAITHRIFT
 
-    auto vendorSai = std::make_shared<VendorSai>();
+    auto vendorSai = std::make_shared<VendorSai>(commandLineOptions->m_apiLockPolicy);
 
     auto syncd = std::make_shared<Syncd>(vendorSai, commandLineOptions, isWarmStart);
 
@@ -0,0 +1,43 @@
+#include "LatencyHistogram.h"
+
+#include <gtest/gtest.h>
+
+using namespace sairediscommon;
+
+TEST(LatencyHistogram, getBucket)
+{
+    EXPECT_EQ(LatencyHistogram::getBucket(0), 0);
+    EXPECT_EQ(LatencyHistogram::getBucket(1), 1);
+    EXPECT_EQ(LatencyHistogram::getBucket(3), 2);
+    EXPECT_EQ(LatencyHistogram::getBucket(4), 3);
+    EXPECT_EQ(LatencyHistogram::getBucket(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+TEST(LatencyHistogram, record)
+{
+    LatencyHistogram h;
+
+    EXPECT_EQ(h.getPercentile(50), 0);
+
+    for (uint64_t i = 0; i < 98; i++)
+    {
+        h.record(3);
+    }
+
+    h.record(100);
+    h.record(1000);
+
+    EXPECT_EQ(h.getCount(), 100);
+    EXPECT_EQ(h.getMax(), 1000);
+    EXPECT_EQ(h.getAverage(), (98 * 3 + 1100) / 100);
+    EXPECT_EQ(h.getPercentile(50), 4);
+    EXPECT_EQ(h.getPercentile(99), 128);
+    EXPECT_EQ(h.getPercentile(100), 1000);
+
+    EXPECT_EQ(h.toString(), "count 100 avg 13 p50 4 p99 128 max 1000");
+
+    h.reset();
+
+    EXPECT_EQ(h.getCount(), 0);
+    EXPECT_EQ(h.getMax(), 0);
+}
@@ -1681,7 +1681,7 @@ TEST(Meta, populate)
 TEST(Meta, bulkGetClearStats)
 {
     Meta m(std::make_shared<MetaTestSaiInterface>());
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkGetStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(SAI_NULL_OBJECT_ID,
                                                          SAI_OBJECT_TYPE_PORT,
                                                          0,
                                                          nullptr,
@@ -1690,7 +1690,7 @@ TEST(Meta, bulkGetClearStats)
                                                          SAI_STATS_MODE_BULK_READ,
                                                          nullptr,
                                                          nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkClearStats(SAI_NULL_OBJECT_ID,
                                                            SAI_OBJECT_TYPE_PORT,
                                                            0,
                                                            nullptr,
@@ -66,3 +66,28 @@ TEST(NotificationFdbEvent, processMetadata)
 
     n.processMetadata(meta);
 }
+
+TEST(NotificationFdbEvent, ctrData)
+{
+    uint32_t count;
+    sai_fdb_event_notification_data_t* data = nullptr;
+
+    sai_deserialize_fdb_event_ntf(s, count, &data);
+
+    NotificationFdbEvent n(count, data);
+
+    // data is deep copied, source can be released
+
+    sai_deserialize_free_fdb_event_ntf(count, data);
+
+    EXPECT_EQ(n.getCount(), 1);
+    EXPECT_EQ(n.getSwitchId(), 0x21000000000000);
+    EXPECT_EQ(n.getSerializedNotification(), s);
+
+    // serialized notification reflects modified data
+
+    n.getData()[0].fdb_entry.switch_id = 0x2100000000;
+
+    EXPECT_NE(n.serialize(), s);
+    EXPECT_EQ(n.getSerializedNotification(), s);
+}
@@ -69,3 +69,12 @@ TEST(NotificationSwitchStateChange, executeCallback)
 
     n.executeCallback(ntfs);
 }
+
+TEST(NotificationSwitchStateChange, ctrData)
+{
+    NotificationSwitchStateChange n(0x2100000000, SAI_SWITCH_OPER_STATUS_UP);
+
+    EXPECT_EQ(n.getSwitchId(), 0x2100000000);
+    EXPECT_EQ(n.getSwitchOperStatus(), SAI_SWITCH_OPER_STATUS_UP);
+    EXPECT_EQ(n.getSerializedNotification(), sai_serialize_switch_oper_status(0x2100000000, SAI_SWITCH_OPER_STATUS_UP));
+}
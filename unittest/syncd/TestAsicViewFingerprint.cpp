@@ -0,0 +1,82 @@
+#include "AsicViewFingerprint.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+#define SWITCH_VID (0x21000000000000)
+#define SWITCH_RID (0x21000000000001)
+
+static swss::TableDump createDump(
+        _In_ const std::string& vrVid,
+        _In_ const std::string& adminV4State)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"]["SAI_SWITCH_ATTR_SRC_MAC_ADDRESS"] = "00:01:02:03:04:05";
+    dump["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:" + vrVid]["SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE"] = adminV4State;
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/24\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"" + vrVid + "\"}"]
+        ["SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"] = "SAI_PACKET_ACTION_DROP";
+
+    return dump;
+}
+
+TEST(AsicViewFingerprint, equalView)
+{
+    AsicView current(createDump("oid:0x3000000000001", "true"));
+
+    // virtual router was created again with new VID
+
+    AsicView temp(createDump("oid:0x3000000000002", "true"));
+
+    AsicView::ObjectIdMap matchedVidToRid = {{ SWITCH_VID, SWITCH_RID }};
+
+    AsicViewFingerprint cfp(current, matchedVidToRid);
+    AsicViewFingerprint tfp(temp, matchedVidToRid);
+
+    for (auto ot: { SAI_OBJECT_TYPE_SWITCH, SAI_OBJECT_TYPE_VIRTUAL_ROUTER, SAI_OBJECT_TYPE_ROUTE_ENTRY })
+    {
+        auto cf = cfp.getTypeFingerprint(ot);
+        auto tf = tfp.getTypeFingerprint(ot);
+
+        EXPECT_EQ(cf.count, 1);
+        EXPECT_TRUE(cf == tf);
+        EXPECT_TRUE(cf.resolved);
+        EXPECT_TRUE(tf.resolved);
+    }
+
+    EXPECT_EQ(cfp.getReferencedObjectTypes(SAI_OBJECT_TYPE_ROUTE_ENTRY).count(SAI_OBJECT_TYPE_VIRTUAL_ROUTER), 1);
+}
+
+TEST(AsicViewFingerprint, changedView)
+{
+    AsicView current(createDump("oid:0x3000000000001", "true"));
+    AsicView temp(createDump("oid:0x3000000000001", "false"));
+
+    AsicView::ObjectIdMap matchedVidToRid = {{ SWITCH_VID, SWITCH_RID }};
+
+    AsicViewFingerprint cfp(current, matchedVidToRid);
+    AsicViewFingerprint tfp(temp, matchedVidToRid);
+
+    EXPECT_TRUE(cfp.getTypeFingerprint(SAI_OBJECT_TYPE_SWITCH) == tfp.getTypeFingerprint(SAI_OBJECT_TYPE_SWITCH));
+
+    EXPECT_FALSE(cfp.getTypeFingerprint(SAI_OBJECT_TYPE_VIRTUAL_ROUTER) == tfp.getTypeFingerprint(SAI_OBJECT_TYPE_VIRTUAL_ROUTER));
+
+    // route is not changed, but it references changed virtual router
+
+    EXPECT_FALSE(cfp.getTypeFingerprint(SAI_OBJECT_TYPE_ROUTE_ENTRY) == tfp.getTypeFingerprint(SAI_OBJECT_TYPE_ROUTE_ENTRY));
+
+    // matched virtual router is compared by RID
+
+    matchedVidToRid[0x3000000000001] = 0x3000000000101;
+
+    AsicViewFingerprint cmfp(current, matchedVidToRid);
+    AsicViewFingerprint tmfp(temp, matchedVidToRid);
+
+    EXPECT_FALSE(cmfp.getTypeFingerprint(SAI_OBJECT_TYPE_VIRTUAL_ROUTER) == tmfp.getTypeFingerprint(SAI_OBJECT_TYPE_VIRTUAL_ROUTER));
+    EXPECT_TRUE(cmfp.getTypeFingerprint(SAI_OBJECT_TYPE_ROUTE_ENTRY) == tmfp.getTypeFingerprint(SAI_OBJECT_TYPE_ROUTE_ENTRY));
+}
@@ -4,10 +4,12 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 
+#include <getopt.h>
+
 using namespace syncd;
 
 const std::string expected_usage =
-R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-h]
+R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-L policy] [-P threads] [-k file] [-H sku] [-T] [-N size] [-D window] [-V] [-h]
     -d --diag
         Enable diagnostic shell
     -p --profile profile
@@ -36,6 +38,22 @@ R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [
         Comparison logic 'break before make' configuration file
     -w --watchdogWarnTimeSpan
         Watchdog time span (in microseconds) to watch for execution
+    -L --apiLockPolicy policy
+        Vendor SAI api lock policy (global|stats|rw|none), default: global
+    -P --eventPipelineThreads threads
+        Number of threads decoding events ahead of execution, 0 disables pipeline, default: 0
+    -k --supportedCountersCache file
+        File caching supported counters across restarts, default: disabled
+    -H --hwSku sku
+        HW SKU, part of supported counters cache key
+    -T --enableNotificationTrace
+        Trace latency of notifications, published to STATE_DB
+    -N --notificationRingSize size
+        Size (in KiB) of shared memory notification ring for local subscribers, 0 disables ring, default: 0
+    -D --fdbEventDedupWindow window
+        Suppress repeated FDB events within window (in milliseconds), 0 disables suppression, default: 0
+    -V --disableViewFingerprints
+        Disable skipping of identical object types in comparison logic
     -h --help
         Print out this message
 )";
@@ -49,7 +67,9 @@ TEST(CommandLineOptions, getCommandLineString)
     EXPECT_EQ(str, " EnableDiagShell=NO EnableTempView=NO DisableExitSleep=NO EnableUnittests=NO"
             " EnableConsistencyCheck=NO EnableSyncMode=NO RedisCommunicationMode=redis_async"
             " EnableSaiBulkSuport=NO StartType=cold ProfileMapFile= GlobalContext=0 ContextConfig= BreakConfig="
-            " WatchdogWarnTimeSpan=30000000");
+            " WatchdogWarnTimeSpan=30000000 ApiLockPolicy=global EventPipelineThreads=0 SupportedCountersCache= HwSku="
+            " EnableNotificationTrace=NO NotificationRingSize=0 FdbEventDedupWindow=0"
+            " DisableViewFingerprints=NO");
 }
 
 TEST(CommandLineOptions, startTypeStringToStartType)
@@ -79,4 +99,17 @@ TEST(CommandLineOptionsParser, parseCommandLine)
 
     auto opt = syncd::CommandLineOptionsParser::parseCommandLine((int)args.size(), args.data());
     EXPECT_EQ(opt->m_watchdogWarnTimeSpan, 1000);
+    EXPECT_FALSE(opt->m_disableViewFingerprints);
+}
+
+TEST(CommandLineOptionsParser, disableViewFingerprints)
+{
+    char arg1[] = "test";
+    char arg2[] = "--disableViewFingerprints";
+    std::vector<char *> args = {arg1, arg2};
+
+    optind = 0;
+
+    auto opt = syncd::CommandLineOptionsParser::parseCommandLine((int)args.size(), args.data());
+    EXPECT_TRUE(opt->m_disableViewFingerprints);
 }
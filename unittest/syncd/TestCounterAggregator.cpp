@@ -0,0 +1,90 @@
+#include "CounterAggregator.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+static uint64_t aggregate(
+        _In_ CounterAggregator::Function function,
+        _In_ const std::vector<uint64_t>& samples)
+{
+    SWSS_LOG_ENTER();
+
+    CounterAggregator aggregator(function, 1000);
+
+    sai_stat_id_t id = 1;
+
+    for (auto value: samples)
+    {
+        aggregator.update(0x100, 1, &id, &value);
+    }
+
+    auto& window = aggregator.getWindows().at(0x100);
+
+    EXPECT_EQ(window.samples, samples.size());
+
+    return window.values.at(0);
+}
+
+TEST(CounterAggregator, parseFunction)
+{
+    CounterAggregator::Function function;
+
+    EXPECT_TRUE(CounterAggregator::parseFunction("max", function));
+    EXPECT_EQ(function, CounterAggregator::FUNCTION_MAX);
+
+    EXPECT_TRUE(CounterAggregator::parseFunction("last", function));
+    EXPECT_EQ(function, CounterAggregator::FUNCTION_LAST);
+
+    EXPECT_FALSE(CounterAggregator::parseFunction("avg", function));
+}
+
+TEST(CounterAggregator, functions)
+{
+    std::vector<uint64_t> samples = { 5, 9, 2, 4 };
+
+    EXPECT_EQ(aggregate(CounterAggregator::FUNCTION_MAX, samples), 9);
+    EXPECT_EQ(aggregate(CounterAggregator::FUNCTION_MIN, samples), 2);
+    EXPECT_EQ(aggregate(CounterAggregator::FUNCTION_SUM, samples), 20);
+    EXPECT_EQ(aggregate(CounterAggregator::FUNCTION_LAST, samples), 4);
+}
+
+TEST(CounterAggregator, window)
+{
+    CounterAggregator aggregator(CounterAggregator::FUNCTION_MAX, 1000);
+
+    sai_stat_id_t ids[] = { 1, 2 };
+    uint64_t values[] = { 10, 20 };
+
+    aggregator.update(0x100, 2, ids, values);
+
+    auto now = std::chrono::steady_clock::now();
+
+    EXPECT_FALSE(aggregator.isWindowComplete(now));
+    EXPECT_TRUE(aggregator.isWindowComplete(now + std::chrono::milliseconds(1000)));
+
+    aggregator.startWindow(now + std::chrono::milliseconds(1000));
+
+    EXPECT_EQ(aggregator.getWindows().at(0x100).samples, 0);
+
+    // first sample of window replaces previous window values
+
+    values[0] = 1;
+
+    aggregator.update(0x100, 2, ids, values);
+
+    EXPECT_EQ(aggregator.getWindows().at(0x100).values[0], 1);
+
+    // changed stats restart window of object
+
+    aggregator.update(0x100, 1, ids + 1, values);
+
+    EXPECT_EQ(aggregator.getWindows().at(0x100).values.size(), 1);
+    EXPECT_EQ(aggregator.getWindows().at(0x100).samples, 1);
+
+    aggregator.removeObject(0x100);
+
+    EXPECT_TRUE(aggregator.getWindows().empty());
+}
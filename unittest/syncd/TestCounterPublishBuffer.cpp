@@ -0,0 +1,165 @@
+#include "CounterPublishBuffer.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+using namespace syncd;
+
+static std::string statName(
+        _In_ sai_stat_id_t statId)
+{
+    SWSS_LOG_ENTER();
+
+    return "SAI_PORT_STAT_" + std::to_string(statId);
+}
+
+TEST(CounterPublishBuffer, formatValue)
+{
+    std::string str;
+
+    std::vector<uint64_t> values = { 0, 7, 10, 99, 100, 12345, 1000000007, UINT64_MAX - 1, UINT64_MAX };
+
+    for (auto value: values)
+    {
+        CounterPublishBuffer::formatValue(value, str);
+
+        EXPECT_EQ(str, std::to_string(value));
+    }
+}
+
+TEST(CounterPublishBuffer, addAndClear)
+{
+    int calls = 0;
+
+    CounterPublishBuffer buffer([&](sai_stat_id_t statId) { calls++; return statName(statId); });
+
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.add(1, 10);
+    buffer.add(2, 20);
+
+    auto& values = buffer.getValues();
+
+    ASSERT_EQ(buffer.getCount(), 2);
+    EXPECT_EQ(values[0].first, "SAI_PORT_STAT_1");
+    EXPECT_EQ(values[0].second, "10");
+    EXPECT_EQ(values[1].first, "SAI_PORT_STAT_2");
+    EXPECT_EQ(values[1].second, "20");
+
+    // names are serialized only once
+
+    buffer.clear();
+
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.add(2, 200);
+
+    ASSERT_EQ(buffer.getCount(), 1);
+    EXPECT_EQ(values[0].first, "SAI_PORT_STAT_2");
+    EXPECT_EQ(values[0].second, "200");
+    EXPECT_EQ(calls, 2);
+
+    // values storage is not shrunk
+
+    EXPECT_EQ(values.size(), 2);
+    EXPECT_EQ(values[1].second, "20");
+}
+
+TEST(CounterPublishBuffer, publish)
+{
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::RedisPipeline pipeline(&db);
+    swss::Table table(&pipeline, "COUNTERS_PUBLISH_BUFFER_TEST", false);
+
+    CounterPublishBuffer buffer(statName);
+
+    buffer.add(1, 10);
+    buffer.add(2, 20);
+
+    buffer.publish(table, "oid:0x1");
+
+    buffer.clear();
+
+    buffer.add(1, 100);
+
+    buffer.publish(table, "oid:0x2");
+
+    std::vector<swss::FieldValueTuple> values;
+
+    ASSERT_TRUE(table.get("oid:0x2", values));
+    ASSERT_EQ(values.size(), 1);
+    EXPECT_EQ(values[0].second, "100");
+
+    ASSERT_TRUE(table.get("oid:0x1", values));
+    EXPECT_EQ(values.size(), 2);
+
+    // published values are kept in buffer
+
+    EXPECT_EQ(buffer.getValues().size(), 2);
+    EXPECT_EQ(buffer.getValues()[0].second, "100");
+
+    table.del("oid:0x1");
+    table.del("oid:0x2");
+}
+
+TEST(CounterPublishBuffer, benchmark)
+{
+    // 10k objects with 100 stats each, compared to building new values
+    // vector for each object
+
+    size_t objects = 10000;
+    size_t stats = 100;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        objects = 10;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    CounterPublishBuffer buffer(statName);
+
+    size_t total = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < objects; i++)
+    {
+        buffer.clear();
+
+        for (size_t j = 0; j < stats; j++)
+        {
+            buffer.add(static_cast<sai_stat_id_t>(j), i * j);
+        }
+
+        total += buffer.getCount();
+    }
+
+    auto buffered = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < objects; i++)
+    {
+        std::vector<swss::FieldValueTuple> values;
+
+        for (size_t j = 0; j < stats; j++)
+        {
+            values.emplace_back(statName(static_cast<sai_stat_id_t>(j)), std::to_string(i * j));
+        }
+
+        total += values.size();
+    }
+
+    auto allocated = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(total, 2 * objects * stats);
+
+    std::cout << "buffered ms: " << (double)std::chrono::duration_cast<std::chrono::microseconds>(buffered).count() / 1000
+        << ", allocated ms: " << (double)std::chrono::duration_cast<std::chrono::microseconds>(allocated).count() / 1000
+        << " / " << objects << "/" << stats << std::endl;
+}
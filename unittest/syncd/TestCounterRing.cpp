@@ -0,0 +1,101 @@
+#include "CounterRingWriter.h"
+#include "CounterRingReader.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+static std::string statName(
+        _In_ sai_stat_id_t statId)
+{
+    SWSS_LOG_ENTER();
+
+    return "STAT_" + std::to_string(statId);
+}
+
+TEST(CounterRing, getShmName)
+{
+    EXPECT_EQ(CounterRing::getShmName("PORT_STAT_COUNTER"), "/sairedis_counter_ring_PORT_STAT_COUNTER");
+    EXPECT_EQ(CounterRing::getShmName("a/b:c"), "/sairedis_counter_ring_a_b_c");
+}
+
+TEST(CounterRing, readerWithoutRing)
+{
+    EXPECT_THROW(CounterRingReader("TEST_COUNTER_RING_MISSING"), std::runtime_error);
+}
+
+TEST(CounterRing, appendAndRead)
+{
+    EXPECT_THROW(CounterRingWriter("TEST_COUNTER_RING", 0, 4), std::runtime_error);
+
+    CounterRingWriter writer("TEST_COUNTER_RING", 3, 4);
+
+    CounterRingReader reader("TEST_COUNTER_RING");
+
+    EXPECT_EQ(reader.getCapacity(), 3);
+    EXPECT_EQ(reader.getSeriesCount(), 0);
+
+    sai_stat_id_t ids[] = { 1, 2 };
+
+    for (uint64_t i = 0; i < 5; i++)
+    {
+        uint64_t values[] = { i, i * 10 };
+
+        writer.append(0x100, 2, ids, values, statName);
+    }
+
+    auto all = reader.readAll(0);
+
+    ASSERT_EQ(all.size(), 2);
+
+    EXPECT_EQ(all[0].objectId, 0x100);
+    EXPECT_EQ(all[0].statName, "STAT_1");
+    EXPECT_EQ(all[1].statName, "STAT_2");
+
+    // ring keeps newest samples, oldest first
+
+    ASSERT_EQ(all[1].samples.size(), 3);
+    EXPECT_EQ(all[1].samples[0].value, 20);
+    EXPECT_EQ(all[1].samples[2].value, 40);
+    EXPECT_LE(all[1].samples[0].timestamp, all[1].samples[2].timestamp);
+
+    auto newest = reader.readAll(1);
+
+    ASSERT_EQ(newest[0].samples.size(), 1);
+    EXPECT_EQ(newest[0].samples[0].value, 4);
+}
+
+TEST(CounterRing, removeObject)
+{
+    CounterRingWriter writer("TEST_COUNTER_RING", 2, 2);
+
+    CounterRingReader reader("TEST_COUNTER_RING");
+
+    sai_stat_id_t ids[] = { 1, 2 };
+    uint64_t values[] = { 7, 8 };
+
+    writer.append(0x100, 2, ids, values, statName);
+
+    // ring is full, series of second object are not recorded
+
+    writer.append(0x200, 1, ids, values, statName);
+
+    EXPECT_EQ(reader.readAll(0).size(), 2);
+
+    writer.removeObject(0x100);
+
+    EXPECT_EQ(reader.readAll(0).size(), 0);
+
+    // freed series are reused
+
+    writer.append(0x200, 1, ids, values, statName);
+
+    auto all = reader.readAll(0);
+
+    ASSERT_EQ(all.size(), 1);
+    EXPECT_EQ(all[0].objectId, 0x200);
+    EXPECT_EQ(all[0].samples.size(), 1);
+    EXPECT_EQ(reader.getSeriesCount(), 2);
+}
@@ -0,0 +1,93 @@
+#include "EventDecoder.h"
+
+#include "sairediscommon.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+TEST(EventDecoder, ctor)
+{
+    EXPECT_THROW(EventDecoder(0), std::runtime_error);
+    EXPECT_THROW(EventDecoder(1, 0), std::runtime_error);
+}
+
+TEST(EventDecoder, decodeQuad)
+{
+    EventDecoder decoder(2);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+    values.emplace_back("SAI_PORT_ATTR_MTU", "9100");
+
+    swss::KeyOpFieldsValuesTuple kco("SAI_OBJECT_TYPE_PORT:oid:0x1000000000001", REDIS_ASIC_STATE_COMMAND_SET, values);
+
+    auto event = std::make_shared<DecodedEvent>(kco);
+
+    decoder.decode(event);
+    decoder.wait(*event);
+
+    EXPECT_EQ(event->m_api, SAI_COMMON_API_SET);
+    EXPECT_EQ(event->m_metaKey.objecttype, SAI_OBJECT_TYPE_PORT);
+    EXPECT_EQ(event->m_metaKey.objectkey.key.object_id, 0x1000000000001);
+    EXPECT_EQ(event->m_list->get_attr_count(), 2);
+    EXPECT_EQ(event->m_list->get_attr_list()[1].value.u32, 9100);
+}
+
+TEST(EventDecoder, decodeBulk)
+{
+    EventDecoder decoder(4, 3);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    for (int idx = 1; idx <= 10; idx++)
+    {
+        values.emplace_back("oid:0x" + std::to_string(idx), "SAI_PORT_ATTR_ADMIN_STATE=true|SAI_PORT_ATTR_MTU=" + std::to_string(idx));
+    }
+
+    swss::KeyOpFieldsValuesTuple kco("SAI_OBJECT_TYPE_PORT:10", REDIS_ASIC_STATE_COMMAND_BULK_SET, values);
+
+    auto event = std::make_shared<DecodedEvent>(kco);
+
+    decoder.decode(event);
+    decoder.wait(*event);
+
+    EXPECT_EQ(event->m_api, SAI_COMMON_API_BULK_SET);
+    EXPECT_EQ(event->m_objectType, SAI_OBJECT_TYPE_PORT);
+    ASSERT_EQ(event->m_attributes.size(), 10);
+
+    for (int idx = 0; idx < 10; idx++)
+    {
+        EXPECT_EQ(event->m_objectIds[idx], "oid:0x" + std::to_string(idx + 1));
+        EXPECT_EQ(event->m_strAttributes[idx].size(), 2);
+        EXPECT_EQ(event->m_attributes[idx]->get_attr_list()[1].value.u32, idx + 1);
+    }
+}
+
+TEST(EventDecoder, notDecoded)
+{
+    EventDecoder decoder(1);
+
+    swss::KeyOpFieldsValuesTuple kco("SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000", REDIS_ASIC_STATE_COMMAND_GET_STATS, {});
+
+    auto event = std::make_shared<DecodedEvent>(kco);
+
+    decoder.decode(event);
+    decoder.wait(*event);
+
+    EXPECT_EQ(event->m_api, SAI_COMMON_API_MAX);
+}
+
+TEST(EventDecoder, errorRethrownOnWait)
+{
+    EventDecoder decoder(1);
+
+    swss::KeyOpFieldsValuesTuple kco("SAI_OBJECT_TYPE_PORT:oid:0x1", REDIS_ASIC_STATE_COMMAND_SET, {{"SAI_PORT_ATTR_FOO", "true"}});
+
+    auto event = std::make_shared<DecodedEvent>(kco);
+
+    decoder.decode(event);
+
+    EXPECT_ANY_THROW(decoder.wait(*event));
+}
@@ -0,0 +1,119 @@
+#include "FdbEventFilter.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+typedef struct _TestFdbEvent
+{
+    sai_attribute_t attrs[2];
+
+    sai_fdb_event_notification_data_t data;
+
+} TestFdbEvent;
+
+static void makeEvent(
+        _Out_ TestFdbEvent& event,
+        _In_ sai_fdb_event_t type,
+        _In_ uint8_t mac,
+        _In_ sai_object_id_t bridgePortId)
+{
+    SWSS_LOG_ENTER();
+
+    memset(&event, 0, sizeof(event));
+
+    event.attrs[0].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+    event.attrs[0].value.oid = bridgePortId;
+
+    event.attrs[1].id = SAI_FDB_ENTRY_ATTR_TYPE;
+    event.attrs[1].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+
+    event.data.event_type = type;
+    event.data.fdb_entry.switch_id = 0x21000000000000;
+    event.data.fdb_entry.bv_id = 0x26000000000001;
+    event.data.fdb_entry.mac_address[5] = mac;
+    event.data.attr_count = 2;
+    event.data.attr = event.attrs;
+}
+
+TEST(FdbEventFilter, suppress)
+{
+    FdbEventFilter filter(60000, nullptr, 16);
+
+    TestFdbEvent learned;
+    TestFdbEvent moved;
+    TestFdbEvent aged;
+    TestFdbEvent other;
+
+    makeEvent(learned, SAI_FDB_EVENT_LEARNED, 1, 0x3a000000000001);
+    makeEvent(moved, SAI_FDB_EVENT_LEARNED, 1, 0x3a000000000002);
+    makeEvent(aged, SAI_FDB_EVENT_AGED, 1, 0x3a000000000001);
+    makeEvent(other, SAI_FDB_EVENT_LEARNED, 2, 0x3a000000000001);
+
+    EXPECT_FALSE(filter.suppress(learned.data));
+    EXPECT_TRUE(filter.suppress(learned.data));
+
+    // other entry does not change last event of entry
+
+    EXPECT_FALSE(filter.suppress(other.data));
+    EXPECT_TRUE(filter.suppress(learned.data));
+
+    // entry learned on other port
+
+    EXPECT_FALSE(filter.suppress(moved.data));
+    EXPECT_FALSE(filter.suppress(learned.data));
+
+    // learned again after aged
+
+    EXPECT_FALSE(filter.suppress(aged.data));
+    EXPECT_FALSE(filter.suppress(learned.data));
+    EXPECT_TRUE(filter.suppress(learned.data));
+
+    EXPECT_EQ(filter.getPassedCount(), 6);
+    EXPECT_EQ(filter.getSuppressedCount(), 3);
+}
+
+TEST(FdbEventFilter, invalidate)
+{
+    FdbEventFilter filter(60000, nullptr);
+
+    TestFdbEvent learned;
+    TestFdbEvent flushed;
+
+    makeEvent(learned, SAI_FDB_EVENT_LEARNED, 1, 0x3a000000000001);
+    makeEvent(flushed, SAI_FDB_EVENT_FLUSHED, 0, 0x3a000000000001);
+
+    EXPECT_FALSE(filter.suppress(learned.data));
+
+    filter.invalidate();
+
+    EXPECT_FALSE(filter.suppress(learned.data));
+
+    // flushed events are never suppressed and invalidate filter
+
+    EXPECT_FALSE(filter.suppress(flushed.data));
+    EXPECT_FALSE(filter.suppress(flushed.data));
+
+    EXPECT_FALSE(filter.suppress(learned.data));
+    EXPECT_TRUE(filter.suppress(learned.data));
+
+    EXPECT_EQ(filter.getInvalidatedCount(), 3);
+
+    EXPECT_EQ(filter.dump(), "window 60000 ms passed 5 suppressed 1 invalidated 3");
+}
+
+TEST(FdbEventFilter, window)
+{
+    FdbEventFilter filter(0, nullptr);
+
+    TestFdbEvent learned;
+
+    makeEvent(learned, SAI_FDB_EVENT_LEARNED, 1, 0x3a000000000001);
+
+    EXPECT_FALSE(filter.suppress(learned.data));
+    EXPECT_FALSE(filter.suppress(learned.data));
+
+    EXPECT_EQ(filter.getWindow(), 0);
+}
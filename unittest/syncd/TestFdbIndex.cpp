@@ -0,0 +1,121 @@
+#include "FdbIndex.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace syncd;
+
+static std::string fdbKey(
+        _In_ sai_object_id_t bvId,
+        _In_ uint8_t mac)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_meta_key_t metaKey;
+
+    memset(&metaKey, 0, sizeof(metaKey));
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
+    metaKey.objectkey.key.fdb_entry.switch_id = 0x21000000000000;
+    metaKey.objectkey.key.fdb_entry.bv_id = bvId;
+    metaKey.objectkey.key.fdb_entry.mac_address[5] = mac;
+
+    return sai_serialize_object_meta_key(metaKey);
+}
+
+static void addEntry(
+        _In_ FdbIndex& index,
+        _In_ const std::string& key,
+        _In_ sai_object_id_t bridgePortId,
+        _In_ const std::string& type)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_FDB_ENTRY_ATTR_TYPE", type);
+    values.emplace_back("SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", sai_serialize_object_id(bridgePortId));
+
+    index.setEntry(key, values);
+}
+
+TEST(FdbIndex, setEntry)
+{
+    FdbIndex index;
+
+    index.setEntry("SAI_OBJECT_TYPE_PORT:oid:0x1000000000002", {});
+
+    EXPECT_EQ(index.size(), 0);
+
+    auto key = fdbKey(0x26000000000001, 1);
+
+    addEntry(index, key, 0x3a000000000001, "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+
+    auto entry = index.getEntry(key);
+
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->bvId, 0x26000000000001);
+    EXPECT_EQ(entry->bridgePortId, 0x3a000000000001);
+    EXPECT_EQ(entry->type, FdbIndex::ENTRY_TYPE_DYNAMIC);
+
+    // move to other port
+
+    index.setEntryAttribute(key, "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", "oid:0x3a000000000002");
+
+    EXPECT_EQ(index.getEntry(key)->bridgePortId, 0x3a000000000002);
+    EXPECT_TRUE(index.flush(0x3a000000000001, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_ALL).empty());
+
+    index.removeEntry(key);
+
+    EXPECT_EQ(index.size(), 0);
+}
+
+TEST(FdbIndex, flush)
+{
+    FdbIndex index;
+
+    auto k1 = fdbKey(0x26000000000001, 1);
+    auto k2 = fdbKey(0x26000000000001, 2);
+    auto k3 = fdbKey(0x26000000000002, 3);
+    auto k4 = fdbKey(0x26000000000002, 4);
+
+    addEntry(index, k1, 0x3a000000000001, "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+    addEntry(index, k2, 0x3a000000000002, "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+    addEntry(index, k3, 0x3a000000000001, "SAI_FDB_ENTRY_TYPE_STATIC");
+    addEntry(index, k4, 0x3a000000000001, "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+
+    // entry without type is never flushed
+
+    index.setEntry(fdbKey(0x26000000000002, 5), {});
+
+    auto keys = index.flush(0x3a000000000001, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC);
+
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<std::string> expected = { k1, k4 };
+
+    std::sort(expected.begin(), expected.end());
+
+    EXPECT_EQ(keys, expected);
+    EXPECT_EQ(index.size(), 3);
+
+    keys = index.flush(SAI_NULL_OBJECT_ID, 0x26000000000002, SAI_FDB_FLUSH_ENTRY_TYPE_ALL);
+
+    EXPECT_EQ(keys, std::vector<std::string>{ k3 });
+
+    keys = index.flush(SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_STATIC);
+
+    EXPECT_TRUE(keys.empty());
+
+    keys = index.flush(SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC);
+
+    EXPECT_EQ(keys, std::vector<std::string>{ k2 });
+    EXPECT_EQ(index.size(), 1);
+
+    EXPECT_THROW(index.flush(SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, (sai_fdb_flush_entry_type_t)100), std::exception);
+}
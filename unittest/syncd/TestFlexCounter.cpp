@@ -2,8 +2,13 @@
 #include "MockableSaiInterface.h"
 #include "MockHelper.h"
 
+#include "swss/redisapi.h"
+
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 
 using namespace syncd;
 using namespace std;
@@ -836,3 +841,582 @@ TEST(FlexCounter, counterIdChange)
     fc.removeCounter(oid1);
     countersTable.del(toOid(oid1));
 }
+
+TEST(FlexCounter, publishChangedOnly)
+{
+    static std::atomic<uint64_t> octets;
+
+    octets = 100;
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t, uint32_t number_of_counters, const sai_stat_id_t *ids, uint64_t *counters) {
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[i] = (ids[i] == SAI_PORT_STAT_IF_IN_OCTETS) ? octets.load() : 200;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+    sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+    sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_PORT);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(POLL_INTERVAL_FIELD, "1000");
+    values.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+    values.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
+    values.emplace_back(PUBLISH_MODE_FIELD, PUBLISH_MODE_CHANGED);
+    values.emplace_back(FULL_REFRESH_INTERVAL_FIELD, "0");
+    fc.addCounterPlugin(values);
+
+    sai_object_id_t oid{0x1000000000000};
+    values.clear();
+    values.emplace_back(PORT_COUNTER_ID_LIST, "SAI_PORT_STAT_IF_IN_OCTETS,SAI_PORT_STAT_IF_IN_ERRORS");
+    fc.addCounter(oid, oid, values);
+
+    usleep(1000*1050);
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::RedisPipeline pipeline(&db);
+    swss::Table countersTable(&pipeline, COUNTERS_TABLE, false);
+
+    std::string expectedKey = toOid(oid);
+    std::string value;
+    countersTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_OCTETS", value);
+    EXPECT_EQ(value, "100");
+    countersTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_ERRORS", value);
+    EXPECT_EQ(value, "200");
+
+    // unchanged counters are not written again
+
+    countersTable.del(expectedKey);
+    usleep(1000*1000);
+
+    std::vector<std::string> keys;
+    countersTable.getKeys(keys);
+    EXPECT_TRUE(keys.empty());
+
+    // only changed counter is written
+
+    octets = 150;
+    usleep(1000*1000);
+
+    countersTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_OCTETS", value);
+    EXPECT_EQ(value, "150");
+    EXPECT_FALSE(countersTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_ERRORS", value));
+
+    fc.removeCounter(oid);
+    countersTable.del(expectedKey);
+}
+
+TEST(FlexCounter, nativeRates)
+{
+    static std::atomic<uint64_t> octets;
+
+    octets = 0;
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t, uint32_t number_of_counters, const sai_stat_id_t *ids, uint64_t *counters) {
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[i] = (ids[i] == SAI_PORT_STAT_IF_IN_OCTETS) ? (octets += 1000) : 0;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+    sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+    sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::RedisPipeline pipeline(&db);
+    swss::Table countersTable(&pipeline, COUNTERS_TABLE, false);
+    swss::Table ratesTable(&pipeline, RATES_TABLE, false);
+
+    ratesTable.hset("PORT", "PORT_ALPHA", "0.5");
+
+    // only rates plugin is replaced by native engine
+
+    auto ratesSha = swss::loadRedisScript(&db,
+            "for _, key in ipairs(KEYS) do redis.call('HSET', 'RATES:' .. key, 'LUA_RATES', '1') end");
+    auto otherSha = swss::loadRedisScript(&db,
+            "for _, key in ipairs(KEYS) do redis.call('HSET', 'RATES:' .. key, 'LUA_OTHER', '1') end");
+
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_PORT);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(POLL_INTERVAL_FIELD, "1000");
+    values.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+    values.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
+    values.emplace_back(RATE_ENGINE_FIELD, RATE_ENGINE_NATIVE);
+    values.emplace_back(RATE_PLUGIN_FIELD, ratesSha);
+    values.emplace_back(PORT_PLUGIN_FIELD, ratesSha + "," + otherSha);
+    fc.addCounterPlugin(values);
+
+    sai_object_id_t oid{0x1000000000000};
+    values.clear();
+    values.emplace_back(PORT_COUNTER_ID_LIST, "SAI_PORT_STAT_IF_IN_OCTETS,SAI_PORT_STAT_IF_OUT_OCTETS");
+    fc.addCounter(oid, oid, values);
+
+    usleep(1000*2050);
+
+    std::string expectedKey = toOid(oid);
+    std::string value;
+
+    EXPECT_TRUE(ratesTable.hget(expectedKey + ":PORT", "INIT_DONE", value));
+    EXPECT_EQ(value, "DONE");
+
+    EXPECT_TRUE(ratesTable.hget(expectedKey, "RX_BPS", value));
+    EXPECT_GT(std::stod(value), 0);
+
+    EXPECT_TRUE(ratesTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_OCTETS_last", value));
+
+    // not polled stats have no rates
+    EXPECT_FALSE(ratesTable.hget(expectedKey, "RX_PPS", value));
+
+    EXPECT_FALSE(ratesTable.hget(expectedKey, "LUA_RATES", value));
+    EXPECT_TRUE(ratesTable.hget(expectedKey, "LUA_OTHER", value));
+
+    fc.removeCounter(oid);
+    fc.removeCounterPlugins();
+    countersTable.del(expectedKey);
+    ratesTable.del(expectedKey);
+    ratesTable.del(expectedKey + ":PORT");
+    ratesTable.del("PORT");
+}
+
+TEST(FlexCounter, addCounterDuringPoll)
+{
+    static std::thread::id mainThread;
+
+    mainThread = std::this_thread::get_id();
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t, uint32_t number_of_counters, const sai_stat_id_t *, uint64_t *counters) {
+        if (std::this_thread::get_id() != mainThread)
+        {
+            // slow poll
+            usleep(1000*300);
+        }
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[i] = 100;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+    sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+    sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_PORT);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(POLL_INTERVAL_FIELD, "1000");
+    values.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+    values.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
+    fc.addCounterPlugin(values);
+
+    sai_object_id_t oid1{0x1000000000001};
+    sai_object_id_t oid2{0x1000000000002};
+    values.clear();
+    values.emplace_back(PORT_COUNTER_ID_LIST, "SAI_PORT_STAT_IF_IN_OCTETS");
+    fc.addCounter(oid1, oid1, values);
+
+    // first poll is in progress now
+
+    usleep(1000*50);
+
+    auto start = std::chrono::steady_clock::now();
+
+    fc.addCounter(oid2, oid2, values);
+    fc.removeCounter(oid1);
+
+    // group configuration is staged as well
+
+    fc.addCounterPlugin({{STATS_MODE_FIELD, STATS_MODE_READ}, {POLL_INTERVAL_FIELD, "1000"}});
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_LT(elapsed, 200);
+    EXPECT_EQ(fc.isEmpty(), false);
+
+    // changes are applied on next poll
+
+    usleep(1000*1500);
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::RedisPipeline pipeline(&db);
+    swss::Table countersTable(&pipeline, COUNTERS_TABLE, false);
+
+    std::vector<std::string> keys;
+    countersTable.getKeys(keys);
+    ASSERT_EQ(keys.size(), size_t(1));
+    EXPECT_EQ(keys[0], toOid(oid2));
+
+    fc.removeCounter(oid2);
+    EXPECT_EQ(fc.isEmpty(), true);
+    countersTable.del(toOid(oid2));
+}
+
+TEST(FlexCounter, supportedCountersCache)
+{
+    static std::thread::id mainThread;
+    static int probes;
+
+    mainThread = std::this_thread::get_id();
+    probes = 0;
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t, uint32_t number_of_counters, const sai_stat_id_t *ids, uint64_t *counters) {
+        if (std::this_thread::get_id() == mainThread)
+        {
+            probes++;
+        }
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            if (ids[i] == SAI_TUNNEL_STAT_IN_PACKETS)
+            {
+                return SAI_STATUS_NOT_SUPPORTED;
+            }
+            counters[i] = 100;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+    sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+
+    const std::string file = "supported_counters_cache.json";
+
+    remove(file.c_str());
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_TUNNEL);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(TUNNEL_COUNTER_ID_LIST, "SAI_TUNNEL_STAT_IN_OCTETS,SAI_TUNNEL_STAT_IN_PACKETS");
+
+    sai_object_id_t oid{0x2a000000000001};
+
+    {
+        auto cache = std::make_shared<SupportedCountersCache>(file, "platform");
+
+        FlexCounter fc("test", sai, "COUNTERS_DB", nullptr, cache);
+
+        fc.addCounter(oid, oid, values);
+
+        EXPECT_EQ(probes, 2);
+        EXPECT_EQ(fc.isEmpty(), false);
+
+        fc.removeCounter(oid);
+    }
+
+    // next start takes supported counters from cache
+
+    probes = 0;
+
+    {
+        auto cache = std::make_shared<SupportedCountersCache>(file, "platform");
+
+        FlexCounter fc("test", sai, "COUNTERS_DB", nullptr, cache);
+
+        fc.addCounter(oid, oid, values);
+
+        EXPECT_EQ(probes, 0);
+        EXPECT_EQ(fc.isEmpty(), false);
+
+        fc.removeCounter(oid);
+    }
+
+    // cache written by different platform is ignored
+
+    {
+        auto cache = std::make_shared<SupportedCountersCache>(file, "other platform");
+
+        FlexCounter fc("test", sai, "COUNTERS_DB", nullptr, cache);
+
+        fc.addCounter(oid, oid, values);
+
+        EXPECT_EQ(probes, 2);
+
+        fc.removeCounter(oid);
+    }
+
+    remove(file.c_str());
+}
+
+TEST(FlexCounter, supportedCountersCachePerObject)
+{
+    static std::thread::id mainThread;
+    static int probes;
+
+    mainThread = std::this_thread::get_id();
+    probes = 0;
+
+    sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *) {
+        return SAI_STATUS_NOT_SUPPORTED;
+    };
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t oid, uint32_t number_of_counters, const sai_stat_id_t *ids, uint64_t *counters) {
+        if (std::this_thread::get_id() == mainThread)
+        {
+            probes++;
+        }
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            // second port does not support errors counter
+            if (oid == 0x1000000000002 && ids[i] == SAI_PORT_STAT_IF_IN_ERRORS)
+            {
+                return SAI_STATUS_NOT_SUPPORTED;
+            }
+            counters[i] = 100;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+    sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+
+    const std::string file = "supported_counters_cache.json";
+
+    remove(file.c_str());
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_PORT);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(PORT_COUNTER_ID_LIST, "SAI_PORT_STAT_IF_IN_OCTETS,SAI_PORT_STAT_IF_IN_ERRORS");
+
+    sai_object_id_t oid1{0x1000000000001};
+    sai_object_id_t oid2{0x1000000000002};
+
+    {
+        auto cache = std::make_shared<SupportedCountersCache>(file, "platform");
+
+        FlexCounter fc("test", sai, "COUNTERS_DB", nullptr, cache);
+
+        fc.addCounter(oid1, oid1, values);
+        fc.addCounter(oid2, oid2, values);
+
+        // port support is checked per object
+
+        EXPECT_EQ(probes, 4);
+
+        // counters are not removed on shutdown
+    }
+
+    // next warm start skips probe of each port
+
+    probes = 0;
+
+    {
+        auto cache = std::make_shared<SupportedCountersCache>(file, "platform", true);
+
+        FlexCounter fc("test", sai, "COUNTERS_DB", nullptr, cache);
+
+        fc.addCounter(oid1, oid1, values);
+        fc.addCounter(oid2, oid2, values);
+
+        EXPECT_EQ(probes, 0);
+        EXPECT_EQ(fc.isEmpty(), false);
+
+        // removed object is forgotten
+
+        fc.removeCounter(oid2);
+    }
+
+    {
+        auto cache = std::make_shared<SupportedCountersCache>(file, "platform", true);
+
+        FlexCounter fc("test", sai, "COUNTERS_DB", nullptr, cache);
+
+        fc.addCounter(oid1, oid1, values);
+        fc.addCounter(oid2, oid2, values);
+
+        EXPECT_EQ(probes, 2);
+    }
+
+    // objects are created again on cold start, they are probed again
+
+    probes = 0;
+
+    {
+        auto cache = std::make_shared<SupportedCountersCache>(file, "platform");
+
+        FlexCounter fc("test", sai, "COUNTERS_DB", nullptr, cache);
+
+        fc.addCounter(oid1, oid1, values);
+        fc.addCounter(oid2, oid2, values);
+
+        EXPECT_EQ(probes, 4);
+
+        fc.removeCounter(oid1);
+        fc.removeCounter(oid2);
+    }
+
+    remove(file.c_str());
+}
+
+TEST(FlexCounter, contextAggregation)
+{
+    static std::atomic<uint32_t> samples;
+
+    samples = 0;
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t, uint32_t number_of_counters, const sai_stat_id_t *, uint64_t *counters) {
+        // peak on second sample only
+        uint64_t value = (samples++ == 1) ? 900 : 100;
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[i] = value;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+    sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+    sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_PORT);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(POLL_INTERVAL_FIELD, "200");
+    values.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+    values.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
+    values.emplace_back(CONTEXT_AGGREGATION_FIELD, "Port Counter:max:1000");
+    fc.addCounterPlugin(values);
+
+    sai_object_id_t oid{0x1000000000000};
+    values.clear();
+    values.emplace_back(PORT_COUNTER_ID_LIST, "SAI_PORT_STAT_IF_IN_OCTETS");
+    fc.addCounter(oid, oid, values);
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::RedisPipeline pipeline(&db);
+    swss::Table countersTable(&pipeline, COUNTERS_TABLE, false);
+
+    std::string expectedKey = toOid(oid);
+    std::string value;
+
+    // samples are not published until window is over
+
+    usleep(1000*500);
+    EXPECT_GT(samples.load(), 1);
+    EXPECT_FALSE(countersTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_OCTETS", value));
+
+    usleep(1000*1000);
+    countersTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_OCTETS", value);
+    EXPECT_EQ(value, "900");
+
+    // peak of previous window is not carried over
+
+    usleep(1000*1300);
+    countersTable.hget(expectedKey, "SAI_PORT_STAT_IF_IN_OCTETS", value);
+    EXPECT_EQ(value, "100");
+
+    fc.removeCounter(oid);
+    countersTable.del(expectedKey);
+}
+
+TEST(FlexCounter, bulkChunkSize)
+{
+    static std::atomic<uint32_t> bulkCalls;
+    static std::atomic<uint32_t> maxObjectCount;
+
+    bulkCalls = 0;
+    maxObjectCount = 0;
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t, uint32_t number_of_counters, const sai_stat_id_t *, uint64_t *counters) {
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[i] = 100;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+    sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *) {
+        return SAI_STATUS_FAILURE;
+    };
+    sai->mock_bulkGetStats = [](sai_object_id_t,
+                                sai_object_type_t,
+                                uint32_t object_count,
+                                const sai_object_key_t *object_keys,
+                                uint32_t number_of_counters,
+                                const sai_stat_id_t *,
+                                sai_stats_mode_t,
+                                sai_status_t *object_status,
+                                uint64_t *counters)
+    {
+        bulkCalls++;
+        maxObjectCount = std::max(maxObjectCount.load(), object_count);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_status[i] = SAI_STATUS_SUCCESS;
+            for (uint32_t j = 0; j < number_of_counters; j++)
+            {
+                // value identifies object, to verify chunk offsets
+                counters[i * number_of_counters + j] = object_keys[i].key.object_id & 0xff;
+            }
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto scheduler = std::make_shared<FlexCounterScheduler>(2);
+
+    FlexCounter fc("test", sai, "COUNTERS_DB", scheduler);
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_QUEUE);
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(POLL_INTERVAL_FIELD, "1000");
+    values.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+    values.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
+    values.emplace_back(BULK_CHUNK_SIZE_FIELD, "2");
+    fc.addCounterPlugin(values);
+
+    std::vector<sai_object_id_t> oids;
+    for (sai_object_id_t i = 0; i < 5; i++)
+    {
+        oids.push_back(0x15000000000000 + i);
+    }
+
+    values.clear();
+    values.emplace_back(QUEUE_COUNTER_ID_LIST, "SAI_QUEUE_STAT_PACKETS,SAI_QUEUE_STAT_BYTES");
+    for (auto oid: oids)
+    {
+        fc.addCounter(oid, oid, values);
+    }
+
+    usleep(1000*1050);
+
+    // 5 objects are collected in 3 chunks on each poll
+
+    EXPECT_GE(bulkCalls.load(), 3);
+    EXPECT_EQ(maxObjectCount.load(), 2);
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::RedisPipeline pipeline(&db);
+    swss::Table countersTable(&pipeline, COUNTERS_TABLE, false);
+
+    for (auto oid: oids)
+    {
+        std::string value;
+        countersTable.hget(toOid(oid), "SAI_QUEUE_STAT_BYTES", value);
+        EXPECT_EQ(value, std::to_string(oid & 0xff));
+    }
+
+    for (auto oid: oids)
+    {
+        fc.removeCounter(oid);
+        countersTable.del(toOid(oid));
+    }
+}
@@ -0,0 +1,182 @@
+#include "FlexCounterScheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace syncd;
+
+TEST(FlexCounterScheduler, ctor)
+{
+    EXPECT_THROW(FlexCounterScheduler(0), std::runtime_error);
+}
+
+TEST(FlexCounterScheduler, addJob)
+{
+    FlexCounterScheduler scheduler(2);
+
+    EXPECT_THROW(scheduler.addJob("zero", 0, 0, []() {}), std::runtime_error);
+
+    std::atomic<int> fast(0);
+    std::atomic<int> slow(0);
+
+    auto fastId = scheduler.addJob("fast", 20, 0, [&]() { fast++; });
+    auto slowId = scheduler.addJob("slow", 1000, 0, [&]() { slow++; });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+    scheduler.removeJob(fastId, true);
+    scheduler.removeJob(slowId, true);
+
+    // first run is immediate
+
+    EXPECT_GE(fast, 5);
+    EXPECT_EQ(slow, 1);
+
+    EXPECT_THROW(scheduler.getJobStatistics(fastId), std::runtime_error);
+}
+
+TEST(FlexCounterScheduler, slowJobNotDelayingOthers)
+{
+    FlexCounterScheduler scheduler(2);
+
+    std::atomic<int> fast(0);
+
+    auto slowId = scheduler.addJob("slow", 50, 0, [&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+            });
+
+    auto fastId = scheduler.addJob("fast", 20, 0, [&]() { fast++; });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+    EXPECT_GE(fast, 5);
+
+    scheduler.removeJob(fastId, true);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    auto stats = scheduler.getJobStatistics(slowId);
+
+    EXPECT_GE(stats.runs, 1u);
+    EXPECT_GE(stats.overruns, 1u);
+
+    scheduler.removeJob(slowId, true);
+}
+
+TEST(FlexCounterScheduler, triggerJob)
+{
+    FlexCounterScheduler scheduler(1);
+
+    std::atomic<int> runs(0);
+
+    auto id = scheduler.addJob("job", 10000, 0, [&]() { runs++; });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(runs, 1);
+
+    scheduler.triggerJob(id);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(runs, 2);
+
+    scheduler.updateJob(id, 20, 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_GE(runs, 3);
+
+    scheduler.removeJob(id, true);
+}
+
+TEST(FlexCounterScheduler, runTasks)
+{
+    FlexCounterScheduler scheduler(2);
+
+    std::atomic<int> done(0);
+
+    std::vector<FlexCounterScheduler::JobFunction> tasks;
+
+    for (int i = 0; i < 8; i++)
+    {
+        tasks.push_back([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            done++;
+        });
+    }
+
+    tasks.push_back([]() { throw std::runtime_error("task failure"); });
+
+    // tasks run from job function, while the only other worker is busy
+
+    std::atomic<bool> finished(false);
+
+    auto blockerId = scheduler.addJob("blocker", 10000, 0, [&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    auto jobId = scheduler.addJob("job", 10000, 0, [&]() {
+        scheduler.runTasks(tasks);
+        finished = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(done, 8);
+
+    scheduler.removeJob(jobId, true);
+    scheduler.removeJob(blockerId, true);
+
+    // tasks run in parallel
+
+    done = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    tasks.pop_back();
+
+    scheduler.runTasks(tasks);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(done, 8);
+    EXPECT_LT(elapsed, 8 * 20);
+}
+
+TEST(FlexCounterScheduler, waitRemovedJob)
+{
+    FlexCounterScheduler scheduler(1);
+
+    std::atomic<bool> started(false);
+    std::atomic<bool> finished(false);
+
+    auto id = scheduler.addJob("slow", 1000, 0, [&]() {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            finished = true;
+            });
+
+    while (!started)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    scheduler.removeJob(id, false);
+
+    EXPECT_TRUE(scheduler.isJobRunning(id));
+
+    scheduler.waitJob(id);
+
+    EXPECT_TRUE(finished);
+    EXPECT_FALSE(scheduler.isJobRunning(id));
+
+    // unknown job is not waited for
+
+    scheduler.waitJob(id + 1);
+}
@@ -3,6 +3,8 @@
 #include "NotificationProcessor.h"
 #include "lib/RedisVidIndexGenerator.h"
 #include "lib/sairediscommon.h"
+#include "meta/NotificationFactory.h"
+#include "meta/sai_serialize.h"
 #include "vslib/Sai.h"
 
 #include <gtest/gtest.h>
@@ -20,7 +22,7 @@ TEST(NotificationProcessor, NotificationProcessorTest)
     auto producer = std::make_shared<syncd::RedisNotificationProducer>("ASIC_DB");
 
     auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
-                                                             [](const swss::KeyOpFieldsValuesTuple&){});
+                                                             [](const std::vector<std::shared_ptr<sairedis::Notification>>&){});
     EXPECT_NE(notificationProcessor, nullptr);
 
     auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
@@ -74,3 +76,387 @@ TEST(NotificationProcessor, NotificationProcessorTest)
     EXPECT_EQ(*bridgeport, "oid:0x3a000000000a99");
     EXPECT_EQ(ip, nullptr);
 }
+
+class CapturingNotificationProducer:
+    public NotificationProducerBase
+{
+    public:
+
+        virtual void send(
+                _In_ const std::string& op,
+                _In_ const std::string& data,
+                _In_ const std::vector<swss::FieldValueTuple>& values) override
+        {
+            SWSS_LOG_ENTER();
+
+            m_sent.emplace_back(op, data);
+
+            m_values.push_back(values);
+        }
+
+        std::vector<std::pair<std::string, std::string>> m_sent;
+
+        std::vector<std::vector<swss::FieldValueTuple>> m_values;
+};
+
+TEST(NotificationProcessor, sendBatch)
+{
+    auto sai = std::make_shared<saivs::Sai>();
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto producer = std::make_shared<CapturingNotificationProducer>();
+
+    auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
+                                                             [](const std::vector<std::shared_ptr<sairedis::Notification>>&){});
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+    auto virtualObjectIdManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, switchConfigContainer, redisVidIndexGenerator);
+
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, sai);
+
+    notificationProcessor->m_translator = translator;
+
+    translator->insertRidAndVid(0x21000000000000,0x210000000000);
+    translator->insertRidAndVid(0x3000000000048,0x30000000048);
+
+    std::vector<swss::FieldValueTuple> natEntry;
+    swss::KeyOpFieldsValuesTuple natFV(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, natData, natEntry);
+
+    // events of consecutive notifications are merged
+
+    notificationProcessor->syncProcessNotification(natFV);
+    notificationProcessor->syncProcessNotification(natFV);
+
+    EXPECT_EQ(producer->m_sent.size(), 0);
+
+    notificationProcessor->flushSendBatch();
+
+    ASSERT_EQ(producer->m_sent.size(), 1);
+    EXPECT_EQ(producer->m_sent[0].first, SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT);
+
+    auto ntf = sairedis::NotificationFactory::deserialize(producer->m_sent[0].first, producer->m_sent[0].second);
+
+    EXPECT_EQ(std::dynamic_pointer_cast<sairedis::NotificationNatEvent>(ntf)->getCount(), 2);
+
+    // batch is flushed when queue is drained
+
+    notificationProcessor->syncProcessNotifications({
+            sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, natData) });
+
+    EXPECT_EQ(producer->m_sent.size(), 2);
+
+    // batching disabled
+
+    notificationProcessor->setSendBatchSize(1);
+
+    notificationProcessor->syncProcessNotification(natFV);
+
+    EXPECT_EQ(producer->m_sent.size(), 3);
+
+    translator->eraseRidAndVid(0x21000000000000,0x210000000000);
+    translator->eraseRidAndVid(0x3000000000048,0x30000000048);
+}
+
+class FailingNotificationProducer:
+    public CapturingNotificationProducer
+{
+    public:
+
+        virtual void send(
+                _In_ const std::string& op,
+                _In_ const std::string& data,
+                _In_ const std::vector<swss::FieldValueTuple>& values) override
+        {
+            SWSS_LOG_ENTER();
+
+            if (m_failures)
+            {
+                m_failures--;
+
+                throw std::runtime_error("send failed");
+            }
+
+            CapturingNotificationProducer::send(op, data, values);
+        }
+
+        size_t m_failures = 0;
+};
+
+TEST(NotificationProcessor, failingNotification)
+{
+    auto sai = std::make_shared<saivs::Sai>();
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto producer = std::make_shared<FailingNotificationProducer>();
+
+    auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
+                                                             [](const std::vector<std::shared_ptr<sairedis::Notification>>&){});
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+    auto virtualObjectIdManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, switchConfigContainer, redisVidIndexGenerator);
+
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, sai);
+
+    notificationProcessor->m_translator = translator;
+
+    notificationProcessor->setSendBatchSize(1);
+
+    translator->insertRidAndVid(0x21000000000000,0x210000000000);
+    translator->insertRidAndVid(0x3000000000048,0x30000000048);
+
+    // first notification fails, rest of the batch is still processed
+
+    producer->m_failures = 1;
+
+    notificationProcessor->syncProcessNotifications({
+            sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, natData),
+            sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, natData) });
+
+    EXPECT_EQ(producer->m_failures, 0);
+    EXPECT_EQ(producer->m_sent.size(), 1);
+
+    translator->eraseRidAndVid(0x21000000000000,0x210000000000);
+    translator->eraseRidAndVid(0x3000000000048,0x30000000048);
+}
+
+#define FDB_PORT1_RID (0x1003a00000101)
+#define FDB_PORT1_VID (0x3a000000000b01)
+#define FDB_PORT2_RID (0x1003a00000102)
+#define FDB_PORT2_VID (0x3a000000000b02)
+
+static std::shared_ptr<sairedis::Notification> fdbEvent(
+        _In_ const std::string& event,
+        _In_ const std::string& mac,
+        _In_ sai_object_id_t portRid,
+        _In_ const std::string& attrs = "")
+{
+    SWSS_LOG_ENTER();
+
+    std::string bvid = (event == "SAI_FDB_EVENT_FLUSHED") ? "oid:0x0" : "oid:0x2600000001";
+
+    std::string data = "[{\"fdb_entry\":\"{\\\"bvid\\\":\\\"" + bvid + "\\\",\\\"mac\\\":\\\"" + mac +
+        "\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\",\"fdb_event\":\"" + event +
+        "\",\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"" + sai_serialize_object_id(portRid) + "\"}" +
+        attrs + "]}]";
+
+    return sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, data);
+}
+
+static std::string fdbKey(
+        _In_ const std::string& mac)
+{
+    SWSS_LOG_ENTER();
+
+    return "ASIC_STATE:SAI_OBJECT_TYPE_FDB_ENTRY:{\"bvid\":\"oid:0x26000000000001\",\"mac\":\"" + mac +
+        "\",\"switch_id\":\"oid:0x210000000000\"}";
+}
+
+TEST(NotificationProcessor, fdbBatch)
+{
+    auto sai = std::make_shared<saivs::Sai>();
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto producer = std::make_shared<CapturingNotificationProducer>();
+
+    auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
+                                                             [](const std::vector<std::shared_ptr<sairedis::Notification>>&){});
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+    auto virtualObjectIdManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, switchConfigContainer, redisVidIndexGenerator);
+
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, sai);
+
+    notificationProcessor->m_translator = translator;
+
+    translator->insertRidAndVid(0x21000000000000,0x210000000000);
+    translator->insertRidAndVid(0x2600000001,0x26000000000001);
+    translator->insertRidAndVid(FDB_PORT1_RID,FDB_PORT1_VID);
+    translator->insertRidAndVid(FDB_PORT2_RID,FDB_PORT2_VID);
+
+    const std::string port1 = sai_serialize_object_id(FDB_PORT1_VID);
+    const std::string port2 = sai_serialize_object_id(FDB_PORT2_VID);
+    const std::string forward = ",{\"id\":\"SAI_FDB_ENTRY_ATTR_PACKET_ACTION\",\"value\":\"SAI_PACKET_ACTION_FORWARD\"}";
+
+    for (auto& mac: { "00:00:00:00:46:01", "00:00:00:00:46:02", "00:00:00:00:46:03", "00:00:00:00:46:04" })
+    {
+        dbAsic->del(fdbKey(mac));
+    }
+
+    // entry present before batch
+
+    dbAsic->hset(fdbKey("00:00:00:00:46:02"), "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", port1);
+    dbAsic->hset(fdbKey("00:00:00:00:46:02"), "SAI_FDB_ENTRY_ATTR_TYPE", "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+    dbAsic->hset(fdbKey("00:00:00:00:46:02"), "SAI_FDB_ENTRY_ATTR_PACKET_ACTION", "SAI_PACKET_ACTION_FORWARD");
+
+    notificationProcessor->syncProcessNotifications({
+            // learn -> age
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:01", FDB_PORT1_RID),
+            fdbEvent("SAI_FDB_EVENT_AGED", "00:00:00:00:46:01", FDB_PORT1_RID),
+            // age -> learn
+            fdbEvent("SAI_FDB_EVENT_AGED", "00:00:00:00:46:02", FDB_PORT1_RID),
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:02", FDB_PORT2_RID),
+            // learn -> move
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:03", FDB_PORT1_RID, forward),
+            fdbEvent("SAI_FDB_EVENT_MOVE", "00:00:00:00:46:03", FDB_PORT2_RID),
+            // learn -> learn
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:04", FDB_PORT1_RID, forward),
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:04", FDB_PORT2_RID) });
+
+    EXPECT_FALSE(dbAsic->exists(fdbKey("00:00:00:00:46:01")));
+
+    // entry is created again, attributes of aged entry are gone
+
+    auto attrs = dbAsic->hgetall(fdbKey("00:00:00:00:46:02"));
+
+    EXPECT_EQ(attrs.size(), 2);
+    EXPECT_EQ(attrs["SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID"], port2);
+    EXPECT_EQ(attrs["SAI_FDB_ENTRY_ATTR_TYPE"], "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+
+    // moved entry has only attributes of move
+
+    attrs = dbAsic->hgetall(fdbKey("00:00:00:00:46:03"));
+
+    EXPECT_EQ(attrs.size(), 2);
+    EXPECT_EQ(attrs["SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID"], port2);
+
+    // learn on learned entry updates its attributes
+
+    attrs = dbAsic->hgetall(fdbKey("00:00:00:00:46:04"));
+
+    EXPECT_EQ(attrs.size(), 3);
+    EXPECT_EQ(attrs["SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID"], port2);
+    EXPECT_EQ(attrs["SAI_FDB_ENTRY_ATTR_PACKET_ACTION"], "SAI_PACKET_ACTION_FORWARD");
+
+    for (auto& mac: { "00:00:00:00:46:02", "00:00:00:00:46:03", "00:00:00:00:46:04" })
+    {
+        dbAsic->del(fdbKey(mac));
+    }
+
+    translator->eraseRidAndVid(0x21000000000000,0x210000000000);
+    translator->eraseRidAndVid(0x2600000001,0x26000000000001);
+    translator->eraseRidAndVid(FDB_PORT1_RID,FDB_PORT1_VID);
+    translator->eraseRidAndVid(FDB_PORT2_RID,FDB_PORT2_VID);
+}
+
+TEST(NotificationProcessor, fdbBatchFlush)
+{
+    auto sai = std::make_shared<saivs::Sai>();
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto producer = std::make_shared<CapturingNotificationProducer>();
+
+    auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
+                                                             [](const std::vector<std::shared_ptr<sairedis::Notification>>&){});
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+    auto virtualObjectIdManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, switchConfigContainer, redisVidIndexGenerator);
+
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, sai);
+
+    notificationProcessor->m_translator = translator;
+
+    translator->insertRidAndVid(0x21000000000000,0x210000000000);
+    translator->insertRidAndVid(0x2600000001,0x26000000000001);
+    translator->insertRidAndVid(FDB_PORT1_RID,FDB_PORT1_VID);
+    translator->insertRidAndVid(FDB_PORT2_RID,FDB_PORT2_VID);
+
+    for (auto& mac: { "00:00:00:00:46:11", "00:00:00:00:46:12", "00:00:00:00:46:13" })
+    {
+        dbAsic->del(fdbKey(mac));
+    }
+
+    client->setFdbIndex(true);
+
+    const std::string dynamic = ",{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":\"SAI_FDB_ENTRY_TYPE_DYNAMIC\"}";
+
+    // flush is barrier, it removes entries learned before it in the same
+    // batch, but not entries learned after it
+
+    notificationProcessor->syncProcessNotifications({
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:11", FDB_PORT1_RID),
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:12", FDB_PORT2_RID),
+            fdbEvent("SAI_FDB_EVENT_FLUSHED", "00:00:00:00:00:00", FDB_PORT1_RID, dynamic),
+            fdbEvent("SAI_FDB_EVENT_LEARNED", "00:00:00:00:46:13", FDB_PORT1_RID) });
+
+    EXPECT_FALSE(dbAsic->exists(fdbKey("00:00:00:00:46:11")));
+    EXPECT_TRUE(dbAsic->exists(fdbKey("00:00:00:00:46:12")));
+    EXPECT_TRUE(dbAsic->exists(fdbKey("00:00:00:00:46:13")));
+
+    for (auto& mac: { "00:00:00:00:46:12", "00:00:00:00:46:13" })
+    {
+        dbAsic->del(fdbKey(mac));
+    }
+
+    translator->eraseRidAndVid(0x21000000000000,0x210000000000);
+    translator->eraseRidAndVid(0x2600000001,0x26000000000001);
+    translator->eraseRidAndVid(FDB_PORT1_RID,FDB_PORT1_VID);
+    translator->eraseRidAndVid(FDB_PORT2_RID,FDB_PORT2_VID);
+}
+
+TEST(NotificationProcessor, trace)
+{
+    auto sai = std::make_shared<saivs::Sai>();
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto producer = std::make_shared<CapturingNotificationProducer>();
+
+    auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
+                                                             [](const std::vector<std::shared_ptr<sairedis::Notification>>&){});
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+    auto virtualObjectIdManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, switchConfigContainer, redisVidIndexGenerator);
+
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, sai);
+
+    notificationProcessor->m_translator = translator;
+
+    translator->insertRidAndVid(0x21000000000000,0x210000000000);
+    translator->insertRidAndVid(0x3000000000048,0x30000000048);
+
+    auto tracer = std::make_shared<NotificationTracer>(nullptr);
+
+    notificationProcessor->setTracer(tracer);
+
+    // not traced notification is not recorded
+
+    auto ntf = sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, natData);
+
+    notificationProcessor->syncProcessNotification(ntf);
+    notificationProcessor->flushSendBatch();
+
+    ASSERT_EQ(producer->m_values.size(), 1);
+    EXPECT_EQ(producer->m_values[0].size(), 0);
+    EXPECT_TRUE(tracer->dump().empty());
+
+    ntf = sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, natData);
+
+    auto now = NotificationTracer::now();
+
+    ntf->setTraceTimestamp(sairedis::Notification::TRACE_STAGE_CALLBACK, now);
+    ntf->setTraceTimestamp(sairedis::Notification::TRACE_STAGE_ENQUEUE, now);
+    ntf->setTraceTimestamp(sairedis::Notification::TRACE_STAGE_DEQUEUE, now);
+
+    notificationProcessor->syncProcessNotification(ntf);
+
+    // batched events are recorded when batch is sent
+
+    EXPECT_EQ(tracer->getHistogram(SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT, NotificationTracer::INTERVAL_TOTAL).getCount(), 0);
+
+    notificationProcessor->flushSendBatch();
+
+    EXPECT_EQ(tracer->getHistogram(SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT, NotificationTracer::INTERVAL_TOTAL).getCount(), 1);
+    EXPECT_EQ(tracer->getHistogram(SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT, NotificationTracer::INTERVAL_QUEUE).getCount(), 1);
+    EXPECT_EQ(tracer->dump().size(), (size_t)NotificationTracer::INTERVAL_COUNT);
+
+    ASSERT_EQ(producer->m_values.size(), 2);
+    ASSERT_EQ(producer->m_values[1].size(), 1);
+    EXPECT_EQ(fvField(producer->m_values[1][0]), REDIS_NOTIFICATION_FIELD_TIMESTAMP);
+
+    translator->eraseRidAndVid(0x21000000000000,0x210000000000);
+    translator->eraseRidAndVid(0x3000000000048,0x30000000048);
+}
@@ -1,6 +1,9 @@
 #include "NotificationQueue.h"
 
 #include "sairediscommon.h"
+#include "meta/NotificationFactory.h"
+
+#include "swss/logger.h"
 
 #include <gtest/gtest.h>
 
@@ -17,14 +20,12 @@ TEST(NotificationQueue, EnqueueLimitTest)
 {
     bool status;
     int i;
-    std::vector<swss::FieldValueTuple> fdbEntry;
-    std::vector<swss::FieldValueTuple> sscEntry;
 
     // Set up a queue with limit at 5 and threshold at 3 where after this is reached event starts dropping
     syncd::NotificationQueue testQ(5, 3);
 
     // Try queue up 5 fake FDB event and expect them to be added successfully
-    swss::KeyOpFieldsValuesTuple fdbItem(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, fdbData, fdbEntry);
+    auto fdbItem = sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, fdbData);
     for (i = 0; i < 5; ++i)
     {
         status = testQ.enqueue(fdbItem);
@@ -36,7 +37,7 @@ TEST(NotificationQueue, EnqueueLimitTest)
     EXPECT_EQ(status, false);
 
     // Add 2 switch state change events expect both are accepted as consecutive limit not yet reached
-    swss::KeyOpFieldsValuesTuple sscItem(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, sscData, sscEntry);
+    auto sscItem = sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, sscData);
     for (i = 0; i < 2; ++i)
     {
         status = testQ.enqueue(sscItem);
@@ -66,3 +67,275 @@ TEST(NotificationQueue, EnqueueLimitTest)
     }
 }
 
+
+static std::shared_ptr<sairedis::Notification> fdbEvent(
+        _In_ const std::string& mac,
+        _In_ const std::string& event,
+        _In_ const std::string& bridgePort)
+{
+    SWSS_LOG_ENTER();
+
+    std::string data =
+        "[{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x260000000005be\\\",\\\"mac\\\":\\\"" + mac + "\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+        "\"fdb_event\":\"" + event + "\","
+        "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":\"SAI_FDB_ENTRY_TYPE_DYNAMIC\"},{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"" + bridgePort + "\"}]}]";
+
+    return sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, data);
+}
+
+static std::shared_ptr<sairedis::NotificationFdbEvent> dequeueFdb(
+        _In_ NotificationQueue& queue)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<sairedis::Notification> item;
+
+    EXPECT_TRUE(queue.tryDequeue(item));
+
+    return std::dynamic_pointer_cast<sairedis::NotificationFdbEvent>(item);
+}
+
+TEST(NotificationQueue, FdbCoalesce)
+{
+    syncd::NotificationQueue testQ(10, 3);
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+
+    // move of learned entry is coalesced into learn with new bridge port
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_MOVE", "oid:0x3a000000000661")));
+
+    EXPECT_EQ(testQ.getQueueSize(), 2);
+    EXPECT_EQ(testQ.getCoalescedCount(), 1);
+
+    auto fdb = dequeueFdb(testQ);
+
+    ASSERT_NE(fdb, nullptr);
+    ASSERT_EQ(fdb->getCount(), 1);
+    EXPECT_EQ(fdb->getData()[0].event_type, SAI_FDB_EVENT_LEARNED);
+    EXPECT_EQ(fdb->getData()[0].attr[1].value.oid, 0x3a000000000661);
+
+    // dequeued event is not modified any more
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_AGED", "oid:0x3a000000000661")));
+
+    EXPECT_EQ(testQ.getQueueSize(), 2);
+    EXPECT_EQ(fdb->getData()[0].event_type, SAI_FDB_EVENT_LEARNED);
+
+    // entry learned and aged before it was dequeued is dropped
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_AGED", "oid:0x3a000000000660")));
+
+    EXPECT_EQ(testQ.getQueueSize(), 2);
+    EXPECT_EQ(testQ.getCoalescedCount(), 3);
+
+    fdb = dequeueFdb(testQ);
+
+    ASSERT_NE(fdb, nullptr);
+    ASSERT_EQ(fdb->getCount(), 1);
+    EXPECT_EQ(fdb->getData()[0].event_type, SAI_FDB_EVENT_AGED);
+    EXPECT_EQ(fdb->getData()[0].fdb_entry.mac_address[5], 0x7A);
+
+    std::shared_ptr<sairedis::Notification> item;
+
+    EXPECT_FALSE(testQ.tryDequeue(item));
+}
+
+TEST(NotificationQueue, FdbCoalesceLearnAged)
+{
+    syncd::NotificationQueue testQ(10, 3);
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_AGED", "oid:0x3a000000000660")));
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7C", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+
+    // entry known to orchagent is aged, even when learned again in between
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000661")));
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_AGED", "oid:0x3a000000000661")));
+
+    // learned entries are aged before they were dequeued
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_MOVE", "oid:0x3a000000000661")));
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_AGED", "oid:0x3a000000000661")));
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7C", "SAI_FDB_EVENT_AGED", "oid:0x3a000000000660")));
+
+    EXPECT_EQ(testQ.getQueueSize(), 3);
+    EXPECT_EQ(testQ.getCoalescedCount(), 7);
+
+    // cancelled notifications are skipped
+
+    auto fdb = dequeueFdb(testQ);
+
+    ASSERT_NE(fdb, nullptr);
+    ASSERT_EQ(fdb->getCount(), 1);
+    EXPECT_EQ(fdb->getData()[0].event_type, SAI_FDB_EVENT_AGED);
+    EXPECT_EQ(fdb->getData()[0].fdb_entry.mac_address[5], 0x7B);
+
+    std::shared_ptr<sairedis::Notification> item;
+
+    EXPECT_FALSE(testQ.tryDequeue(item));
+
+    // events of dequeued entries are queued again
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_AGED", "oid:0x3a000000000661")));
+
+    fdb = dequeueFdb(testQ);
+
+    ASSERT_NE(fdb, nullptr);
+    EXPECT_EQ(fdb->getData()[0].event_type, SAI_FDB_EVENT_AGED);
+}
+
+TEST(NotificationQueue, FdbCoalesceFlush)
+{
+    syncd::NotificationQueue testQ(10, 3);
+
+    std::string flushData =
+        "[{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x0\\\",\\\"mac\\\":\\\"00:00:00:00:00:00\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+        "\"fdb_event\":\"SAI_FDB_EVENT_FLUSHED\","
+        "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":\"SAI_FDB_ENTRY_TYPE_DYNAMIC\"},{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]}]";
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+
+    // redundant flush is coalesced
+
+    EXPECT_TRUE(testQ.enqueue(sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, flushData)));
+    EXPECT_TRUE(testQ.enqueue(sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, flushData)));
+
+    EXPECT_EQ(testQ.getQueueSize(), 2);
+    EXPECT_EQ(testQ.getCoalescedCount(), 1);
+
+    // events before flush are not coalesced with events after flush
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000661")));
+
+    EXPECT_EQ(testQ.getQueueSize(), 3);
+
+    // flush after other event is not redundant
+
+    EXPECT_TRUE(testQ.enqueue(sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, flushData)));
+
+    EXPECT_EQ(testQ.getQueueSize(), 4);
+    EXPECT_EQ(testQ.getCoalescedCount(), 1);
+}
+
+TEST(NotificationQueue, FdbCoalesceLimit)
+{
+    syncd::NotificationQueue testQ(1, 3);
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+
+    // queue is full, but events of queued entry are still accepted
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_MOVE", "oid:0x3a000000000661")));
+    EXPECT_FALSE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+
+    EXPECT_EQ(testQ.getQueueSize(), 1);
+    EXPECT_EQ(testQ.getCoalescedCount(), 1);
+    EXPECT_EQ(testQ.getDropCount(), 1);
+}
+
+TEST(NotificationQueue, Lanes)
+{
+    syncd::NotificationQueue testQ(10, 3);
+
+    auto sscItem = sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, sscData);
+
+    testQ.setLaneLimit(NotificationQueue::LANE_BULK, 2);
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7B", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+
+    // bulk lane is full, but control lane is not affected
+
+    EXPECT_FALSE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7C", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+    EXPECT_TRUE(testQ.enqueue(sscItem));
+    EXPECT_TRUE(testQ.enqueue(sscItem));
+
+    auto stats = testQ.getLaneStats(NotificationQueue::LANE_BULK);
+
+    EXPECT_EQ(stats.depth, 2);
+    EXPECT_EQ(stats.enqueued, 2);
+    EXPECT_EQ(stats.dropped, 1);
+
+    // control lane has strict priority
+
+    std::shared_ptr<sairedis::Notification> item;
+
+    EXPECT_TRUE(testQ.tryDequeue(item));
+    EXPECT_EQ(item->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE);
+
+    EXPECT_TRUE(testQ.tryDequeue(item));
+    EXPECT_EQ(item->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE);
+
+    EXPECT_TRUE(testQ.tryDequeue(item));
+    EXPECT_EQ(item->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT);
+
+    stats = testQ.getLaneStats(NotificationQueue::LANE_CONTROL);
+
+    EXPECT_EQ(stats.depth, 0);
+    EXPECT_EQ(stats.maxDepth, 2);
+    EXPECT_EQ(stats.dequeued, 2);
+}
+
+TEST(NotificationQueue, LanesWeight)
+{
+    syncd::NotificationQueue testQ(10, 10);
+
+    auto sscItem = sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, sscData);
+
+    testQ.setControlLaneWeight(2);
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(testQ.enqueue(sscItem));
+    }
+
+    std::vector<sai_switch_notification_type_t> types;
+
+    std::shared_ptr<sairedis::Notification> item;
+
+    while (testQ.tryDequeue(item))
+    {
+        types.push_back(item->getNotificationType());
+    }
+
+    std::vector<sai_switch_notification_type_t> expected = {
+        SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE,
+        SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE,
+        SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT,
+        SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE };
+
+    EXPECT_EQ(types, expected);
+}
+
+TEST(NotificationQueue, tryDequeueMany)
+{
+    syncd::NotificationQueue testQ(10, 10);
+
+    auto sscItem = sairedis::NotificationFactory::deserialize(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, sscData);
+
+    EXPECT_TRUE(testQ.enqueue(fdbEvent("52:54:00:86:DD:7A", "SAI_FDB_EVENT_LEARNED", "oid:0x3a000000000660")));
+    EXPECT_TRUE(testQ.enqueue(sscItem));
+    EXPECT_TRUE(testQ.enqueue(sscItem));
+
+    std::vector<std::shared_ptr<sairedis::Notification>> items;
+
+    EXPECT_TRUE(testQ.tryDequeueMany(items, 2));
+
+    ASSERT_EQ(items.size(), 2);
+    EXPECT_EQ(items[0]->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE);
+    EXPECT_EQ(items[1]->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE);
+
+    EXPECT_TRUE(testQ.tryDequeueMany(items, 2));
+
+    ASSERT_EQ(items.size(), 1);
+    EXPECT_EQ(items[0]->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT);
+
+    EXPECT_FALSE(testQ.tryDequeueMany(items, 2));
+    EXPECT_TRUE(items.empty());
+    EXPECT_EQ(testQ.getQueueSize(), 0);
+}
@@ -0,0 +1,143 @@
+#include "NotificationRingWriter.h"
+#include "NotificationRingReader.h"
+
+#include "sairediscommon.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+#define TEST_CONTEXT 1000
+
+static const std::string portStateChange =
+    "[{\"port_id\":\"oid:0x100000000001a\",\"port_state\":\"SAI_PORT_OPER_STATUS_UP\"}]";
+
+TEST(NotificationRing, getShmName)
+{
+    EXPECT_EQ(NotificationRing::getShmName(0), "/sairedis_notification_ring_0");
+}
+
+TEST(NotificationRing, getRecordSize)
+{
+    EXPECT_EQ(NotificationRing::getRecordSize(0, 0), sizeof(NotificationRingRecord));
+    EXPECT_EQ(NotificationRing::getRecordSize(1, 0), 2 * NOTIFICATION_RING_ALIGNMENT);
+    EXPECT_EQ(NotificationRing::getRecordSize(16, 16), 2 * NOTIFICATION_RING_ALIGNMENT);
+}
+
+TEST(NotificationRing, readerWithoutRing)
+{
+    EXPECT_THROW(NotificationRingReader(TEST_CONTEXT + 1), std::runtime_error);
+}
+
+TEST(NotificationRing, writeAndRead)
+{
+    EXPECT_THROW(NotificationRingWriter(TEST_CONTEXT, 64), std::runtime_error);
+
+    NotificationRingWriter writer(TEST_CONTEXT, 1000);
+
+    EXPECT_EQ(writer.getCapacity(), 1024);
+
+    NotificationRingReader reader1(TEST_CONTEXT);
+    NotificationRingReader reader2(TEST_CONTEXT);
+
+    NotificationRingReader::Record record;
+
+    EXPECT_FALSE(reader1.read(record));
+
+    // records wrap around ring several times, each reader reads all of them
+
+    for (int i = 0; i < 100; i++)
+    {
+        std::string data = "data" + std::to_string(i);
+
+        EXPECT_TRUE(writer.write("name", data));
+
+        ASSERT_TRUE(reader1.read(record));
+
+        EXPECT_EQ(record.sequence, (uint64_t)i + 1);
+        EXPECT_EQ(record.name, "name");
+        EXPECT_EQ(record.data, data);
+        EXPECT_NE(record.timestamp, 0);
+
+        EXPECT_FALSE(reader1.read(record));
+
+        if (i % 3 == 0)
+        {
+            while (reader2.read(record));
+        }
+    }
+
+    EXPECT_EQ(reader1.getLostCount(), 0);
+    EXPECT_EQ(reader2.getLostCount(), 0);
+    EXPECT_EQ(record.sequence, 100);
+}
+
+TEST(NotificationRing, overrun)
+{
+    NotificationRingWriter writer(TEST_CONTEXT, 1024);
+
+    NotificationRingReader reader(TEST_CONTEXT);
+
+    NotificationRingReader::Record record;
+
+    for (int i = 0; i < 30; i++)
+    {
+        writer.write("name", "data");
+    }
+
+    // overrun reader skips all records
+
+    EXPECT_FALSE(reader.read(record));
+
+    writer.write("name", "last");
+
+    ASSERT_TRUE(reader.read(record));
+
+    EXPECT_EQ(record.data, "last");
+    EXPECT_EQ(reader.getLostCount(), 30);
+}
+
+TEST(NotificationRing, dropped)
+{
+    NotificationRingWriter writer(TEST_CONTEXT, 1024);
+
+    NotificationRingReader reader(TEST_CONTEXT);
+
+    EXPECT_FALSE(writer.write("name", std::string(1024, 'x')));
+    EXPECT_FALSE(writer.write("", "data"));
+
+    EXPECT_EQ(reader.getDroppedCount(), 2);
+
+    NotificationRingReader::Record record;
+
+    EXPECT_FALSE(reader.read(record));
+}
+
+TEST(NotificationRing, readNotification)
+{
+    auto writer = std::make_shared<NotificationRingWriter>(TEST_CONTEXT, 4096);
+
+    NotificationRingReader reader(TEST_CONTEXT);
+
+    EXPECT_EQ(reader.readNotification(), nullptr);
+
+    // not known notification is skipped
+
+    writer->write("foo", "bar");
+    writer->write(SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE, portStateChange);
+
+    auto ntf = reader.readNotification();
+
+    ASSERT_NE(ntf, nullptr);
+
+    EXPECT_EQ(ntf->getNotificationType(), SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE);
+    EXPECT_EQ(ntf->getSerializedNotification(), portStateChange);
+
+    EXPECT_EQ(reader.readNotification(), nullptr);
+
+    EXPECT_FALSE(reader.isClosed());
+
+    writer = nullptr;
+
+    EXPECT_TRUE(reader.isClosed());
+}
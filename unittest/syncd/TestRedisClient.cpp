@@ -0,0 +1,192 @@
+#include "RedisClient.h"
+#include "lib/sairediscommon.h"
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace syncd;
+
+#define VLAN_VID 0x26000000000ab1
+#define VLAN_RID 0x1000000000ab1
+#define SWITCH_VID 0x21000000000000
+
+static sai_object_meta_key_t vlanMetaKey()
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_meta_key_t mk;
+
+    mk.objecttype = SAI_OBJECT_TYPE_VLAN;
+    mk.objectkey.key.object_id = VLAN_VID;
+
+    return mk;
+}
+
+static std::string vlanKey()
+{
+    SWSS_LOG_ENTER();
+
+    return (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(vlanMetaKey());
+}
+
+TEST(RedisClient, writeBehindOrder)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto observer = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    auto key = vlanKey();
+
+    observer->del(key);
+
+    client->setAsicStateWriteBehind(true);
+
+    client->createAsicObject(vlanMetaKey(), { { "SAI_VLAN_ATTR_VLAN_ID", "10" } });
+    client->removeAsicObject(vlanMetaKey());
+    client->createAsicObject(vlanMetaKey(), { { "SAI_VLAN_ATTR_VLAN_ID", "20" } });
+    client->setAsicObject(vlanMetaKey(), "SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES", "5");
+
+    // nothing is visible to other connections before barrier
+
+    EXPECT_FALSE(observer->exists(key));
+
+    client->flushAsicState();
+
+    auto hash = observer->hgetall(key);
+
+    EXPECT_EQ(hash.size(), 2);
+    EXPECT_EQ(hash["SAI_VLAN_ATTR_VLAN_ID"], "20");
+    EXPECT_EQ(hash["SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES"], "5");
+
+    // remove queued after create must win
+
+    client->setAsicObject(vlanMetaKey(), "SAI_VLAN_ATTR_VLAN_ID", "30");
+    client->removeAsicObject(vlanMetaKey());
+
+    EXPECT_TRUE(observer->exists(key));
+
+    client->flushAsicState();
+
+    EXPECT_FALSE(observer->exists(key));
+
+    // remove and create in single update, remove goes first
+
+    client->createAsicObject(vlanMetaKey(), { { "SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES", "1" } });
+
+    auto strMetaKey = sai_serialize_object_meta_key(vlanMetaKey());
+
+    client->updateAsicObjects({ strMetaKey }, { { strMetaKey, { { "SAI_VLAN_ATTR_VLAN_ID", "40" } } } });
+
+    EXPECT_FALSE(observer->exists(key));
+
+    // disabling write behind flushes pending operations
+
+    client->setAsicStateWriteBehind(false);
+
+    hash = observer->hgetall(key);
+
+    EXPECT_EQ(hash.size(), 1);
+    EXPECT_EQ(hash["SAI_VLAN_ATTR_VLAN_ID"], "40");
+
+    observer->del(key);
+}
+
+TEST(RedisClient, writeBehindVidRidMap)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto observer = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    auto strVid = sai_serialize_object_id(VLAN_VID);
+    auto strRid = sai_serialize_object_id(VLAN_RID);
+
+    observer->hdel(VIDTORID, strVid);
+    observer->hdel(RIDTOVID, strRid);
+
+    client->setAsicStateWriteBehind(true);
+
+    client->insertVidAndRid(VLAN_VID, VLAN_RID);
+
+    EXPECT_EQ(observer->hget(VIDTORID, strVid), nullptr);
+
+    // reads of VID/RID map must see pending writes
+
+    EXPECT_EQ(client->getRidForVid(VLAN_VID), VLAN_RID);
+
+    client->removeVidAndRid(VLAN_VID, VLAN_RID);
+
+    EXPECT_EQ(client->getVidForRid(VLAN_RID), SAI_NULL_OBJECT_ID);
+
+    client->insertVidAndRid(VLAN_VID, VLAN_RID);
+
+    EXPECT_EQ(client->getVidForRid(VLAN_RID), VLAN_VID);
+
+    client->removeVidAndRid(VLAN_VID, VLAN_RID);
+
+    EXPECT_EQ(client->getVidToRidMap().count(VLAN_VID), 0);
+
+    client->insertVidAndRid(VLAN_VID, VLAN_RID);
+
+    auto v2r = client->getVidToRidMap(SWITCH_VID);
+
+    EXPECT_EQ(v2r[VLAN_VID], VLAN_RID);
+
+    client->insertVidAndRid(VLAN_VID + 1, VLAN_RID + 1);
+
+    EXPECT_EQ(client->getRidToVidMap()[VLAN_RID + 1], VLAN_VID + 1);
+
+    client->removeVidAndRid(VLAN_VID, VLAN_RID);
+    client->removeVidAndRid(VLAN_VID + 1, VLAN_RID + 1);
+
+    client->setAsicStateWriteBehind(false);
+
+    EXPECT_EQ(observer->hget(VIDTORID, strVid), nullptr);
+    EXPECT_EQ(observer->hget(RIDTOVID, strRid), nullptr);
+}
+
+TEST(RedisClient, writeBehindViewReads)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto observer = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    auto key = vlanKey();
+
+    observer->del(key);
+
+    client->setAsicStateWriteBehind(true);
+
+    // init and apply view read database content, so all reads used by them
+    // must act as barriers for pending writes
+
+    client->createAsicObject(vlanMetaKey(), { { "SAI_VLAN_ATTR_VLAN_ID", "10" } });
+
+    auto keys = client->getAsicStateKeys();
+
+    EXPECT_NE(std::find(keys.begin(), keys.end(), key), keys.end());
+
+    client->setAsicObject(vlanMetaKey(), "SAI_VLAN_ATTR_VLAN_ID", "20");
+
+    auto view = client->getAsicView();
+
+    auto strMetaKey = sai_serialize_object_meta_key(vlanMetaKey());
+
+    ASSERT_EQ(view[SWITCH_VID].count(strMetaKey), 1);
+    EXPECT_EQ(view[SWITCH_VID][strMetaKey]["SAI_VLAN_ATTR_VLAN_ID"], "20");
+
+    client->setAsicObject(vlanMetaKey(), "SAI_VLAN_ATTR_VLAN_ID", "30");
+
+    auto attrs = client->getAttributesFromAsicKey(key);
+
+    EXPECT_EQ(attrs["SAI_VLAN_ATTR_VLAN_ID"], "30");
+
+    client->removeAsicObject(vlanMetaKey());
+
+    keys = client->getAsicStateKeys();
+
+    EXPECT_EQ(std::find(keys.begin(), keys.end(), key), keys.end());
+
+    client->setAsicStateWriteBehind(false);
+}
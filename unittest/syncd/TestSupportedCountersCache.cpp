@@ -0,0 +1,149 @@
+#include "SupportedCountersCache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace syncd;
+
+static const std::string file = "test_supported_counters_cache.json";
+
+TEST(SupportedCountersCache, persist)
+{
+    remove(file.c_str());
+
+    bool supported = false;
+
+    {
+        SupportedCountersCache cache(file, "platform");
+
+        EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_OCTETS", supported));
+
+        cache.setSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_OCTETS", true);
+        cache.setSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_UCAST_PKTS", false);
+        cache.flush();
+    }
+
+    SupportedCountersCache cache(file, "platform");
+
+    EXPECT_TRUE(cache.getSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_OCTETS", supported));
+    EXPECT_TRUE(supported);
+
+    EXPECT_TRUE(cache.getSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_UCAST_PKTS", supported));
+    EXPECT_FALSE(supported);
+
+    // stats mode is part of key
+
+    EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ_AND_CLEAR, "SAI_PORT_STAT_IF_IN_OCTETS", supported));
+
+    remove(file.c_str());
+}
+
+TEST(SupportedCountersCache, perObject)
+{
+    remove(file.c_str());
+
+    bool supported = false;
+
+    {
+        SupportedCountersCache cache(file, "platform");
+
+        cache.setSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000001, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", true);
+        cache.setSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000002, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", false);
+
+        // written on destruction
+    }
+
+    {
+        SupportedCountersCache cache(file, "platform", true);
+
+        EXPECT_TRUE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000001, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+        EXPECT_TRUE(supported);
+
+        EXPECT_TRUE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000002, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+        EXPECT_FALSE(supported);
+
+        // object is part of key
+
+        EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000003, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+        EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+
+        cache.removeObject(SAI_OBJECT_TYPE_QUEUE, 0x1500000002);
+
+        EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000002, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+
+        cache.setSupported(SAI_OBJECT_TYPE_QUEUE, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_BYTES", true);
+    }
+
+    {
+        SupportedCountersCache cache(file, "platform", true);
+
+        EXPECT_TRUE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000001, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+        EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000002, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+    }
+
+    // objects are created again on cold start, only per object type
+    // entries are kept
+
+    {
+        SupportedCountersCache cache(file, "platform");
+
+        EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000001, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+        EXPECT_TRUE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_BYTES", supported));
+    }
+
+    SupportedCountersCache cache(file, "platform", true);
+
+    EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_QUEUE, 0x1500000001, SAI_STATS_MODE_READ, "SAI_QUEUE_STAT_PACKETS", supported));
+
+    remove(file.c_str());
+}
+
+TEST(SupportedCountersCache, invalidFile)
+{
+    {
+        std::ofstream ofs(file);
+
+        ofs << "{ not json";
+    }
+
+    SupportedCountersCache cache(file, "platform");
+
+    bool supported;
+
+    EXPECT_FALSE(cache.getSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_OCTETS", supported));
+
+    // corrupted file is replaced on flush
+
+    cache.setSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_OCTETS", true);
+    cache.flush();
+
+    SupportedCountersCache reloaded(file, "platform");
+
+    EXPECT_TRUE(reloaded.getSupported(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, SAI_STATS_MODE_READ, "SAI_PORT_STAT_IF_IN_OCTETS", supported));
+
+    remove(file.c_str());
+}
+
+TEST(SupportedCountersCache, makePlatformId)
+{
+    std::map<std::string, std::string> profile;
+
+    profile["SAI_INIT_CONFIG_FILE"] = "/usr/share/sonic/hwsku/sai.profile";
+    profile[SAI_KEY_BOOT_TYPE] = "0";
+
+    auto cold = SupportedCountersCache::makePlatformId("sku", profile);
+
+    profile[SAI_KEY_BOOT_TYPE] = "1";
+
+    EXPECT_EQ(cold, SupportedCountersCache::makePlatformId("sku", profile));
+
+    // SKUs could share the same profile
+
+    EXPECT_NE(cold, SupportedCountersCache::makePlatformId("other sku", profile));
+
+    profile["SAI_INIT_CONFIG_FILE"] = "/usr/share/sonic/hwsku/other.profile";
+
+    EXPECT_NE(cold, SupportedCountersCache::makePlatformId("sku", profile));
+}
@@ -0,0 +1,95 @@
+#include "VendorSaiLock.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+using namespace syncd;
+
+TEST(VendorSaiLock, policyStringToPolicy)
+{
+    EXPECT_EQ(VendorSaiLock::policyStringToPolicy("global"), SAI_API_LOCK_POLICY_GLOBAL);
+    EXPECT_EQ(VendorSaiLock::policyStringToPolicy("stats"), SAI_API_LOCK_POLICY_STATS);
+    EXPECT_EQ(VendorSaiLock::policyStringToPolicy("rw"), SAI_API_LOCK_POLICY_RW);
+    EXPECT_EQ(VendorSaiLock::policyStringToPolicy("none"), SAI_API_LOCK_POLICY_NONE);
+    EXPECT_EQ(VendorSaiLock::policyStringToPolicy("foo"), SAI_API_LOCK_POLICY_UNKNOWN);
+
+    EXPECT_EQ(VendorSaiLock::policyToString(SAI_API_LOCK_POLICY_RW), "rw");
+    EXPECT_EQ(VendorSaiLock::policyToString(SAI_API_LOCK_POLICY_UNKNOWN), "unknown");
+}
+
+TEST(VendorSaiLock, ctor)
+{
+    EXPECT_THROW(std::make_shared<VendorSaiLock>(SAI_API_LOCK_POLICY_UNKNOWN), std::runtime_error);
+}
+
+TEST(VendorSaiLock, statsNotBlockedByModify)
+{
+    VendorSaiLock lock(SAI_API_LOCK_POLICY_STATS);
+
+    auto modify = lock.lock(SAI_API_LOCK_CLASS_MODIFY);
+
+    bool done = false;
+
+    std::thread thread([&]() {
+            auto stats = lock.lock(SAI_API_LOCK_CLASS_STATS);
+            done = true;
+            });
+
+    thread.join();
+
+    EXPECT_TRUE(done);
+
+    EXPECT_EQ(lock.getWaitStatistics(SAI_API_LOCK_CLASS_MODIFY).calls, 1);
+    EXPECT_EQ(lock.getWaitStatistics(SAI_API_LOCK_CLASS_STATS).calls, 1);
+    EXPECT_EQ(lock.getWaitStatistics(SAI_API_LOCK_CLASS_READ).calls, 0);
+}
+
+TEST(VendorSaiLock, readersShareLock)
+{
+    VendorSaiLock lock(SAI_API_LOCK_POLICY_RW);
+
+    auto read = lock.lock(SAI_API_LOCK_CLASS_READ);
+
+    std::thread thread([&]() {
+            auto stats = lock.lock(SAI_API_LOCK_CLASS_STATS);
+            });
+
+    thread.join();
+
+    EXPECT_EQ(lock.getWaitStatistics(SAI_API_LOCK_CLASS_STATS).calls, 1);
+}
+
+TEST(VendorSaiLock, none)
+{
+    VendorSaiLock lock(SAI_API_LOCK_POLICY_NONE);
+
+    auto a = lock.lock(SAI_API_LOCK_CLASS_MODIFY);
+    auto b = lock.lock(SAI_API_LOCK_CLASS_MODIFY);
+
+    EXPECT_EQ(lock.getPolicy(), SAI_API_LOCK_POLICY_NONE);
+    EXPECT_EQ(lock.getWaitStatistics(SAI_API_LOCK_CLASS_MODIFY).calls, 2);
+    EXPECT_THROW(lock.getWaitStatistics(SAI_API_LOCK_CLASS_COUNT), std::runtime_error);
+}
+
+TEST(VendorSaiLock, unlock)
+{
+    VendorSaiLock lock(SAI_API_LOCK_POLICY_GLOBAL);
+
+    auto modify = lock.lock(SAI_API_LOCK_CLASS_MODIFY);
+
+    modify.unlock();
+
+    std::thread thread([&]() {
+            auto other = lock.lock(SAI_API_LOCK_CLASS_MODIFY);
+            });
+
+    thread.join();
+
+    // second unlock is no-op
+
+    modify.unlock();
+
+    EXPECT_EQ(lock.getWaitStatistics(SAI_API_LOCK_CLASS_MODIFY).calls, 2);
+}
@@ -189,7 +189,7 @@ TEST(SaiUnittests, bulkGetClearStats)
 
     sai.initialize(0, &test_services);
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, sai.bulkGetStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, sai.bulkGetStats(SAI_NULL_OBJECT_ID,
                                                            SAI_OBJECT_TYPE_PORT,
                                                            0,
                                                            nullptr,
@@ -198,7 +198,7 @@ TEST(SaiUnittests, bulkGetClearStats)
                                                            SAI_STATS_MODE_BULK_READ,
                                                            nullptr,
                                                            nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, sai.bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, sai.bulkClearStats(SAI_NULL_OBJECT_ID,
                                                              SAI_OBJECT_TYPE_PORT,
                                                              0,
                                                              nullptr,
@@ -113,3 +113,68 @@ TEST_F(VirtualSwitchSaiInterfaceTest, portBulkAddRemove)
         ASSERT_EQ(statusList.at(i), SAI_STATUS_SUCCESS);
     }
 }
+
+TEST_F(VirtualSwitchSaiInterfaceTest, bulkGetClearStats)
+{
+    std::array<sai_object_id_t, 32> ports;
+
+    sai_attribute_t attr;
+    attr.id = SAI_SWITCH_ATTR_PORT_LIST;
+    attr.value.objlist.count = static_cast<std::uint32_t>(ports.size());
+    attr.value.objlist.list = ports.data();
+
+    ASSERT_EQ(m_vssai->get(SAI_OBJECT_TYPE_SWITCH, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+    ASSERT_GE(attr.value.objlist.count, 2u);
+
+    std::array<sai_object_key_t, 2> keys;
+    keys[0].key.object_id = ports[0];
+    keys[1].key.object_id = ports[1];
+
+    m_vssai->debugSetStats(ports[0], {{SAI_PORT_STAT_IF_IN_OCTETS, 100}, {SAI_PORT_STAT_IF_OUT_OCTETS, 200}});
+    m_vssai->debugSetStats(ports[1], {{SAI_PORT_STAT_IF_IN_OCTETS, 300}});
+
+    std::array<sai_stat_id_t, 2> ids = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS };
+    std::array<sai_status_t, 2> statuses;
+    std::array<uint64_t, 4> counters;
+
+    auto status = m_vssai->bulkGetStats(
+        SAI_NULL_OBJECT_ID, SAI_OBJECT_TYPE_PORT, 2, keys.data(), 2, ids.data(),
+        SAI_STATS_MODE_BULK_READ_AND_CLEAR, statuses.data(), counters.data());
+
+    ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(counters[0], 100u);
+    EXPECT_EQ(counters[1], 200u);
+    EXPECT_EQ(counters[2], 300u);
+    EXPECT_EQ(counters[3], 0u);
+
+    // counters were cleared by previous read
+
+    status = m_vssai->bulkGetStats(
+        m_swid, SAI_OBJECT_TYPE_PORT, 2, keys.data(), 2, ids.data(),
+        SAI_STATS_MODE_BULK_READ, statuses.data(), counters.data());
+
+    ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(counters[0], 0u);
+    EXPECT_EQ(counters[2], 0u);
+
+    m_vssai->debugSetStats(ports[1], {{SAI_PORT_STAT_IF_IN_OCTETS, 400}});
+
+    status = m_vssai->bulkClearStats(
+        m_swid, SAI_OBJECT_TYPE_PORT, 2, keys.data(), 2, ids.data(),
+        SAI_STATS_MODE_BULK_CLEAR, statuses.data());
+
+    ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+
+    status = m_vssai->bulkGetStats(
+        m_swid, SAI_OBJECT_TYPE_PORT, 2, keys.data(), 2, ids.data(),
+        SAI_STATS_MODE_BULK_READ, statuses.data(), counters.data());
+
+    ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(counters[2], 0u);
+
+    EXPECT_EQ(m_vssai->bulkGetStats(
+        0x1234, SAI_OBJECT_TYPE_PORT, 2, keys.data(), 2, ids.data(),
+        SAI_STATS_MODE_BULK_READ, statuses.data(), counters.data()), SAI_STATUS_FAILURE);
+}
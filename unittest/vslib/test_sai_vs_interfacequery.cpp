@@ -58,7 +58,7 @@ TEST(libsaivs, sai_switch_id_query)
 
 TEST(libsaivs, sai_bulk_object_get_stats)
 {
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, sai_bulk_object_get_stats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, sai_bulk_object_get_stats(SAI_NULL_OBJECT_ID,
                                                                     SAI_OBJECT_TYPE_PORT,
                                                                     0,
                                                                     nullptr,
@@ -71,7 +71,7 @@ TEST(libsaivs, sai_bulk_object_get_stats)
 
 TEST(libsaivs, sai_bulk_object_clear_stats)
 {
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, sai_bulk_object_clear_stats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, sai_bulk_object_clear_stats(SAI_NULL_OBJECT_ID,
                                                                       SAI_OBJECT_TYPE_PORT,
                                                                       0,
                                                                       nullptr,
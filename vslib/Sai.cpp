@@ -534,7 +534,16 @@ sai_status_t Sai::bulkGetStats(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return m_meta->bulkGetStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t Sai::bulkClearStats(
@@ -551,7 +560,15 @@ sai_status_t Sai::bulkClearStats(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return m_meta->bulkClearStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
 }
 
 // BULK QUAD OID
@@ -1056,7 +1056,41 @@ sai_status_t VirtualSwitchSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto ss = getSwitchStateForStats(switchId);
+
+    if (ss == nullptr)
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    /*
+     * Bulk read modes are the same as single object modes, just executed on
+     * each object.
+     */
+
+    sai_stats_mode_t objectMode = (mode == SAI_STATS_MODE_BULK_READ_AND_CLEAR)
+        ? SAI_STATS_MODE_READ_AND_CLEAR
+        : SAI_STATS_MODE_READ;
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = ss->getStatsExt(
+                object_type,
+                object_key[idx].key.object_id,
+                number_of_counters,
+                counter_ids,
+                objectMode,
+                &counters[idx * number_of_counters]);
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
@@ -1071,7 +1105,70 @@ sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto ss = getSwitchStateForStats(switchId);
+
+    if (ss == nullptr)
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    /*
+     * Same as clear stats, counters are read locally with read and clear
+     * mode and discarded.
+     */
+
+    std::vector<uint64_t> counters(number_of_counters);
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = ss->getStatsExt(
+                object_type,
+                object_key[idx].key.object_id,
+                number_of_counters,
+                counter_ids,
+                SAI_STATS_MODE_READ_AND_CLEAR,
+                counters.data());
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+std::shared_ptr<SwitchStateBase> VirtualSwitchSaiInterface::getSwitchStateForStats(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    if (switchId == SAI_NULL_OBJECT_ID)
+    {
+        // like in get stats, single switch is assumed when not specified
+
+        if (m_switchStateMap.size() != 1)
+        {
+            SWSS_LOG_ERROR("switch id must be specified when there are %zu switches", m_switchStateMap.size());
+
+            return nullptr;
+        }
+
+        return m_switchStateMap.begin()->second;
+    }
+
+    auto it = m_switchStateMap.find(switchId);
+
+    if (it == m_switchStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find switch %s in switch state map", sai_serialize_object_id(switchId).c_str());
+
+        return nullptr;
+    }
+
+    return it->second;
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkRemove(
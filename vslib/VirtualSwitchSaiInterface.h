@@ -278,6 +278,14 @@ namespace saivs
             void removeSwitch(
                     _In_ sai_object_id_t switchId);
 
+            /**
+             * @brief Get switch state for bulk stats operations.
+             *
+             * When switch id is not specified, single switch is expected.
+             */
+            std::shared_ptr<SwitchStateBase> getSwitchStateForStats(
+                    _In_ sai_object_id_t switchId);
+
         public:
 
             void setMeta(
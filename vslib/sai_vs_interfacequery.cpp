@@ -227,7 +227,16 @@ sai_status_t sai_bulk_object_get_stats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return vs_sai->bulkGetStats(
+            switch_id,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t sai_bulk_object_clear_stats(
@@ -242,5 +251,13 @@ sai_status_t sai_bulk_object_clear_stats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return vs_sai->bulkClearStats(
+            switch_id,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
 }